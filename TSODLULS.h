@@ -29,11 +29,161 @@ along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
 #include <ieee754.h>
 #include <byteswap.h>
 #include <limits.h>
+#include <pthread.h>
+#include <stddef.h>
 
 //------------------------------------------------------------------------------------
 //Constants
 //------------------------------------------------------------------------------------
 #define I_HALF_BYTE -1//sometimes 4 bits are sufficient for padding
+#define I_KEY_ARENA_DEFAULT_SLAB_SIZE 1048576//1 MiB
+#define I_KEY_ARENA_FLAG (((size_t)1) << (sizeof(size_t) * 8 - 1))//set in i_allocated_size for the keys in a key arena
+
+//Types of the fields of a TSOD (Tree Structured Order Definition) for the parsed orders
+#define I_TSODL_TYPE__UINT8 1
+#define I_TSODL_TYPE__UINT16 2
+#define I_TSODL_TYPE__UINT32 3
+#define I_TSODL_TYPE__UINT64 4
+#define I_TSODL_TYPE__INT8 5
+#define I_TSODL_TYPE__INT16 6
+#define I_TSODL_TYPE__INT32 7
+#define I_TSODL_TYPE__INT64 8
+#define I_TSODL_TYPE__FLOAT 9
+#define I_TSODL_TYPE__DOUBLE 10
+#define I_TSODL_TYPE__CHAR 11//CHAR(n), fixed length string
+#define I_TSODL_TYPE__VARCHAR_NULL 12//VARCHAR(NULL) or VARCHAR(NULL(k)), terminated string
+#define I_TSODL_TYPE__VARCHAR_LENGTH 13//VARCHAR(CURRENT->length INT), string with a length field
+
+//Opcodes of the compiled TSODs (see t_TSODLULS_tsodl_program)
+#define I_TSODL_OPCODE__CURRENT 1//the addresses of the batch are the addresses of the objects
+#define I_TSODL_OPCODE__ADD_OFFSET 2//.field
+#define I_TSODL_OPCODE__LOAD_POINTER 3//->field, *expression or the data of a string
+#define I_TSODL_OPCODE__LOAD_LENGTH 4//length of VARCHAR(CURRENT->length INT)
+#define I_TSODL_OPCODE__NUMERIC 5
+#define I_TSODL_OPCODE__CHAR 6
+#define I_TSODL_OPCODE__VARCHAR_NULL 7
+#define I_TSODL_OPCODE__VARCHAR_LENGTH 8
+#define I_TSODL_BATCH_SIZE 256//number of objects processed by each instruction at once
+#define I_TSODL_MODE__SIZING 1//the sizes of the long keys are computed
+#define I_TSODL_MODE__LONG 2//the long keys are written
+#define I_TSODL_MODE__SHORT 3//the short keys are written
+
+//Cell types of the sort engines (see t_TSODLULS_sort_engine)
+#define I_CELL_TYPE__LONG 1//t_TSODLULS_sort_element
+#define I_CELL_TYPE__SHORT 2//t_TSODLULS_sort_element__short
+
+//Algorithms chosen by the sort dispatchers (see TSODLULS_choose_sort_algorithm())
+#define I_SORT_ALGORITHM__INSERTION 1
+#define I_SORT_ALGORITHM__COMPARISON 2//quicksort with the nextified key order
+#define I_SORT_ALGORITHM__RADIX 3
+
+//Steps of the time-sliced sorts (see TSODLULS_sort_step__short())
+#define I_SORT_STEP__COUNT 1//the bytes of the current instance are counted
+#define I_SORT_STEP__SCATTER 2//the cells of the current instance are moved in their buckets
+#define I_SORT_STEP__BUCKETS 3//the buckets of the current instance are pushed or finished
+#define I_SORT_STEP__COPY_BACK 4//a sorted bucket is copied from the buffer in the array
+#define I_SORT_STEP__FINISHED 5
+#define I_SORT_STEP_CHUNK_SIZE__SHORT 4096//cells processed between two checks of the budget of a step
+
+//Instruction sets of the partitions of TSODLULS_qsort_vectorized__short(), chosen at runtime
+#define I_INSTRUCTION_SET__SCALAR 0//branchless partition without SIMD
+#define I_INSTRUCTION_SET__AVX2 1
+#define I_INSTRUCTION_SET__AVX512 2//AVX-512F
+#define I_PARTITION_BLOCK_SIZE__SHORT 64//cells of the blocks of the partitions (multiple of 16)
+//The SIMD partitions are compiled with GCC or Clang on x86-64, unless -DTSODLULS_NO_SIMD
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(TSODLULS_NO_SIMD)
+#define TSODLULS_X86_SIMD
+#endif
+
+//Machine-specific values of the following constants generated by "make autotune"
+//(see code_generation/autotune.c), the library is compiled with -DTSODLULS_TUNING when they exist.
+#ifdef TSODLULS_TUNING
+#include "TSODLULS_tuning.h"
+#endif
+
+//Insertion sort thresholds of the sort engines for short cells, they can be overriden at compile time.
+#ifndef I_RADIX_INSERTION_THRESHOLD__SHORT
+#define I_RADIX_INSERTION_THRESHOLD__SHORT 5//buckets of at most 5 elements are sorted by insertion sort
+#endif
+#ifndef I_QSORT_INSERTION_THRESHOLD__SHORT
+#define I_QSORT_INSERTION_THRESHOLD__SHORT 4//MAX_THRESH of glibc qsort
+#endif
+#define I_SORT_NETWORK_MAX_SIZE__SHORT 16//biggest sorting network for short cells
+#ifndef I_RADIX_NETWORK_THRESHOLD__SHORT
+#define I_RADIX_NETWORK_THRESHOLD__SHORT 16//buckets of at most 16 elements are sorted by sorting networks
+#endif
+
+//Parameters of TSODLULS_pdqsort() for long cells, the values of pdqsort
+#define I_PDQSORT_INSERTION_THRESHOLD 24//partitions of less than 24 elements are sorted by insertion sort
+#define I_PDQSORT_NINTHER_THRESHOLD 128//the pivot is a pseudomedian of 9 elements above 128 elements
+#define I_PDQSORT_PARTIAL_INSERTION_LIMIT 8//elements moved by the insertion sort of an already partitioned partition
+
+//Parameters of the in-place samplesorts (see TSODLULS_sort_samplesort())
+#define I_SAMPLESORT_LOG2_MAX_NUMBER_OF_LEAVES 7//at most 127 splitters in the search tree
+#define I_SAMPLESORT_MAX_NUMBER_OF_LEAVES 128
+#define I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS 255//128 buckets between the splitters and 127 equality buckets
+#define I_SAMPLESORT_BLOCK_SIZE 64//long cells of the blocks of the distribution (2 KiB)
+#define I_SAMPLESORT_BLOCK_SIZE__SHORT 128//short cells of the blocks of the distribution (2 KiB)
+#define I_SAMPLESORT_MAX_DEPTH 16//deeper partitions are sorted by the comparison sort
+#ifndef I_SAMPLESORT_BASE_CASE_SIZE
+#define I_SAMPLESORT_BASE_CASE_SIZE 4096//smaller partitions are sorted by the comparison sort
+#endif
+
+//Parameters of the NUMA-aware parallel sort (see TSODLULS_sort_parallel_numa())
+#define I_NUMA_MAX_NODE_ID 1024//the nodes with bigger identifiers are ignored
+#define I_NUMA_MAX_CPU_ID 1024//CPU_SETSIZE of glibc
+#define I_NUMA_NUMBER_OF_BUCKETS 65536//the cells are distributed by the first 2 bytes of their keys
+
+//Default cost model of the sort dispatchers (see t_TSODLULS_sort_model), costs in nanoseconds
+//They were measured on an x86-64 machine and can be overriden at compile time.
+#ifndef I_SORT_MODEL__SAMPLE_SIZE
+#define I_SORT_MODEL__SAMPLE_SIZE 32
+#endif
+#ifndef I_SORT_MODEL__INSERTION_THRESHOLD
+#define I_SORT_MODEL__INSERTION_THRESHOLD 8
+#endif
+#ifndef F_SORT_MODEL__COMPARISON_COST
+#define F_SORT_MODEL__COMPARISON_COST 25.0
+#endif
+#ifndef F_SORT_MODEL__COMPARISON_BYTE_COST
+#define F_SORT_MODEL__COMPARISON_BYTE_COST 0.25
+#endif
+#ifndef F_SORT_MODEL__RADIX_SETUP_COST
+#define F_SORT_MODEL__RADIX_SETUP_COST 1200.0
+#endif
+#ifndef F_SORT_MODEL__RADIX_LEVEL_COST
+#define F_SORT_MODEL__RADIX_LEVEL_COST 350.0
+#endif
+#ifndef F_SORT_MODEL__RADIX_COUNT_COST
+#define F_SORT_MODEL__RADIX_COUNT_COST 2.0
+#endif
+#ifndef F_SORT_MODEL__RADIX_PASS_COST
+#define F_SORT_MODEL__RADIX_PASS_COST 40.0
+#endif
+#ifndef F_SORT_MODEL__RADIX_INSTANCE_COST
+#define F_SORT_MODEL__RADIX_INSTANCE_COST 500.0
+#endif
+#ifndef I_SORT_MODEL__INSERTION_THRESHOLD__SHORT
+#define I_SORT_MODEL__INSERTION_THRESHOLD__SHORT 8
+#endif
+#ifndef F_SORT_MODEL__COMPARISON_COST__SHORT
+#define F_SORT_MODEL__COMPARISON_COST__SHORT 7.5
+#endif
+#ifndef F_SORT_MODEL__RADIX_SETUP_COST__SHORT
+#define F_SORT_MODEL__RADIX_SETUP_COST__SHORT 1000.0
+#endif
+#ifndef F_SORT_MODEL__RADIX_LEVEL_COST__SHORT
+#define F_SORT_MODEL__RADIX_LEVEL_COST__SHORT 350.0
+#endif
+#ifndef F_SORT_MODEL__RADIX_COUNT_COST__SHORT
+#define F_SORT_MODEL__RADIX_COUNT_COST__SHORT 2.0
+#endif
+#ifndef F_SORT_MODEL__RADIX_PASS_COST__SHORT
+#define F_SORT_MODEL__RADIX_PASS_COST__SHORT 24.0
+#endif
+#ifndef F_SORT_MODEL__RADIX_INSTANCE_COST__SHORT
+#define F_SORT_MODEL__RADIX_INSTANCE_COST__SHORT 220.0
+#endif
 
 //Error codes
 //Positive error codes are defined in this library for algorithmical, profile parsing and technical errors
@@ -54,9 +204,23 @@ along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
 //-sorting parameters errors
 #define I_ERROR__MAX_LENGTH_SHOULD_BE_POSITIVE 200
 #define I_ERROR__MAX_LENGTH_SHOULD_BE_AT_MOST_8 201
+#define I_ERROR__SORT_STATS_NOT_COMPILED 202//the library was compiled without -DTSODLULS_STATS
+#define I_ERROR__UNKNOWN_SORT_ENGINE 203
+#define I_ERROR__SORT_ENGINE_NAME_ALREADY_USED 204
+#define I_ERROR__SEGMENT_OFFSETS_SHOULD_BE_NON_DECREASING 205
+#define I_ERROR__TOO_MANY_ELEMENTS_FOR_SORTING_NETWORK 206
+#define I_ERROR__KEY_NOT_IN_DICTIONARY 207
 //padding increment/decrement on lex or contrelex node errors
 #define I_ERROR__COULD_NOT_DECREASE_LEX_MULTIBYTE 300
 #define I_ERROR__COULD_NOT_INCREASE_CONTRELEX_MULTIBYTE 301
+//TSODL parsing errors (the offset of the error in the TSOD is kept in the parsed order)
+#define I_ERROR__TSODL_SYNTAX_ERROR 400
+#define I_ERROR__TSODL_UNKNOWN_TYPE 401
+#define I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT 402
+#define I_ERROR__TSODL_INVALID_RANGE 403
+#define I_ERROR__TSODL_INVALID_LENGTH 404
+#define I_ERROR__TSODL_UNKNOWN_MEMBER 405
+#define I_ERROR__TSODL_KEY_TOO_LONG_FOR_SHORT_CELLS 406
 //Negative error codes are user defined
 
 
@@ -91,6 +255,300 @@ typedef struct TSODLULS_sort_element__short {
 
 
 
+/**
+ * The arena for the keys of long orders
+ * Keys are bump allocated in large slabs and all slabs are freed at once.
+ */
+typedef struct TSODLULS_key_arena {
+  uint8_t** arr_slabs;
+  size_t i_number_of_slabs;
+  size_t i_allocated_number_of_slabs;
+  size_t i_slab_size;
+  size_t i_size_of_last_slab;
+  size_t i_used_in_last_slab;
+} t_TSODLULS_key_arena;
+
+
+
+/**
+ * The precomputed layout of the bytes added to a key for one primitive width and one current offset
+ * (see t_TSODLULS_padding_plan)
+ */
+typedef struct TSODLULS_padding_layout {
+  size_t i_size;
+  uint8_t* s_template;//padding bytes already in place, data bytes at 0
+  size_t arr_data_positions[8];
+} t_TSODLULS_padding_layout;
+
+
+
+/**
+ * A padding plan: padding parameters checked once,
+ * and the layouts for each primitive width and each current offset
+ */
+typedef struct TSODLULS_padding_plan {
+  int8_t i_number_of_lex_padding_bytes_before;
+  int8_t i_number_of_contrelex_padding_bytes_before;
+  int8_t i_number_of_lex_padding_bytes_after;
+  int8_t i_number_of_contrelex_padding_bytes_after;
+  int8_t i_number_of_contiguous_data_bytes;
+  t_TSODLULS_padding_layout* arr_layouts_uint8;
+  t_TSODLULS_padding_layout* arr_layouts_uint16;
+  t_TSODLULS_padding_layout* arr_layouts_uint32;
+  t_TSODLULS_padding_layout* arr_layouts_uint64;
+  uint8_t* s_templates;
+} t_TSODLULS_padding_plan;
+
+
+
+/**
+ * A field of a parsed TSOD (Tree Structured Order Definition)
+ * The expressions are normalized TSODL expressions like "*CURRENT->s_name" or "CURRENT.date.i_year".
+ */
+typedef struct TSODLULS_tsodl_field {
+  char* s_expression;
+  char* s_length_expression;//only for VARCHAR(CURRENT->length INT)
+  int i_type;
+  int i_length_type;//only for VARCHAR(CURRENT->length INT)
+  unsigned int b_descending;
+  unsigned int b_range;
+  int64_t i_range_min;
+  int64_t i_range_max;
+  uint8_t i_terminator;//only for VARCHAR(NULL(k))
+  unsigned int b_lexicographic;//only for LEXICOGRAPHIC(string field): DESC applies to the characters
+  size_t i_char_length;//only for CHAR(n)
+  size_t i_key_size;//size of the field in the key, 0 if it varies
+} t_TSODLULS_tsodl_field;
+
+
+
+/**
+ * A parsed TSOD (Tree Structured Order Definition)
+ * The NEXT operators are flattened in a list of fields.
+ */
+typedef struct TSODLULS_tsodl_order {
+  t_TSODLULS_tsodl_field* arr_fields;
+  size_t i_number_of_fields;
+  size_t i_allocated_number_of_fields;
+  size_t i_fixed_key_size;//sum of the sizes of the fields with a fixed size
+  unsigned int b_variable_key_size;
+  size_t i_error_offset;//offset in the TSOD of the last parsing error
+} t_TSODLULS_tsodl_order;
+
+
+
+/**
+ * The cost model used by the sort dispatchers to choose between insertion sort,
+ * the comparison model (quicksort) and the lexicographic model (radix sort)
+ * The costs are in nanoseconds and can be calibrated on the target machine.
+ * The keys are sampled to estimate their common prefix and their average length, then:
+ *  - comparison: n * log2(n) * (f_comparison_cost + common prefix * f_comparison_byte_cost),
+ *  - radix: f_radix_setup_cost + common prefix * (f_radix_level_cost + n * f_radix_count_cost)
+ *           + levels * n * f_radix_pass_cost + instances * f_radix_instance_cost,
+ *    where levels is the number of levels before the buckets are small enough for insertion sort.
+ * See TSODLULS_sort_model_init() for the default values.
+ */
+typedef struct TSODLULS_sort_model {
+  size_t i_sample_size;
+  //long cells
+  size_t i_insertion_threshold;//insertion sort is used for at most this number of elements
+  double f_comparison_cost;//per element and per level of the comparison sort
+  double f_comparison_byte_cost;//per byte of the common prefix compared
+  double f_radix_setup_cost;
+  double f_radix_level_cost;//per level where all the bytes are the same
+  double f_radix_count_cost;//per element and per level where all the bytes are the same
+  double f_radix_pass_cost;//per element and per level where the elements are moved
+  double f_radix_instance_cost;
+  //short cells
+  size_t i_insertion_threshold__short;
+  double f_comparison_cost__short;
+  double f_radix_setup_cost__short;
+  double f_radix_level_cost__short;
+  double f_radix_count_cost__short;
+  double f_radix_pass_cost__short;
+  double f_radix_instance_cost__short;
+} t_TSODLULS_sort_model;
+
+
+
+/**
+ * The counters filled in by the radix engines when the library is compiled with -DTSODLULS_STATS,
+ * to understand why a sort call was slow.
+ * Attach it to the current thread with TSODLULS_sort_stats_attach(), the counters are added
+ * by all the following sort calls of this thread until it is detached.
+ * Without -DTSODLULS_STATS, the counting code is not compiled and there is no overhead.
+ */
+typedef struct TSODLULS_sort_stats {
+  size_t i_histogram_passes;//number of times the bytes of an instance were counted
+  size_t i_single_byte_skips;//histogram passes where all the elements had the same byte
+  size_t i_instances_pushed;
+  size_t i_max_instance_stack_depth;
+  size_t i_bytes_scattered;//bytes of elements moved by the counting sort passes
+  size_t i_bytes_memcpy;//bytes of elements copied back from the buffer with memcpy()
+  size_t i_insertion_sorts;//insertion sorts of the small instances
+  size_t i_instances_reallocs;//growth events of the stack of instances
+} t_TSODLULS_sort_stats;
+
+#ifdef TSODLULS_STATS
+#define TSODLULS_SORT_STATS_ADD(field, value) \
+  do{\
+    if(p_TSODLULS_sort_stats != NULL){\
+      p_TSODLULS_sort_stats->field += (value);\
+    }\
+  }while(0)
+#define TSODLULS_SORT_STATS_MAX(field, value) \
+  do{\
+    if(p_TSODLULS_sort_stats != NULL && p_TSODLULS_sort_stats->field < (value)){\
+      p_TSODLULS_sort_stats->field = (value);\
+    }\
+  }while(0)
+#else
+#define TSODLULS_SORT_STATS_ADD(field, value) do{}while(0)
+#define TSODLULS_SORT_STATS_MAX(field, value) do{}while(0)
+#endif
+
+extern __thread t_TSODLULS_sort_stats* p_TSODLULS_sort_stats;//the stats attached to the current thread
+
+
+
+/**
+ * A sort engine of the registry (see TSODLULS_find_sort_engine()),
+ * so that any engine can be chosen by name at runtime, in the benchmarks for example.
+ * f_sort has the same signature for all engines, arr_elements is an array of
+ * t_TSODLULS_sort_element (I_CELL_TYPE__LONG) or t_TSODLULS_sort_element__short (I_CELL_TYPE__SHORT),
+ * and i_max_length is the maximum length of the keys of short cells (ignored for long cells).
+ * Use the macros TSODLULS_SORT_ENGINE_FUNCTION__LONG(function), TSODLULS_SORT_ENGINE_FUNCTION__SHORT(function)
+ * or TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(function) to define the function with this signature
+ * for an existing sort function, and TSODLULS_SORT_ENGINE(function, i_cell_type, b_stable)
+ * to initialize the engine, named after the function.
+ */
+typedef struct TSODLULS_sort_engine {
+  const char* s_name;
+  int i_cell_type;
+  unsigned int b_stable;
+  int (*f_sort)(void* arr_elements, size_t i_number_of_elements, uint8_t i_max_length);
+} t_TSODLULS_sort_engine;
+
+#define TSODLULS_SORT_ENGINE_FUNCTION__LONG(function) \
+  static int function##__sort_engine(void* arr_elements, size_t i_number_of_elements, uint8_t i_max_length){\
+    return function((t_TSODLULS_sort_element*)arr_elements, i_number_of_elements);\
+  }
+#define TSODLULS_SORT_ENGINE_FUNCTION__SHORT(function) \
+  static int function##__sort_engine(void* arr_elements, size_t i_number_of_elements, uint8_t i_max_length){\
+    return function((t_TSODLULS_sort_element__short*)arr_elements, i_number_of_elements, i_max_length);\
+  }
+#define TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(function) \
+  static int function##__sort_engine(void* arr_elements, size_t i_number_of_elements, uint8_t i_max_length){\
+    return function((t_TSODLULS_sort_element__short*)arr_elements, i_number_of_elements);\
+  }
+#define TSODLULS_SORT_ENGINE(function, i_cell_type, b_stable) {#function, i_cell_type, b_stable, function##__sort_engine}
+
+
+
+/**
+ * The fields of the objects for the sorts with lazy keys (see TSODLULS_sort_with_lazy_keys()):
+ * f_add_field() adds the TSO-encoding of the field i_field of the object of the cell
+ * at the end of its key (with TSODLULS_add_bytes_to_key_from_...() for example), and returns 0 or an error code.
+ * p_context is given to each call, and the fields are numbered from 0 to i_number_of_fields - 1.
+ */
+typedef struct TSODLULS_key_extender {
+  int (*f_add_field)(t_TSODLULS_sort_element* p_sort_element, size_t i_field, void* p_context);
+  void* p_context;
+  size_t i_number_of_fields;
+} t_TSODLULS_key_extender;
+
+
+
+/**
+ * An order-preserving dictionary of long keys (see TSODLULS_key_dictionary_init()):
+ * the rank of a key is its index in arr_keys, the distinct keys in increasing order,
+ * and the short key of a long key is its rank in the i_max_length first bytes.
+ * arr_slots is a hash table of the ranks + 1 (0 for an empty slot) with linear probing.
+ */
+typedef struct TSODLULS_key_dictionary {
+  t_TSODLULS_key_arena key_arena;//the bytes of the distinct keys
+  t_TSODLULS_sort_element* arr_keys;
+  size_t i_number_of_keys;
+  size_t* arr_slots;
+  size_t i_number_of_slots;//a power of 2, at least twice the number of keys
+  uint8_t i_max_length;
+} t_TSODLULS_key_dictionary;
+
+
+
+/**
+ * What TSODLULS_sort_parallel_numa() did with the NUMA nodes of the machine.
+ * A node without CPU is not counted, and a machine without NUMA has 1 node.
+ * The cells of the partition of a thread are written by all the threads,
+ * the bytes of cells written by a thread on another node cross the interconnect.
+ * On several nodes, a write is local only if the writing thread was pinned to its node
+ * and the partition is bound to the same node: the writes of a thread that was not pinned
+ * (or to an interleaved partition) are counted as remote, since their node is not known.
+ */
+typedef struct TSODLULS_numa_stats {
+  size_t i_number_of_nodes;
+  size_t i_number_of_threads;
+  size_t i_number_of_pinned_threads;//threads running on the CPUs of their node only
+  size_t i_number_of_bound_buffers;//buffers placed on the node of their thread with mbind() (not only first touch)
+  size_t i_number_of_interleaved_buffers;//buffers of the threads that could not be pinned, on all the nodes
+  size_t i_bytes_to_local_node;//bytes of cells written in a partition on the node of the writing thread
+  size_t i_bytes_to_remote_node;//bytes of cells written in a partition on another (or an unknown) node
+} t_TSODLULS_numa_stats;
+
+
+
+/**
+ * A member of the structures given to TSODLULS_tsodl_compile()
+ * The members are found by name, hence the names must be unique among the structures of a TSOD.
+ * b_array tells that the member is an array (char s_code[4]) and not a pointer (char* s_name).
+ * Use the macros TSODLULS_TSODL_MEMBER(type, member) and TSODLULS_TSODL_ARRAY_MEMBER(type, member).
+ */
+typedef struct TSODLULS_tsodl_member {
+  const char* s_name;
+  size_t i_offset;
+  unsigned int b_array;
+} t_TSODLULS_tsodl_member;
+
+#define TSODLULS_TSODL_MEMBER(type, member) {#member, offsetof(type, member), 0}
+#define TSODLULS_TSODL_ARRAY_MEMBER(type, member) {#member, offsetof(type, member), 1}
+
+
+
+/**
+ * An instruction of a compiled TSOD
+ */
+typedef struct TSODLULS_tsodl_instruction {
+  int i_opcode;
+  int i_type;//NUMERIC and LOAD_LENGTH
+  size_t i_argument;//offset for ADD_OFFSET, length for CHAR
+  size_t i_key_offset;//NUMERIC and CHAR: offset of the field in the key (used for short cells)
+  uint64_t i_subtract;//NUMERIC: minimum of the range or bias of the signed types
+  uint8_t i_key_size;//NUMERIC: number of bytes kept
+  uint8_t b_descending;
+  uint8_t b_lexicographic;//VARCHAR_NULL and VARCHAR_LENGTH: the end byte always comes first
+  uint8_t i_terminator;//VARCHAR_NULL
+} t_TSODLULS_tsodl_instruction;
+
+
+
+/**
+ * A compiled TSOD (Tree Structured Order Definition)
+ * The instructions computing the sizes of the variable fields come first,
+ * then the instructions writing all the fields.
+ * Each instruction is executed on a batch of I_TSODL_BATCH_SIZE objects.
+ */
+typedef struct TSODLULS_tsodl_program {
+  t_TSODLULS_tsodl_instruction* arr_instructions;
+  size_t i_number_of_instructions;
+  size_t i_allocated_number_of_instructions;
+  size_t i_number_of_sizing_instructions;
+  size_t i_fixed_key_size;
+  unsigned int b_variable_key_size;
+  size_t i_error_offset;//offset in the TSOD of the last parsing error
+} t_TSODLULS_tsodl_program;
+
+
+
 //------------------------------------------------------------------------------------
 //Internal structures for the sorting algorithms
 //------------------------------------------------------------------------------------
@@ -111,6 +569,28 @@ typedef struct TSODLULS_radix_instance__no_copy {
 
 
 
+/**
+ * The state of a time-sliced sort of short cells (see TSODLULS_sort_step_begin__short()),
+ * a radix sort whose stack of instances and position in the current instance are kept between the steps.
+ * The cells of the current instance are in arr_elements_copy when current_instance.b_copy is 1.
+ * The caller only declares it, its fields are internal.
+ */
+typedef struct TSODLULS_sort_step_context__short {
+  t_TSODLULS_sort_element__short* arr_elements;
+  size_t i_number_of_elements;
+  uint8_t i_max_length;
+  int i_step;
+  t_TSODLULS_sort_element__short* arr_elements_copy;
+  t_TSODLULS_radix_instance* arr_instances;
+  size_t i_number_of_instances;//instances on the stack
+  t_TSODLULS_radix_instance current_instance;
+  size_t i_next;//next cell of the current step, or next bucket for I_SORT_STEP__BUCKETS
+  size_t arr_counts[256];
+  size_t arr_offsets[256];
+} t_TSODLULS_sort_step_context__short;
+
+
+
 typedef struct {
   t_TSODLULS_sort_element* p_low;
   t_TSODLULS_sort_element* p_high;
@@ -125,6 +605,132 @@ typedef struct {
 
 
 
+/**
+ * The consecutive segments sorted by one thread of the parallel segmented sorts
+ */
+typedef struct TSODLULS_segmented_sort_task {
+  void* arr_elements;
+  const size_t* arr_segment_offsets;
+  size_t i_number_of_segments;
+  uint8_t i_max_length;
+  int i_result;
+} t_TSODLULS_segmented_sort_task;
+
+
+
+/**
+ * One thread of the in-place samplesorts and its buffers
+ */
+typedef struct TSODLULS_samplesort_thread {
+  struct TSODLULS_samplesort* p_samplesort;
+  size_t i_thread;
+  pthread_t thread;
+  unsigned int b_started;
+  void* arr_buffers;//one block of cells per bucket
+  size_t* arr_buffer_counts;//number of cells in the block of each bucket
+  size_t* arr_bucket_sizes;//number of cells of each bucket in the stripe of the thread
+  void* arr_swap_buffers;//two blocks of cells
+  size_t i_stripe_first;
+  size_t i_stripe_end;
+  size_t i_number_of_full_blocks;//written at the beginning of the stripe by the classification
+  int i_result;
+} t_TSODLULS_samplesort_thread;
+
+
+
+/**
+ * The state of the in-place samplesorts, shared by the threads of one partition step
+ * The buckets are numbered from 0: the even buckets are between two splitters,
+ * the odd bucket 2j - 1 contains the cells equal to the j-th splitter.
+ */
+typedef struct TSODLULS_samplesort {
+  void* arr_elements;
+  size_t i_number_of_elements;
+  size_t i_log2_number_of_leaves;
+  size_t i_number_of_buckets;
+  void* arr_tree;//the splitters in a perfect binary search tree, the children of the node i are 2i and 2i + 1
+  void* arr_splitters;//the sorted splitters, from index 1
+  void* arr_overflow;//one block of cells for the block of the last bucket that ends after the array
+  size_t* arr_bucket_starts;
+  size_t* arr_bucket_writes;//blocks before are in place
+  size_t* arr_bucket_reads;//blocks between the write and the read are not processed yet
+  size_t* arr_pending_reads;
+  pthread_mutex_t* arr_mutexes;//one per bucket
+  pthread_mutex_t next_bucket_mutex;
+  size_t i_next_bucket;//next bucket to sort by the threads
+  size_t i_number_of_threads;
+  t_TSODLULS_samplesort_thread* arr_threads;
+  uint64_t i_random;//state of the xorshift generator of the samples
+} t_TSODLULS_samplesort;
+
+
+
+/**
+ * One thread of TSODLULS_sort_parallel_numa(), running on the node i_node, and its node-local partition
+ */
+typedef struct TSODLULS_numa_sort_thread {
+  struct TSODLULS_numa_sort* p_numa_sort;
+  size_t i_thread;
+  size_t i_node;
+  pthread_t thread;
+  unsigned int b_started;
+  unsigned int b_own_thread;//the task is not done by the calling thread, hence the thread can be pinned
+  unsigned int b_pinned;
+  unsigned int b_bound;//the last buffer allocated is bound to the node
+  unsigned int b_interleaved;//the last buffer allocated is interleaved on all the nodes
+  size_t* arr_bucket_offsets;//number of cells of each bucket in the stripe, then where they are written
+  size_t i_stripe_first;
+  size_t i_stripe_end;
+  size_t i_partition_first;//where the partition is in the sorted array
+  size_t i_partition_size;
+  size_t i_buffer_size;//size of the mappings of arr_partition and arr_partition_copy
+  t_TSODLULS_sort_element* arr_partition;
+  t_TSODLULS_sort_element* arr_partition_copy;
+  size_t* arr_bytes_to_threads;//bytes of cells of the stripe for the partition of each thread, only for the stats
+  size_t i_bytes_to_local_node;
+  size_t i_bytes_to_remote_node;
+  int i_result;
+} t_TSODLULS_numa_sort_thread;
+
+
+
+/**
+ * The state of TSODLULS_sort_parallel_numa(), shared by the threads
+ * The node numbers are from 0 to i_number_of_nodes - 1, arr_node_ids contains the identifiers of the kernel.
+ */
+typedef struct TSODLULS_numa_sort {
+  t_TSODLULS_sort_element* arr_elements;
+  size_t i_number_of_elements;
+  size_t i_number_of_threads;
+  size_t i_number_of_nodes;
+  int arr_node_ids[I_NUMA_MAX_NODE_ID];
+  int arr_cpu_nodes[I_NUMA_MAX_CPU_ID];//node of each CPU, -1 if unknown
+  size_t* arr_bucket_owners;//thread sorting each bucket
+  t_TSODLULS_numa_sort_thread* arr_threads;
+} t_TSODLULS_numa_sort;
+
+
+
+//------------------------------------------------------------------------------------
+//Internal structures for the compiled TSODs
+//------------------------------------------------------------------------------------
+/**
+ * The registers of a batch of objects during the execution of a compiled TSOD
+ */
+typedef struct TSODLULS_tsodl_batch {
+  uint8_t* p_first_object;
+  size_t i_object_size;
+  size_t i_number_of_objects;
+  const uint8_t* arr_addresses[I_TSODL_BATCH_SIZE];
+  uint64_t arr_values[I_TSODL_BATCH_SIZE];
+  size_t arr_lengths[I_TSODL_BATCH_SIZE];
+  size_t arr_sizes[I_TSODL_BATCH_SIZE];//sizes of the long keys
+  uint8_t* arr_cursors[I_TSODL_BATCH_SIZE];//where the next field of the long keys is written
+  uint64_t arr_keys[I_TSODL_BATCH_SIZE];//short keys
+} t_TSODLULS_tsodl_batch;
+
+
+
 //------------------------------------------------------------------------------------
 //Conversion of finite orders
 //------------------------------------------------------------------------------------
@@ -295,103 +901,754 @@ int TSODLULS_add_bytes_to_key_from_uint32(
 );
 
 
-
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint64
+ * Available as a macraff (see TSODLULS_finite_orders__macro.h).
+ */
+int TSODLULS_add_bytes_to_key_from_uint64(
+  t_TSODLULS_sort_element* p_sort_element,
+  uint64_t i64,
+  int8_t i_number_of_lex_padding_bytes_before,
+  int8_t i_number_of_contrelex_padding_bytes_before,
+  int8_t i_number_of_lex_padding_bytes_after,
+  int8_t i_number_of_contrelex_padding_bytes_after,
+  int8_t i_number_of_contiguous_data_bytes,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * Number of data bytes of the variable-length encoding of an uint64 (see TSODLULS_add_bytes_to_key_from_uint64_varint()):
+ * 1 for 0, 2 for 1 to 255, 3 for 256 to 65535, ..., 9 from 2^56.
+ * The current offset after the encoding is (i_current_offset + this size) % i_number_of_contiguous_data_bytes.
+ */
+int8_t TSODLULS_get_varint_size_from_uint64(uint64_t i64);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * Number of data bytes of the variable-length encoding of an int64 (see TSODLULS_add_bytes_to_key_from_int64_varint()):
+ * 1 for -1 and 0, 2 for -256 to -2 and 1 to 255, ..., 9 below -2^56 and from 2^56.
+ */
+int8_t TSODLULS_get_varint_size_from_int64(int64_t i64);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint64 with a variable-length encoding:
+ * a first data byte with the number of significant bytes (0 to 8), and then the significant bytes (big-endian).
+ * The order is preserved and no encoding is a prefix of another one,
+ * hence the encoding can be followed by other data in a composite key,
+ * and values below 256 need 2 data bytes instead of 8.
+ * The padding parameters are applied to each data byte, like with TSODLULS_add_bytes_to_key_from_uint64(),
+ * and the number of data bytes is TSODLULS_get_varint_size_from_uint64(i64).
+ * Available as a macraff (see TSODLULS_finite_orders__macro.h).
+ */
+int TSODLULS_add_bytes_to_key_from_uint64_varint(
+  t_TSODLULS_sort_element* p_sort_element,
+  uint64_t i64,
+  int8_t i_number_of_lex_padding_bytes_before,
+  int8_t i_number_of_contrelex_padding_bytes_before,
+  int8_t i_number_of_lex_padding_bytes_after,
+  int8_t i_number_of_contrelex_padding_bytes_after,
+  int8_t i_number_of_contiguous_data_bytes,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From int64 with a variable-length encoding:
+ * a first data byte 9 + the number of significant bytes (0 to 8) for non negative values,
+ * and 8 - the number of significant bytes of -1 - i64 for negative values,
+ * and then the significant bytes (big-endian) of i64.
+ * The order is preserved and no encoding is a prefix of another one,
+ * hence values from -256 to 255 need at most 2 data bytes instead of 8.
+ * The number of data bytes is TSODLULS_get_varint_size_from_int64(i64).
+ * Available as a macraff (see TSODLULS_finite_orders__macro.h).
+ */
+int TSODLULS_add_bytes_to_key_from_int64_varint(
+  t_TSODLULS_sort_element* p_sort_element,
+  int64_t i64,
+  int8_t i_number_of_lex_padding_bytes_before,
+  int8_t i_number_of_contrelex_padding_bytes_before,
+  int8_t i_number_of_lex_padding_bytes_after,
+  int8_t i_number_of_contrelex_padding_bytes_after,
+  int8_t i_number_of_contiguous_data_bytes,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint8 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint8() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint8_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint8_t i8,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint16 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint16() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint16_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint16_t i16,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint32 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint32() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint32_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint32_t i32,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint64 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint64() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint64_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint64_t i64,
+  int8_t i_current_offset
+);
+
+
+
+//------------------------------------------------------------------------------------
+//Sorting long orders
+//------------------------------------------------------------------------------------
+/**
+ * Sorting functions for long nextified strings
+ * The current state of the art sorting function for nextified strings.
+ * Its implementation may change without warning.
+ */
+int TSODLULS_sort(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The current state of the art stable sorting function for nextified strings.
+ * Its implementation may change without warning.
+ */
+int TSODLULS_sort_stable(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Choose the algorithm with the lowest cost for these elements according to the cost model
+ * (see t_TSODLULS_sort_model).
+ * Returns I_SORT_ALGORITHM__INSERTION, I_SORT_ALGORITHM__COMPARISON or I_SORT_ALGORITHM__RADIX.
+ */
+int TSODLULS_choose_sort_algorithm(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Sort with the algorithm chosen by TSODLULS_choose_sort_algorithm().
+ * It is not stable since the comparison model uses quicksort.
+ */
+int TSODLULS_sort_with_model(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A stable insertion sort for a small number of elements
+ */
+int TSODLULS_sort_insertion(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Pattern-defeating quicksort (pdqsort of Orson Peters) inlined with long cells:
+ * the keys are compared with memcmp() and then their lengths, without function pointer.
+ * Sorted, reverse sorted and almost sorted cells are sorted in linear time,
+ * and the cells equal to a previous pivot are not partitioned again, hence few distinct keys are fast.
+ * Heapsort is used after too many bad partitions, hence O(n log n) in the worst case.
+ * It is not stable.
+ */
+int TSODLULS_pdqsort(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A radix sort with 64 bits digits: the next 8 bytes of the keys are loaded as big-endian uint64
+ * in a view of short cells (the bytes after the end of a key are 0), the view is sorted
+ * by TSODLULS_sort__short() and the cells are permuted accordingly.
+ * In a group of equal words, the keys ending in the word come first by increasing length
+ * (they are prefixes of the longer keys), and only the keys continuing after the word are sorted again.
+ * Hence long keys with long common prefixes use 8 times less rounds than with octets digits.
+ * The groups of at most I_SORT_MODEL__INSERTION_THRESHOLD cells are sorted by insertion sort.
+ * It is not stable.
+ */
+int TSODLULS_sort_radix64_short_view(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A hybrid sort: the first 8 bytes of the keys are packed in short cells pointing to the long cells
+ * (see TSODLULS_sort_radix64_short_view()), that are sorted by TSODLULS_sort_radix8_count_insertion__short()
+ * and moved 16 bytes at a time instead of 32, then the long cells are permuted once,
+ * and only the runs of equal prefixes are sorted by TSODLULS_sort_radix8_count_insertion() from the byte 8.
+ * It is fast when most keys differ within their first 8 bytes.
+ * It is not stable.
+ */
+int TSODLULS_sort_prefix8_hybrid(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A sort where the keys are built lazily: the keys contain the TSO-encoding of the first
+ * i_number_of_fields_in_keys fields of the objects, and after a sort, the cells with equal keys
+ * get the next field with p_key_extender->f_add_field() and are sorted again by this field,
+ * until their keys differ or all the fields are in their keys.
+ * With i_number_of_fields_in_keys == 0, the keys are empty (s_key may be NULL) and all the cells get the first field.
+ * Hence the encoding time is only spent on ties, when the first fields almost always decide the order.
+ * The encoding of each field must not be a prefix of another encoding of this field,
+ * like the encodings of TSODLULS_finite_orders.c, so that the order is the order of the full keys.
+ * The errors of TSODLULS_sort() and of f_add_field() are returned.
+ * It is not stable.
+ */
+int TSODLULS_sort_with_lazy_keys(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_fields_in_keys,
+  const t_TSODLULS_key_extender* p_key_extender
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Initialize an order-preserving dictionary with the distinct keys of the cells:
+ * the keys are sorted once and each distinct key gets its rank as an uint64.
+ * The keys are copied in the dictionary, hence the cells can be freed or reused afterwards,
+ * and the dictionary can be used for all the sorts of cells whose keys are in it
+ * (see TSODLULS_sort_with_key_dictionary()). Free it with TSODLULS_key_dictionary_free().
+ */
+int TSODLULS_key_dictionary_init(
+  t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Free the keys and the hash table of a dictionary of keys
+ */
+void TSODLULS_key_dictionary_free(t_TSODLULS_key_dictionary* p_dictionary);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Find the rank of the key of a cell in a dictionary of keys
+ * Returns I_ERROR__KEY_NOT_IN_DICTIONARY if the key was not in the cells of TSODLULS_key_dictionary_init().
+ */
+int TSODLULS_key_dictionary_get_rank(
+  const t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* p_sort_element,
+  uint64_t* p_i_rank
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Rewrite long cells as short cells whose keys are the ranks of the long keys in a dictionary of keys:
+ * arr_elements__short[i] has the object of arr_elements[i] and the short key of its key,
+ * so that the short cells are in the same order as the long cells.
+ * Returns I_ERROR__KEY_NOT_IN_DICTIONARY if a key is not in the dictionary.
+ */
+int TSODLULS_key_dictionary_fill_short_cells(
+  const t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  t_TSODLULS_sort_element__short* arr_elements__short
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Sort long cells with few distinct keys as short cells: the cells are rewritten in arr_elements__short
+ * with the ranks of their keys in the dictionary (see TSODLULS_key_dictionary_fill_short_cells()),
+ * and sorted with TSODLULS_sort__short() on the i_max_length bytes of the ranks.
+ * The objects are sorted in arr_elements__short, arr_elements is not modified.
+ * It is not stable.
+ */
+int TSODLULS_sort_with_key_dictionary(
+  const t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  t_TSODLULS_sort_element__short* arr_elements__short
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A stable sorting algorithm for nextified strings based on radix sort with octets digits
+ * and counting sort as a subroutine.
+ */
+int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A stable sorting algorithm for nextified strings based on radix sort with octets digits
+ * and counting sort as a subroutine.
+ * When the number of elements to sort is at most: 5 for initial sort or 2 for radix sequel, we use insertion sort
+ */
+int TSODLULS_sort_radix8_count_insertion(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Sort independently the segments of the array: the segment i is made of the cells from
+ * arr_segment_offsets[i] included to arr_segment_offsets[i + 1] excluded,
+ * arr_segment_offsets has i_number_of_segments + 1 non-decreasing offsets.
+ * The buffers of the radix sort are allocated once for all the segments,
+ * and small segments are sorted by insertion sort.
+ * It is not stable.
+ */
+int TSODLULS_sort_segmented(
+  t_TSODLULS_sort_element* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Same as TSODLULS_sort_segmented() with the segments spread across i_number_of_threads threads
+ * (including the calling thread), each thread sorting consecutive segments with its own buffers.
+ * If a thread cannot be created, its segments are sorted by the calling thread.
+ */
+int TSODLULS_sort_segmented_parallel(
+  t_TSODLULS_sort_element* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments,
+  size_t i_number_of_threads
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * In-place super scalar samplesort (IPS4o of Axtmann, Witt, Ferizovic and Sanders):
+ * the cells are classified with a search tree of up to 127 splitters chosen in a random sample,
+ * compared with TSODLULS_compare_nextified_keys_in_cells(), and distributed in blocks of I_SAMPLESORT_BLOCK_SIZE cells.
+ * A splitter that is a frequent key gets its own equality bucket, that is not sorted again,
+ * hence skewed and low entropy keys are fast.
+ * The memory used does not depend on the number of elements (about 512 KiB of buffers, the keys are not moved).
+ * The buckets are sorted recursively and the partitions of at most I_SAMPLESORT_BASE_CASE_SIZE cells
+ * are sorted by TSODLULS_pdqsort().
+ * It is not stable.
+ */
+int TSODLULS_sort_samplesort(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Same as TSODLULS_sort_samplesort() with i_number_of_threads threads (including the calling thread):
+ * the classification and the permutation of the blocks are done by all the threads,
+ * the buckets of more than 1/i_number_of_threads of the cells are sorted with all the threads,
+ * and the other buckets are shared by the threads, each one sorting the next bucket with its own buffers.
+ * If a thread cannot be created, its work is done by the calling thread.
+ */
+int TSODLULS_sort_samplesort_parallel(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_threads
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A parallel sort for NUMA machines with i_number_of_threads threads, the calling thread only waits:
+ * the threads are spread round-robin on the NUMA nodes and pinned to the CPUs of their node,
+ * the cells are distributed by the first 2 bytes of their keys in contiguous ranges of buckets,
+ * one per thread, in buffers allocated and first touched by the thread on its node
+ * (and bound to the node with mbind() when the machine has several nodes, or interleaved on all the nodes
+ * when the thread could not be pinned),
+ * then each thread sorts its partition with TSODLULS_sort_radix8_count_insertion() in node-local buffers
+ * and copies it in arr_elements.
+ * The topology is read in /sys/devices/system/node, a machine without it is a single node,
+ * and the threads that cannot be pinned or created still work (the latter by the calling thread).
+ * If p_numa_stats is not NULL, it is filled with the nodes used and the traffic between nodes
+ * (the writes of the threads that could not be pinned are counted as remote).
+ * The partitions are balanced only when the first 2 bytes of the keys are spread.
+ * It is not stable.
+ */
+int TSODLULS_sort_parallel_numa(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_threads,
+  t_TSODLULS_numa_stats* p_numa_stats
+);
+
+
+
+//------------------------------------------------------------------------------------
+//Sorting short orders
+//------------------------------------------------------------------------------------
+/**
+ * Sorting functions for short nextified strings
+ * The current state of the art sorting function for nextified strings.
+ * Its implementation may change without warning.
+ */
+int TSODLULS_sort__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * The current state of the art stable sorting function for nextified strings.
+ * Its implementation may change without warning.
+ */
+int TSODLULS_sort_stable__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Choose the algorithm with the lowest cost for these elements according to the cost model
+ * (see t_TSODLULS_sort_model).
+ * Returns I_SORT_ALGORITHM__INSERTION, I_SORT_ALGORITHM__COMPARISON or I_SORT_ALGORITHM__RADIX.
+ */
+int TSODLULS_choose_sort_algorithm__short(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Sort with the algorithm chosen by TSODLULS_choose_sort_algorithm__short().
+ * It is not stable since the comparison model uses quicksort.
+ */
+int TSODLULS_sort_with_model__short(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * A stable insertion sort for a small number of elements
+ */
+int TSODLULS_sort_insertion__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * A stable sorting algorithm for nextified strings based on radix sort with octets digits
+ * and counting sort as a subroutine.
+ */
+int TSODLULS_sort_radix8_count__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Qsort from glibc inlined with short cells.
+ */
+int TSODLULS_qsort_inlined__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Qsort from glibc inlined with short cells.
+ * Partitions of at most i_threshold + 1 elements are left to the final insertion sort
+ * (MAX_THRESH in glibc, see I_QSORT_INSERTION_THRESHOLD__SHORT).
+ */
+int TSODLULS_qsort_inlined__short_with_threshold(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_threshold
+);
+
+
+/**
+ * Sorting functions for short nextified strings
+ * The best instruction set for the partitions of TSODLULS_qsort_vectorized__short()
+ * that is both compiled in the library and supported by the CPU.
+ */
+int TSODLULS_get_best_instruction_set();
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Quicksort with branchless partitions, vectorized with the best instruction set of the CPU
+ * (see TSODLULS_get_best_instruction_set()).
+ * Partitions of at most I_SORT_NETWORK_MAX_SIZE__SHORT elements are sorted by sorting networks.
+ * It is not stable.
+ */
+int TSODLULS_qsort_vectorized__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_qsort_vectorized__short() with the given instruction set,
+ * it is lowered to TSODLULS_get_best_instruction_set() when the CPU does not support it.
+ * The pivot is the median of 3 keys (of 3 medians of 3 keys for more than 128 elements).
+ * The cells with a key smaller than the pivot go left. When there is none, the pivot is the smallest key
+ * and the cells with a key equal to the pivot are moved left by a second partition, they are then sorted.
+ */
+int TSODLULS_qsort_vectorized__short_with_instruction_set(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  int i_instruction_set
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * A stable sorting algorithm for nextified strings based on radix sort with octets digits
+ * and counting sort as a subroutine.
+ * When the number of elements to sort is at most 5, we use insertion sort
+ * A variant with single memory allocation adapted to the max-depth.
+ * No insertion sort if there is more than 5 elements and it is 8 bits datatype.
+ * This is the current best algorithm and it is a stable one :)
+ * (5 is the default value of I_RADIX_INSERTION_THRESHOLD__SHORT.)
+ */
+int TSODLULS_sort_radix8_count_insertion__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_radix8_count_insertion__short() but the buckets of at most
+ * i_threshold elements are left to the final insertion sort.
+ */
+int TSODLULS_sort_radix8_count_insertion__short_with_threshold(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  size_t i_threshold
+);
+
+
 /**
- * Adding TSO-encoding to the current key
- * From uint64
- * Available as a macraff (see TSODLULS_finite_orders__macro.h).
+ * Sorting functions for short nextified strings
+ * Branchless sorting network (compare-exchanges with conditional moves)
+ * for at most I_SORT_NETWORK_MAX_SIZE__SHORT elements.
+ * It is not stable.
  */
-int TSODLULS_add_bytes_to_key_from_uint64(
-  t_TSODLULS_sort_element* p_sort_element,
-  uint64_t i64,
-  int8_t i_number_of_lex_padding_bytes_before,
-  int8_t i_number_of_contrelex_padding_bytes_before,
-  int8_t i_number_of_lex_padding_bytes_after,
-  int8_t i_number_of_contrelex_padding_bytes_after,
-  int8_t i_number_of_contiguous_data_bytes,
-  int8_t i_current_offset
+int TSODLULS_sort_network__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
 );
 
 
 
-//------------------------------------------------------------------------------------
-//Sorting long orders
-//------------------------------------------------------------------------------------
 /**
- * Sorting functions for long nextified strings
- * The current state of the art sorting function for nextified strings.
- * Its implementation may change without warning.
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_radix8_count_insertion__short() but the buckets of at most
+ * I_RADIX_NETWORK_THRESHOLD__SHORT elements are sorted by sorting networks
+ * as soon as they are found, there is no final insertion sort.
+ * It is not stable.
  */
-int TSODLULS_sort(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+int TSODLULS_sort_radix8_count_network__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
 
 
 
 /**
- * Sorting functions for long nextified strings
- * The current state of the art stable sorting function for nextified strings.
- * Its implementation may change without warning.
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_radix8_count_network__short() with the given threshold,
+ * it is clamped to I_SORT_NETWORK_MAX_SIZE__SHORT.
  */
-int TSODLULS_sort_stable(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+int TSODLULS_sort_radix8_count_network__short_with_threshold(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  size_t i_threshold
+);
 
 
 
 /**
- * Sorting functions for long nextified strings
- * A stable sorting algorithm for nextified strings based on radix sort with octets digits
- * and counting sort as a subroutine.
+ * Sorting functions for short nextified strings
+ * Sort independently the segments of the array: the segment i is made of the cells from
+ * arr_segment_offsets[i] included to arr_segment_offsets[i + 1] excluded,
+ * arr_segment_offsets has i_number_of_segments + 1 non-decreasing offsets.
+ * The buffers of the radix sort are allocated once for all the segments,
+ * the segments of at most I_SORT_NETWORK_MAX_SIZE__SHORT elements and the small buckets
+ * are sorted by sorting networks.
+ * It is not stable.
  */
-int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+int TSODLULS_sort_segmented__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments,
+  uint8_t i_max_length
+);
 
 
 
 /**
- * Sorting functions for long nextified strings
- * A stable sorting algorithm for nextified strings based on radix sort with octets digits
- * and counting sort as a subroutine.
- * When the number of elements to sort is at most: 5 for initial sort or 2 for radix sequel, we use insertion sort
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_segmented__short() with the segments spread across i_number_of_threads threads
+ * (including the calling thread), each thread sorting consecutive segments with its own buffers.
+ * If a thread cannot be created, its segments are sorted by the calling thread.
  */
-int TSODLULS_sort_radix8_count_insertion(
-  t_TSODLULS_sort_element* arr_elements,
-  size_t i_number_of_elements
+int TSODLULS_sort_segmented_parallel__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments,
+  uint8_t i_max_length,
+  size_t i_number_of_threads
 );
 
 
 
-//------------------------------------------------------------------------------------
-//Sorting short orders
-//------------------------------------------------------------------------------------
 /**
  * Sorting functions for short nextified strings
- * The current state of the art sorting function for nextified strings.
- * Its implementation may change without warning.
+ * In-place super scalar samplesort (IPS4o of Axtmann, Witt, Ferizovic and Sanders):
+ * the cells are classified with a branchless search tree of up to 127 splitters
+ * chosen in a random sample, and distributed in blocks of I_SAMPLESORT_BLOCK_SIZE__SHORT cells.
+ * A splitter that is a frequent key gets its own equality bucket, that is not sorted again,
+ * hence skewed and low entropy keys are fast.
+ * The memory used does not depend on the number of elements (about 512 KiB of buffers).
+ * The buckets are sorted recursively and the partitions of at most I_SAMPLESORT_BASE_CASE_SIZE cells
+ * are sorted by TSODLULS_qsort_vectorized__short().
+ * It is not stable.
  */
-int TSODLULS_sort__short(
+int TSODLULS_sort_samplesort__short(
   t_TSODLULS_sort_element__short* arr_elements,
-  size_t i_number_of_elements,
-  uint8_t i_max_length
+  size_t i_number_of_elements
 );
 
 
 
 /**
  * Sorting functions for short nextified strings
- * The current state of the art stable sorting function for nextified strings.
- * Its implementation may change without warning.
+ * Same as TSODLULS_sort_samplesort__short() with i_number_of_threads threads (including the calling thread):
+ * the classification and the permutation of the blocks are done by all the threads,
+ * the buckets of more than 1/i_number_of_threads of the cells are sorted with all the threads,
+ * and the other buckets are shared by the threads, each one sorting the next bucket with its own buffers.
+ * If a thread cannot be created, its work is done by the calling thread.
  */
-int TSODLULS_sort_stable__short(
+int TSODLULS_sort_samplesort_parallel__short(
   t_TSODLULS_sort_element__short* arr_elements,
   size_t i_number_of_elements,
-  uint8_t i_max_length
+  size_t i_number_of_threads
 );
 
 
 
 /**
  * Sorting functions for short nextified strings
- * A stable sorting algorithm for nextified strings based on radix sort with octets digits
- * and counting sort as a subroutine.
+ * Begin a time-sliced sort of the cells, that is done by the following calls of TSODLULS_sort_step__short()
+ * with bounded pause times, and without threads, so that a big sort can be interleaved with other work.
+ * It is stable on its own terms: its counting passes keep the order of the cells
+ * and its small buckets are sorted by the stable TSODLULS_sort_insertion__short().
+ * The cells must not be modified until the sort is finished,
+ * and TSODLULS_sort_step_free__short() must be called at the end or to abandon the sort.
  */
-int TSODLULS_sort_radix8_count__short(
+int TSODLULS_sort_step_begin__short(
+  t_TSODLULS_sort_step_context__short* p_context,
   t_TSODLULS_sort_element__short* arr_elements,
   size_t i_number_of_elements,
   uint8_t i_max_length
@@ -401,29 +1658,25 @@ int TSODLULS_sort_radix8_count__short(
 
 /**
  * Sorting functions for short nextified strings
- * Qsort from glibc inlined with short cells.
+ * Continue a time-sliced sort begun by TSODLULS_sort_step_begin__short() for about i_max_elements cells
+ * processed (counted, moved or copied) or i_max_microseconds, the first reached, 0 meaning no limit.
+ * The budget is checked every I_SORT_STEP_CHUNK_SIZE__SHORT cells, and each call makes some progress.
+ * *p_b_finished is set to 1 when the cells are sorted, the buffers are freed then.
  */
-int TSODLULS_qsort_inlined__short(
-  t_TSODLULS_sort_element__short* arr_elements,
-  size_t i_number_of_elements
+int TSODLULS_sort_step__short(
+  t_TSODLULS_sort_step_context__short* p_context,
+  size_t i_max_elements,
+  uint64_t i_max_microseconds,
+  unsigned int* p_b_finished
 );
 
 
 
 /**
  * Sorting functions for short nextified strings
- * A stable sorting algorithm for nextified strings based on radix sort with octets digits
- * and counting sort as a subroutine.
- * When the number of elements to sort is at most 5, we use insertion sort
- * A variant with single memory allocation adapted to the max-depth.
- * No insertion sort if there is more than 5 elements and it is 8 bits datatype.
- * This is the current best algorithm and it is a stable one :)
+ * Free the buffers of a time-sliced sort, finished or not.
  */
-int TSODLULS_sort_radix8_count_insertion__short(
-  t_TSODLULS_sort_element__short* arr_elements,
-  size_t i_number_of_elements,
-  uint8_t i_max_length
-);
+void TSODLULS_sort_step_free__short(t_TSODLULS_sort_step_context__short* p_context);
 
 
 
@@ -549,6 +1802,29 @@ int TSODLULS_compare_nextified_key_in_cell(const void *a, const void *b);
 
 
 
+/**
+ * Comparison function
+ * Compare the nextified keys of two TSODLULS cells, starting at the byte i_offset
+ * (the bytes before are assumed equal), 8 bytes at a time.
+ * When one key is a prefix of the other, the shorter key is smaller.
+ * Available as a macraff (see TSODLULS_comparison__macro.h).
+ */
+int TSODLULS_compare_nextified_keys_in_cells(
+  const t_TSODLULS_sort_element* p_cell1,
+  const t_TSODLULS_sort_element* p_cell2,
+  size_t i_offset
+);
+
+
+
+/**
+ * Comparison function
+ * nextified key in TSODLULS cell, 8 bytes at a time, the shorter key is smaller when one key is a prefix of the other
+ */
+int TSODLULS_compare_nextified_key_in_cell_by_words(const void *a, const void *b);
+
+
+
 /**
  * Comparison function
  * nextified key in TSODLULS cell for short orders
@@ -572,6 +1848,7 @@ void TSODLULS_init_element(t_TSODLULS_sort_element* p_element);
 /**
  * Miscellaneous functions
  * Free the key of a TSODLULS element (if necessary) and reinitializes the corresponding fields
+ * The keys in a key arena (I_KEY_ARENA_FLAG in i_allocated_size) are not freed, they belong to the arena.
  * Available as a macraff (see TSODLULS_misc__macro.h).
  */
 void TSODLULS_free_key(t_TSODLULS_sort_element* p_element);
@@ -599,6 +1876,8 @@ void TSODLULS_free_keys_in_array_of_elements(t_TSODLULS_sort_element* arr_elemen
 /**
  * Miscellaneous functions
  * (Re)Allocate space for the key of a TSODLULS element
+ * A key that is not owned by the element (in a key arena, or i_allocated_size is 0)
+ * is copied in a new heap allocated key when it must grow, it is never reallocated.
  * Available as a macraff (see TSODLULS_misc__macro.h).
  */
 int TSODLULS_element_allocate_space_for_key(
@@ -629,6 +1908,117 @@ int TSODLULS_init_array_of_elements__short(
 
 
 
+/**
+ * Miscellaneous functions
+ * Initialize a key arena
+ * No memory is allocated until the first key is placed in the arena.
+ * If i_slab_size is 0, I_KEY_ARENA_DEFAULT_SLAB_SIZE is used.
+ */
+void TSODLULS_key_arena_init(t_TSODLULS_key_arena* p_arena, size_t i_slab_size);
+
+
+
+/**
+ * Miscellaneous functions
+ * Allocate space in a key arena (bump allocation)
+ * A new slab is allocated only when the last one is full.
+ * A request bigger than the slab size gets a slab of its own.
+ */
+int TSODLULS_key_arena_allocate(
+  t_TSODLULS_key_arena* p_arena,
+  size_t i_size_needed,
+  uint8_t** p_s_space
+);
+
+
+
+/**
+ * Miscellaneous functions
+ * Reserve space in a key arena for the key of a TSODLULS element
+ * Use it when the size of the key is known up front (or an upper bound is known):
+ * the add_bytes functions then write directly in the arena without any allocation,
+ * as long as the reserved size is not exceeded.
+ * A key that grows past the reserved size is copied in a heap allocated key,
+ * that TSODLULS_free_key() frees (I_KEY_ARENA_FLAG marks the keys still in the arena).
+ * The element must not own a heap allocated key.
+ */
+int TSODLULS_key_arena_reserve_key(
+  t_TSODLULS_key_arena* p_arena,
+  t_TSODLULS_sort_element* p_sort_element,
+  size_t i_key_size
+);
+
+
+
+/**
+ * Miscellaneous functions
+ * Copy a key built in a TSODLULS element (the builder) into a key arena
+ * Use it when the size of the key is only estimated:
+ * the key is built with the add_bytes functions in the builder,
+ * whose buffer is reused from one key to the next and grows only a few times,
+ * then it is copied in the arena and the builder is reset (its buffer is kept).
+ * The target element must not own a heap allocated key.
+ */
+int TSODLULS_key_arena_commit_key(
+  t_TSODLULS_key_arena* p_arena,
+  t_TSODLULS_sort_element* p_builder,
+  t_TSODLULS_sort_element* p_sort_element
+);
+
+
+
+/**
+ * Miscellaneous functions
+ * Initialize an array of TSODLULS elements with keys reserved in a key arena
+ * i_key_size is the size reserved for each key (see TSODLULS_key_arena_reserve_key()).
+ * If the slab size of the arena is smaller than the space needed, a single slab is allocated for all keys.
+ */
+int TSODLULS_key_arena_init_array_of_elements(
+  t_TSODLULS_key_arena* p_arena,
+  t_TSODLULS_sort_element** p_arr_elements,
+  size_t i_number_of_elements,
+  size_t i_key_size
+);
+
+
+
+/**
+ * Miscellaneous functions
+ * Free all the slabs of a key arena at once
+ * The keys of the elements still in the arena are skipped by TSODLULS_free_key(),
+ * hence the keys that grew out of the arena can be freed before or after.
+ */
+void TSODLULS_key_arena_free(t_TSODLULS_key_arena* p_arena);
+
+
+
+/**
+ * Miscellaneous functions
+ * Initialize a cost model for the sort dispatchers with the default values
+ * (see I_SORT_MODEL__SAMPLE_SIZE and the following constants)
+ */
+void TSODLULS_sort_model_init(t_TSODLULS_sort_model* p_model);
+
+
+
+/**
+ * Miscellaneous functions
+ * Set all the counters of the stats to 0
+ */
+void TSODLULS_sort_stats_init(t_TSODLULS_sort_stats* p_stats);
+
+
+
+/**
+ * Miscellaneous functions
+ * Attach the stats to the current thread, the following sort calls of this thread add their counters to it
+ * (see t_TSODLULS_sort_stats). NULL detaches the current stats.
+ * Returns I_ERROR__SORT_STATS_NOT_COMPILED if the library was compiled without -DTSODLULS_STATS.
+ */
+int TSODLULS_sort_stats_attach(t_TSODLULS_sort_stats* p_stats);
+
+
+
 //------------------------------------------------------------------------------------
 //Padding
 //------------------------------------------------------------------------------------
@@ -719,6 +2109,200 @@ uint8_t TSODLULS_add_bits_with_bit_level_offset(
 
 
 
+/**
+ * Padding functions
+ * Initialize a padding plan
+ * The padding parameters are checked once and the layouts of the bytes added to a key
+ * are precomputed for uint8, uint16, uint32 and uint64, and for each current offset.
+ * See TSODLULS_add_bytes_to_key_from_uint8_with_padding_plan() and the following functions.
+ */
+int TSODLULS_padding_plan_init(
+  t_TSODLULS_padding_plan* p_plan,
+  int8_t i_number_of_lex_padding_bytes_before,
+  int8_t i_number_of_contrelex_padding_bytes_before,
+  int8_t i_number_of_lex_padding_bytes_after,
+  int8_t i_number_of_contrelex_padding_bytes_after,
+  int8_t i_number_of_contiguous_data_bytes
+);
+
+
+
+/**
+ * Padding functions
+ * Free the layouts of a padding plan
+ */
+void TSODLULS_padding_plan_free(t_TSODLULS_padding_plan* p_plan);
+
+
+
+//------------------------------------------------------------------------------------
+//TSODL parsing, code generation and compilation
+//------------------------------------------------------------------------------------
+/**
+ * TSODL functions
+ * Parse a TSOD (Tree Structured Order Definition) written in TSODL for C
+ * Supported subset: NEXT(...) (nested, with optional trailing comma), comments,
+ * fields "[*]CURRENT(.field|->field)* TYPE [RANGE(min, max)] [ASC|DESC]" with TYPE among
+ * UINT8, UINT16, UINT32, UINT64, INT8, INT16, INT32, INT64, INT (32 bits), SIZE_T (64 bits), FLOAT, DOUBLE,
+ * CHAR(n), VARCHAR(NULL), VARCHAR(NULL(k)), VARCHAR(CURRENT->length INTEGER_TYPE),
+ * and LEXICOGRAPHIC(field) on a CHAR or VARCHAR field: the characters are the subelements,
+ * DESC applies to them and a prefix still comes first (with the same padding as the field).
+ * The other infinite arity order-operators, iterators and collations return I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT.
+ * On error, p_order->i_error_offset is the offset of the error in s_tsod.
+ * The order must be freed with TSODLULS_tsodl_free_order(), even on error.
+ */
+int TSODLULS_tsodl_parse(t_TSODLULS_tsodl_order* p_order, const char* s_tsod);
+
+
+
+/**
+ * TSODL functions
+ * Free a parsed TSOD
+ */
+void TSODLULS_tsodl_free_order(t_TSODLULS_tsodl_order* p_order);
+
+
+
+/**
+ * TSODL functions
+ * Write the C code of the nextification functions of a parsed TSOD
+ * s_current_type is the C type of the items of the array to sort (CURRENT in the TSOD).
+ * The following functions are generated:
+ *  - int s_function_name(t_TSODLULS_sort_element* p_sort_element, s_current_type* p_current);
+ *    appends the key of *p_current to the key of the cell, with one allocation of the exact size,
+ *  - int s_function_name__fill_cells(t_TSODLULS_sort_element* arr_elements, s_current_type* arr_objects, size_t i_number_of_elements);
+ *  - if the key has a fixed size of at most 8 bytes, the same two functions for short cells,
+ *    with the suffix __short, and a constant s_function_name__KEY_SIZE.
+ * The padding is chosen at generation time: fixed size fields need none,
+ * and strings use the cheapest end marker allowed by their type.
+ * The generated code must be compiled after TSODLULS.h and the definition of s_current_type.
+ */
+int TSODLULS_tsodl_generate_c_code(
+  FILE* p_file,
+  const t_TSODLULS_tsodl_order* p_order,
+  const char* s_function_name,
+  const char* s_current_type
+);
+
+
+
+/**
+ * TSODL functions
+ * Compile a TSOD (see TSODLULS_tsodl_parse()) for the runtime nextification of arrays of objects
+ * CURRENT is an item of the array, its members are given by arr_members.
+ * Unknown members give I_ERROR__TSODL_UNKNOWN_MEMBER.
+ * The program must be freed with TSODLULS_tsodl_free_program(), even on error.
+ */
+int TSODLULS_tsodl_compile(
+  t_TSODLULS_tsodl_program* p_program,
+  const char* s_tsod,
+  const t_TSODLULS_tsodl_member* arr_members,
+  size_t i_number_of_members
+);
+
+
+
+/**
+ * TSODL functions
+ * Free a compiled TSOD
+ */
+void TSODLULS_tsodl_free_program(t_TSODLULS_tsodl_program* p_program);
+
+
+
+/**
+ * TSODL functions
+ * Fill the cells with the objects of the array and their keys computed by a compiled TSOD
+ * The keys are the same as with the functions generated by TSODLULS_tsodl_generate_c_code().
+ * The key of each cell is replaced and allocated once with its exact size.
+ */
+int TSODLULS_tsodl_fill_cells(
+  const t_TSODLULS_tsodl_program* p_program,
+  t_TSODLULS_sort_element* arr_elements,
+  void* arr_objects,
+  size_t i_object_size,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * TSODL functions
+ * Same as TSODLULS_tsodl_fill_cells() for short cells
+ * The key must have a fixed size of at most 8 bytes (see p_program->i_fixed_key_size),
+ * otherwise I_ERROR__TSODL_KEY_TOO_LONG_FOR_SHORT_CELLS is returned.
+ */
+int TSODLULS_tsodl_fill_cells__short(
+  const t_TSODLULS_tsodl_program* p_program,
+  t_TSODLULS_sort_element__short* arr_elements,
+  void* arr_objects,
+  size_t i_object_size,
+  size_t i_number_of_elements
+);
+
+
+
+//------------------------------------------------------------------------------------
+//Sort engines
+//------------------------------------------------------------------------------------
+/**
+ * Sort engines functions
+ * Returns the number of sort engines: the engines of this library, then the registered engines
+ */
+size_t TSODLULS_get_number_of_sort_engines();
+
+
+
+/**
+ * Sort engines functions
+ * Returns the sort engine at this index (see TSODLULS_get_number_of_sort_engines()), or NULL
+ */
+const t_TSODLULS_sort_engine* TSODLULS_get_sort_engine(size_t i_index);
+
+
+
+/**
+ * Sort engines functions
+ * Returns the sort engine with this name, or NULL
+ */
+const t_TSODLULS_sort_engine* TSODLULS_find_sort_engine(const char* s_name);
+
+
+
+/**
+ * Sort engines functions
+ * Add a sort engine to the registry, the engine is copied but not its name.
+ * Returns I_ERROR__SORT_ENGINE_NAME_ALREADY_USED if an engine with the same name exists.
+ * The registry is not thread safe: register the engines before the threads start sorting.
+ */
+int TSODLULS_register_sort_engine(const t_TSODLULS_sort_engine* p_engine);
+
+
+
+/**
+ * Sort engines functions
+ * Free the memory used by the registered engines, the engines of this library remain.
+ */
+void TSODLULS_free_registered_sort_engines();
+
+
+
+/**
+ * Sort engines functions
+ * Sort with the engine of this name,
+ * arr_elements is an array of t_TSODLULS_sort_element or t_TSODLULS_sort_element__short
+ * depending on the cell type of the engine (see t_TSODLULS_sort_engine).
+ * Returns I_ERROR__UNKNOWN_SORT_ENGINE if there is no engine with this name.
+ */
+int TSODLULS_sort_with_engine(
+  const char* s_name,
+  void* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
 #include "TSODLULS__macro.h"
 
 #endif
@@ -54,7 +54,7 @@ If the return type is void but auxiliary variables need to be declared,
  we still classify the macro with the macraffs, because of the affectations of the parameters.
 */
 
-//#include "TSODLULS_comparison__macro.h"
+#include "TSODLULS_comparison__macro.h"
 #include "TSODLULS_finite_orders__macro.h"
 #include "TSODLULS_misc__macro.h"
 #include "TSODLULS_padding__macro.h"
@@ -71,6 +71,7 @@ The macraffs in this library use the following auxiliary variables:
   uint16_t TSODLULS_macraff_ui16;
   uint32_t TSODLULS_macraff_ui32;
   uint64_t TSODLULS_macraff_ui64;
+  uint64_t TSODLULS_macraff_ui64_2;
   int8_t TSODLULS_macraff_i8;
   int8_t TSODLULS_macraff_i8_2;
   int8_t TSODLULS_macraff_i8_3;
@@ -307,6 +307,45 @@ int TSODLULS_compare_nextified_key_in_cell(const void *a, const void *b){
 
 
 
+/**
+ * Comparison function
+ * Compare the nextified keys of two TSODLULS cells, starting at the byte i_offset
+ * (the bytes before are assumed equal), 8 bytes at a time.
+ * When one key is a prefix of the other, the shorter key is smaller.
+ * Available as a macraff (see TSODLULS_comparison__macro.h).
+ */
+int TSODLULS_compare_nextified_keys_in_cells(
+  const t_TSODLULS_sort_element* p_cell1,
+  const t_TSODLULS_sort_element* p_cell2,
+  size_t i_offset
+){
+  int i_result;
+  uint64_t TSODLULS_macraff_ui64;
+  uint64_t TSODLULS_macraff_ui64_2;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+  TSODLULS_compare_nextified_keys_in_cells__macraff(i_result, p_cell1, p_cell2, i_offset);
+  return i_result;
+}//end function TSODLULS_compare_nextified_keys_in_cells()
+
+
+
+/**
+ * Comparison function
+ * nextified key in TSODLULS cell, 8 bytes at a time, the shorter key is smaller when one key is a prefix of the other
+ */
+int TSODLULS_compare_nextified_key_in_cell_by_words(const void *a, const void *b){
+  return TSODLULS_compare_nextified_keys_in_cells(
+    (const t_TSODLULS_sort_element *) a,
+    (const t_TSODLULS_sort_element *) b,
+    0
+  );
+}//end function TSODLULS_compare_nextified_key_in_cell_by_words()
+
+
+
 /**
  * Comparison function
  * nextified key in TSODLULS cell for short orders
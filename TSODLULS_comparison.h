@@ -139,6 +139,29 @@ int TSODLULS_compare_nextified_key_in_cell(const void *a, const void *b);
 
 
 
+/**
+ * Comparison function
+ * Compare the nextified keys of two TSODLULS cells, starting at the byte i_offset
+ * (the bytes before are assumed equal), 8 bytes at a time.
+ * When one key is a prefix of the other, the shorter key is smaller.
+ * Available as a macraff (see TSODLULS_comparison__macro.h).
+ */
+int TSODLULS_compare_nextified_keys_in_cells(
+  const t_TSODLULS_sort_element* p_cell1,
+  const t_TSODLULS_sort_element* p_cell2,
+  size_t i_offset
+);
+
+
+
+/**
+ * Comparison function
+ * nextified key in TSODLULS cell, 8 bytes at a time, the shorter key is smaller when one key is a prefix of the other
+ */
+int TSODLULS_compare_nextified_key_in_cell_by_words(const void *a, const void *b);
+
+
+
 /**
  * Comparison function
  * nextified key in TSODLULS cell for short orders
@@ -0,0 +1,80 @@
+/*
+This file is part of TSODLULS library.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+/*
+This file contains macraffs corresponding to the functions in TSODLULS_comparison.c.
+It is more pleasant to look at the source code there than to read the macros and macraffs here.
+The macraffs in this file use the following auxiliary variables:
+  uint64_t TSODLULS_macraff_ui64;
+  uint64_t TSODLULS_macraff_ui64_2;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+*/
+
+
+
+//------------------------------------------------------------------------------------
+//External macros
+//------------------------------------------------------------------------------------
+/**
+ * Comparison function
+ * Compare the nextified keys of two TSODLULS cells, starting at the byte i_offset
+ * (the bytes before are assumed equal), 8 bytes at a time.
+ * When one key is a prefix of the other, the shorter key is smaller.
+ * This macraff requires the following auxiliary variables:
+ *   uint64_t TSODLULS_macraff_ui64;
+ *   uint64_t TSODLULS_macraff_ui64_2;
+ *   size_t TSODLULS_macraff_isize;
+ *   size_t TSODLULS_macraff_isize_2;
+ *   t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+ *   t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+ */
+#define TSODLULS_compare_nextified_keys_in_cells__macraff(i_aff, p_cell1, p_cell2, i_offset) \
+do{\
+  TSODLULS_macraff_p_sort_element = (t_TSODLULS_sort_element*)(p_cell1);\
+  TSODLULS_macraff_p_sort_element_2 = (t_TSODLULS_sort_element*)(p_cell2);\
+  TSODLULS_macraff_isize = (i_offset);\
+  TSODLULS_macraff_isize_2 = TSODLULS_macraff_p_sort_element->i_key_size;\
+  if(TSODLULS_macraff_p_sort_element_2->i_key_size < TSODLULS_macraff_isize_2){\
+    TSODLULS_macraff_isize_2 = TSODLULS_macraff_p_sort_element_2->i_key_size;\
+  }\
+  (i_aff) = (TSODLULS_macraff_p_sort_element->i_key_size > TSODLULS_macraff_p_sort_element_2->i_key_size)\
+          - (TSODLULS_macraff_p_sort_element->i_key_size < TSODLULS_macraff_p_sort_element_2->i_key_size);\
+  for(; TSODLULS_macraff_isize + 8 <= TSODLULS_macraff_isize_2; TSODLULS_macraff_isize += 8){\
+    memcpy(&TSODLULS_macraff_ui64, TSODLULS_macraff_p_sort_element->s_key + TSODLULS_macraff_isize, 8);\
+    memcpy(&TSODLULS_macraff_ui64_2, TSODLULS_macraff_p_sort_element_2->s_key + TSODLULS_macraff_isize, 8);\
+    if(TSODLULS_macraff_ui64 != TSODLULS_macraff_ui64_2){\
+      TSODLULS_macraff_ui64 = be64toh(TSODLULS_macraff_ui64);\
+      TSODLULS_macraff_ui64_2 = be64toh(TSODLULS_macraff_ui64_2);\
+      (i_aff) = (TSODLULS_macraff_ui64 > TSODLULS_macraff_ui64_2) ? 1 : -1;\
+      TSODLULS_macraff_isize_2 = 0;\
+      break;\
+    }\
+  }\
+  for(; TSODLULS_macraff_isize < TSODLULS_macraff_isize_2; ++TSODLULS_macraff_isize){\
+    if(TSODLULS_macraff_p_sort_element->s_key[TSODLULS_macraff_isize]\
+      != TSODLULS_macraff_p_sort_element_2->s_key[TSODLULS_macraff_isize]\
+    ){\
+      (i_aff) = (TSODLULS_macraff_p_sort_element->s_key[TSODLULS_macraff_isize]\
+                > TSODLULS_macraff_p_sort_element_2->s_key[TSODLULS_macraff_isize]) ? 1 : -1;\
+      break;\
+    }\
+  }\
+}while(0);
@@ -873,3 +873,431 @@ int TSODLULS_add_bytes_to_key_from_uint64(
 
 
 
+/**
+ * Adding TSO-encoding to the current key
+ * Number of data bytes of the variable-length encoding of an uint64 (see TSODLULS_add_bytes_to_key_from_uint64_varint()):
+ * 1 for 0, 2 for 1 to 255, 3 for 256 to 65535, ..., 9 from 2^56.
+ * The current offset after the encoding is (i_current_offset + this size) % i_number_of_contiguous_data_bytes.
+ */
+int8_t TSODLULS_get_varint_size_from_uint64(uint64_t i64){
+  int8_t i_length = 0;
+  while(i_length < 8 && (i64 >> (8 * i_length)) != 0){
+    ++i_length;
+  }
+  return i_length + 1;
+}//end function TSODLULS_get_varint_size_from_uint64()
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * Number of data bytes of the variable-length encoding of an int64 (see TSODLULS_add_bytes_to_key_from_int64_varint()):
+ * 1 for -1 and 0, 2 for -256 to -2 and 1 to 255, ..., 9 below -2^56 and from 2^56.
+ */
+int8_t TSODLULS_get_varint_size_from_int64(int64_t i64){
+  if(i64 < 0){
+    return TSODLULS_get_varint_size_from_uint64(~((uint64_t)i64));
+  }
+  return TSODLULS_get_varint_size_from_uint64((uint64_t)i64);
+}//end function TSODLULS_get_varint_size_from_int64()
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint64 with a variable-length encoding:
+ * a first data byte with the number of significant bytes (0 to 8), and then the significant bytes (big-endian).
+ * The order is preserved and no encoding is a prefix of another one,
+ * hence the encoding can be followed by other data in a composite key,
+ * and values below 256 need 2 data bytes instead of 8.
+ * The padding parameters are applied to each data byte, like with TSODLULS_add_bytes_to_key_from_uint64(),
+ * and the number of data bytes is TSODLULS_get_varint_size_from_uint64(i64).
+ * Available as a macraff (see TSODLULS_finite_orders__macro.h).
+ */
+int TSODLULS_add_bytes_to_key_from_uint64_varint(
+  t_TSODLULS_sort_element* p_sort_element,
+  uint64_t i64,
+  int8_t i_number_of_lex_padding_bytes_before,
+  int8_t i_number_of_contrelex_padding_bytes_before,
+  int8_t i_number_of_lex_padding_bytes_after,
+  int8_t i_number_of_contrelex_padding_bytes_after,
+  int8_t i_number_of_contiguous_data_bytes,
+  int8_t i_current_offset
+){
+  size_t i_size_needed = 0;
+  int i_result = 0;
+  int8_t i_length = TSODLULS_get_varint_size_from_uint64(i64) - 1;
+
+  int8_t TSODLULS_macraff_i8;
+  int8_t TSODLULS_macraff_i8_2;
+  int8_t TSODLULS_macraff_i8_3;
+  int8_t TSODLULS_macraff_i8_4;
+  int8_t TSODLULS_macraff_i8_5;
+  int8_t TSODLULS_macraff_i8_6;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  size_t TSODLULS_macraff_isize_3;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  void* TSODLULS_macraff_p_void;
+
+  TSODLULS_check_padding_parameters__macraff(
+      i_result,
+      i_number_of_lex_padding_bytes_before,
+      i_number_of_contrelex_padding_bytes_before,
+      i_number_of_lex_padding_bytes_after,
+      i_number_of_contrelex_padding_bytes_after,
+      i_number_of_contiguous_data_bytes,
+      i_current_offset
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+
+  TSODLULS_compute_size_needed__macraff(
+      i_size_needed,
+      i_length + 1,
+      i_number_of_lex_padding_bytes_before,
+      i_number_of_contrelex_padding_bytes_before,
+      i_number_of_lex_padding_bytes_after,
+      i_number_of_contrelex_padding_bytes_after,
+      i_number_of_contiguous_data_bytes,
+      i_current_offset
+  );
+
+  TSODLULS_element_allocate_space_for_key__macraff(
+      i_result,
+      p_sort_element,
+      i_size_needed
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+
+  //the number of significant bytes, and then the significant bytes
+  for(int8_t i = 0; i <= i_length; ++i){
+    TSODLULS_padd__macraff(
+        p_sort_element,
+        i_number_of_lex_padding_bytes_before,
+        i_number_of_contrelex_padding_bytes_before,
+        i_current_offset
+    );
+
+    if(i == 0){
+      p_sort_element->s_key[p_sort_element->i_key_size++] = (uint8_t)i_length;
+    }
+    else{
+      p_sort_element->s_key[p_sort_element->i_key_size++] = (uint8_t)((i64 >> (8 * (i_length - i))) % 256);
+    }
+    i_current_offset = (i_current_offset + 1) % i_number_of_contiguous_data_bytes;
+
+    TSODLULS_padd__macraff(
+        p_sort_element,
+        i_number_of_lex_padding_bytes_after,
+        i_number_of_contrelex_padding_bytes_after,
+        i_current_offset
+    );
+  }
+  return 0;
+}//end function TSODLULS_add_bytes_to_key_from_uint64_varint()
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From int64 with a variable-length encoding:
+ * a first data byte 9 + the number of significant bytes (0 to 8) for non negative values,
+ * and 8 - the number of significant bytes of -1 - i64 for negative values,
+ * and then the significant bytes (big-endian) of i64.
+ * The order is preserved and no encoding is a prefix of another one,
+ * hence values from -256 to 255 need at most 2 data bytes instead of 8.
+ * The number of data bytes is TSODLULS_get_varint_size_from_int64(i64).
+ * Available as a macraff (see TSODLULS_finite_orders__macro.h).
+ */
+int TSODLULS_add_bytes_to_key_from_int64_varint(
+  t_TSODLULS_sort_element* p_sort_element,
+  int64_t i64,
+  int8_t i_number_of_lex_padding_bytes_before,
+  int8_t i_number_of_contrelex_padding_bytes_before,
+  int8_t i_number_of_lex_padding_bytes_after,
+  int8_t i_number_of_contrelex_padding_bytes_after,
+  int8_t i_number_of_contiguous_data_bytes,
+  int8_t i_current_offset
+){
+  size_t i_size_needed = 0;
+  int i_result = 0;
+  int8_t i_length = TSODLULS_get_varint_size_from_int64(i64) - 1;
+  uint8_t i_first_byte = (i64 < 0) ? (uint8_t)(8 - i_length) : (uint8_t)(9 + i_length);
+
+  int8_t TSODLULS_macraff_i8;
+  int8_t TSODLULS_macraff_i8_2;
+  int8_t TSODLULS_macraff_i8_3;
+  int8_t TSODLULS_macraff_i8_4;
+  int8_t TSODLULS_macraff_i8_5;
+  int8_t TSODLULS_macraff_i8_6;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  size_t TSODLULS_macraff_isize_3;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  void* TSODLULS_macraff_p_void;
+
+  TSODLULS_check_padding_parameters__macraff(
+      i_result,
+      i_number_of_lex_padding_bytes_before,
+      i_number_of_contrelex_padding_bytes_before,
+      i_number_of_lex_padding_bytes_after,
+      i_number_of_contrelex_padding_bytes_after,
+      i_number_of_contiguous_data_bytes,
+      i_current_offset
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+
+  TSODLULS_compute_size_needed__macraff(
+      i_size_needed,
+      i_length + 1,
+      i_number_of_lex_padding_bytes_before,
+      i_number_of_contrelex_padding_bytes_before,
+      i_number_of_lex_padding_bytes_after,
+      i_number_of_contrelex_padding_bytes_after,
+      i_number_of_contiguous_data_bytes,
+      i_current_offset
+  );
+
+  TSODLULS_element_allocate_space_for_key__macraff(
+      i_result,
+      p_sort_element,
+      i_size_needed
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+
+  //the sign and the number of significant bytes, and then the significant bytes
+  for(int8_t i = 0; i <= i_length; ++i){
+    TSODLULS_padd__macraff(
+        p_sort_element,
+        i_number_of_lex_padding_bytes_before,
+        i_number_of_contrelex_padding_bytes_before,
+        i_current_offset
+    );
+
+    if(i == 0){
+      p_sort_element->s_key[p_sort_element->i_key_size++] = i_first_byte;
+    }
+    else{
+      p_sort_element->s_key[p_sort_element->i_key_size++] = (uint8_t)((((uint64_t)i64) >> (8 * (i_length - i))) % 256);
+    }
+    i_current_offset = (i_current_offset + 1) % i_number_of_contiguous_data_bytes;
+
+    TSODLULS_padd__macraff(
+        p_sort_element,
+        i_number_of_lex_padding_bytes_after,
+        i_number_of_contrelex_padding_bytes_after,
+        i_current_offset
+    );
+  }
+  return 0;
+}//end function TSODLULS_add_bytes_to_key_from_int64_varint()
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint8 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint8() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint8_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint8_t i8,
+  int8_t i_current_offset
+){
+  int i_result = 0;
+  t_TSODLULS_padding_layout* p_layout = NULL;
+  uint8_t* s_key = NULL;
+
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  void* TSODLULS_macraff_p_void;
+
+  if(i_current_offset < 0){
+    return I_ERROR__CURRENT_OFFSET_MUST_BE_AT_LEAST_0;
+  }
+  if(p_plan->i_number_of_contiguous_data_bytes <= i_current_offset){
+    return I_ERROR__CURRENT_OFFSET_MUST_BE_LESS_THAN_THE_NUMBER_OF_CONTIGUOUS_DATA_BYTES;
+  }
+  p_layout = &(p_plan->arr_layouts_uint8[i_current_offset]);
+
+  TSODLULS_element_allocate_space_for_key__macraff(
+      i_result,
+      p_sort_element,
+      p_layout->i_size
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+
+  s_key = p_sort_element->s_key + p_sort_element->i_key_size;
+  memcpy(s_key, p_layout->s_template, p_layout->i_size);
+  s_key[p_layout->arr_data_positions[0]] = i8;
+  p_sort_element->i_key_size += p_layout->i_size;
+  return 0;
+}//end function TSODLULS_add_bytes_to_key_from_uint8_with_padding_plan()
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint16 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint16() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint16_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint16_t i16,
+  int8_t i_current_offset
+){
+  int i_result = 0;
+  t_TSODLULS_padding_layout* p_layout = NULL;
+  uint8_t* s_key = NULL;
+
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  void* TSODLULS_macraff_p_void;
+
+  if(i_current_offset < 0){
+    return I_ERROR__CURRENT_OFFSET_MUST_BE_AT_LEAST_0;
+  }
+  if(p_plan->i_number_of_contiguous_data_bytes <= i_current_offset){
+    return I_ERROR__CURRENT_OFFSET_MUST_BE_LESS_THAN_THE_NUMBER_OF_CONTIGUOUS_DATA_BYTES;
+  }
+  p_layout = &(p_plan->arr_layouts_uint16[i_current_offset]);
+
+  TSODLULS_element_allocate_space_for_key__macraff(
+      i_result,
+      p_sort_element,
+      p_layout->i_size
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+
+  s_key = p_sort_element->s_key + p_sort_element->i_key_size;
+  memcpy(s_key, p_layout->s_template, p_layout->i_size);
+  s_key[p_layout->arr_data_positions[0]] = (uint8_t)(i16 >> 8);
+  s_key[p_layout->arr_data_positions[1]] = (uint8_t)(i16 % 256);
+  p_sort_element->i_key_size += p_layout->i_size;
+  return 0;
+}//end function TSODLULS_add_bytes_to_key_from_uint16_with_padding_plan()
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint32 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint32() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint32_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint32_t i32,
+  int8_t i_current_offset
+){
+  int i_result = 0;
+  t_TSODLULS_padding_layout* p_layout = NULL;
+  uint8_t* s_key = NULL;
+
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  void* TSODLULS_macraff_p_void;
+
+  if(i_current_offset < 0){
+    return I_ERROR__CURRENT_OFFSET_MUST_BE_AT_LEAST_0;
+  }
+  if(p_plan->i_number_of_contiguous_data_bytes <= i_current_offset){
+    return I_ERROR__CURRENT_OFFSET_MUST_BE_LESS_THAN_THE_NUMBER_OF_CONTIGUOUS_DATA_BYTES;
+  }
+  p_layout = &(p_plan->arr_layouts_uint32[i_current_offset]);
+
+  TSODLULS_element_allocate_space_for_key__macraff(
+      i_result,
+      p_sort_element,
+      p_layout->i_size
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+
+  s_key = p_sort_element->s_key + p_sort_element->i_key_size;
+  memcpy(s_key, p_layout->s_template, p_layout->i_size);
+  s_key[p_layout->arr_data_positions[0]] = (uint8_t)(i32 >> 24);
+  s_key[p_layout->arr_data_positions[1]] = (uint8_t)((i32 >> 16) % 256);
+  s_key[p_layout->arr_data_positions[2]] = (uint8_t)((i32 >> 8) % 256);
+  s_key[p_layout->arr_data_positions[3]] = (uint8_t)(i32 % 256);
+  p_sort_element->i_key_size += p_layout->i_size;
+  return 0;
+}//end function TSODLULS_add_bytes_to_key_from_uint32_with_padding_plan()
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint64 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint64() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint64_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint64_t i64,
+  int8_t i_current_offset
+){
+  int i_result = 0;
+  t_TSODLULS_padding_layout* p_layout = NULL;
+  uint8_t* s_key = NULL;
+
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  void* TSODLULS_macraff_p_void;
+
+  if(i_current_offset < 0){
+    return I_ERROR__CURRENT_OFFSET_MUST_BE_AT_LEAST_0;
+  }
+  if(p_plan->i_number_of_contiguous_data_bytes <= i_current_offset){
+    return I_ERROR__CURRENT_OFFSET_MUST_BE_LESS_THAN_THE_NUMBER_OF_CONTIGUOUS_DATA_BYTES;
+  }
+  p_layout = &(p_plan->arr_layouts_uint64[i_current_offset]);
+
+  TSODLULS_element_allocate_space_for_key__macraff(
+      i_result,
+      p_sort_element,
+      p_layout->i_size
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+
+  s_key = p_sort_element->s_key + p_sort_element->i_key_size;
+  memcpy(s_key, p_layout->s_template, p_layout->i_size);
+  s_key[p_layout->arr_data_positions[0]] = (uint8_t)(i64 >> 56);
+  s_key[p_layout->arr_data_positions[1]] = (uint8_t)((i64 >> 48) % 256);
+  s_key[p_layout->arr_data_positions[2]] = (uint8_t)((i64 >> 40) % 256);
+  s_key[p_layout->arr_data_positions[3]] = (uint8_t)((i64 >> 32) % 256);
+  s_key[p_layout->arr_data_positions[4]] = (uint8_t)((i64 >> 24) % 256);
+  s_key[p_layout->arr_data_positions[5]] = (uint8_t)((i64 >> 16) % 256);
+  s_key[p_layout->arr_data_positions[6]] = (uint8_t)((i64 >> 8) % 256);
+  s_key[p_layout->arr_data_positions[7]] = (uint8_t)(i64 % 256);
+  p_sort_element->i_key_size += p_layout->i_size;
+  return 0;
+}//end function TSODLULS_add_bytes_to_key_from_uint64_with_padding_plan()
+
+
+
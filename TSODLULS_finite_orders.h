@@ -206,3 +206,130 @@ int TSODLULS_add_bytes_to_key_from_uint64(
 
 
 
+/**
+ * Adding TSO-encoding to the current key
+ * Number of data bytes of the variable-length encoding of an uint64 (see TSODLULS_add_bytes_to_key_from_uint64_varint()):
+ * 1 for 0, 2 for 1 to 255, 3 for 256 to 65535, ..., 9 from 2^56.
+ * The current offset after the encoding is (i_current_offset + this size) % i_number_of_contiguous_data_bytes.
+ */
+int8_t TSODLULS_get_varint_size_from_uint64(uint64_t i64);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * Number of data bytes of the variable-length encoding of an int64 (see TSODLULS_add_bytes_to_key_from_int64_varint()):
+ * 1 for -1 and 0, 2 for -256 to -2 and 1 to 255, ..., 9 below -2^56 and from 2^56.
+ */
+int8_t TSODLULS_get_varint_size_from_int64(int64_t i64);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint64 with a variable-length encoding:
+ * a first data byte with the number of significant bytes (0 to 8), and then the significant bytes (big-endian).
+ * The order is preserved and no encoding is a prefix of another one,
+ * hence the encoding can be followed by other data in a composite key,
+ * and values below 256 need 2 data bytes instead of 8.
+ * The padding parameters are applied to each data byte, like with TSODLULS_add_bytes_to_key_from_uint64(),
+ * and the number of data bytes is TSODLULS_get_varint_size_from_uint64(i64).
+ * Available as a macraff (see TSODLULS_finite_orders__macro.h).
+ */
+int TSODLULS_add_bytes_to_key_from_uint64_varint(
+  t_TSODLULS_sort_element* p_sort_element,
+  uint64_t i64,
+  int8_t i_number_of_lex_padding_bytes_before,
+  int8_t i_number_of_contrelex_padding_bytes_before,
+  int8_t i_number_of_lex_padding_bytes_after,
+  int8_t i_number_of_contrelex_padding_bytes_after,
+  int8_t i_number_of_contiguous_data_bytes,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From int64 with a variable-length encoding:
+ * a first data byte 9 + the number of significant bytes (0 to 8) for non negative values,
+ * and 8 - the number of significant bytes of -1 - i64 for negative values,
+ * and then the significant bytes (big-endian) of i64.
+ * The order is preserved and no encoding is a prefix of another one,
+ * hence values from -256 to 255 need at most 2 data bytes instead of 8.
+ * The number of data bytes is TSODLULS_get_varint_size_from_int64(i64).
+ * Available as a macraff (see TSODLULS_finite_orders__macro.h).
+ */
+int TSODLULS_add_bytes_to_key_from_int64_varint(
+  t_TSODLULS_sort_element* p_sort_element,
+  int64_t i64,
+  int8_t i_number_of_lex_padding_bytes_before,
+  int8_t i_number_of_contrelex_padding_bytes_before,
+  int8_t i_number_of_lex_padding_bytes_after,
+  int8_t i_number_of_contrelex_padding_bytes_after,
+  int8_t i_number_of_contiguous_data_bytes,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint8 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint8() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint8_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint8_t i8,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint16 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint16() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint16_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint16_t i16,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint32 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint32() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint32_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint32_t i32,
+  int8_t i_current_offset
+);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From uint64 with a padding plan
+ * Same result as TSODLULS_add_bytes_to_key_from_uint64() with the padding parameters of the plan,
+ * without checking them again and without computing the padding byte by byte.
+ */
+int TSODLULS_add_bytes_to_key_from_uint64_with_padding_plan(
+  t_TSODLULS_sort_element* p_sort_element,
+  t_TSODLULS_padding_plan* p_plan,
+  uint64_t i64,
+  int8_t i_current_offset
+);
+
+
+
@@ -925,3 +925,248 @@ do{\
 
 
 
+/**
+ * Adding TSO-encoding to the current key
+ * From uint64 with a variable-length encoding (see TSODLULS_add_bytes_to_key_from_uint64_varint())
+ * This macraff requires the following auxiliary variables:
+ *   uint8_t TSODLULS_macraff_ui8;
+ *   uint16_t TSODLULS_macraff_ui16;
+ *   uint64_t TSODLULS_macraff_ui64;
+ *   int8_t TSODLULS_macraff_i8;
+ *   int8_t TSODLULS_macraff_i8_2;
+ *   int8_t TSODLULS_macraff_i8_3;
+ *   int8_t TSODLULS_macraff_i8_4;
+ *   int8_t TSODLULS_macraff_i8_5;
+ *   int8_t TSODLULS_macraff_i8_6;
+ *   int8_t TSODLULS_macraff_i8_7;
+ *   int8_t TSODLULS_macraff_i8_8;
+ *   int8_t TSODLULS_macraff_i8_9;
+ *   int8_t TSODLULS_macraff_i8_10;
+ *   int8_t TSODLULS_macraff_i8_11;
+ *   int8_t TSODLULS_macraff_i8_12;
+ *   int TSODLULS_macraff_i;
+ *   size_t TSODLULS_macraff_isize;
+ *   size_t TSODLULS_macraff_isize_2;
+ *   size_t TSODLULS_macraff_isize_3;
+ *   size_t TSODLULS_macraff_isize_4;
+ *   t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+ *   t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+ *   void* TSODLULS_macraff_p_void;
+ * There are many auxiliary variables because of nested macraffs.
+ */
+#define TSODLULS_add_bytes_to_key_from_uint64_varint__macraff(\
+  i_aff,\
+  p_sort_element,\
+  i64,\
+  i_number_of_lex_padding_bytes_before,\
+  i_number_of_contrelex_padding_bytes_before,\
+  i_number_of_lex_padding_bytes_after,\
+  i_number_of_contrelex_padding_bytes_after,\
+  i_number_of_contiguous_data_bytes,\
+  i_current_offset\
+) \
+do{\
+  TSODLULS_macraff_p_sort_element_2 = (p_sort_element);\
+  TSODLULS_macraff_ui64 = (i64);\
+  TSODLULS_macraff_i8_7 = (i_number_of_lex_padding_bytes_before);\
+  TSODLULS_macraff_i8_8 = (i_number_of_contrelex_padding_bytes_before);\
+  TSODLULS_macraff_i8_9 = (i_number_of_lex_padding_bytes_after);\
+  TSODLULS_macraff_i8_10 = (i_number_of_contrelex_padding_bytes_after);\
+  TSODLULS_macraff_i8_11 = (i_number_of_contiguous_data_bytes);\
+  TSODLULS_macraff_i8_12 = (i_current_offset);\
+\
+  TSODLULS_macraff_ui8 = 0;\
+  while(TSODLULS_macraff_ui8 < 8 && (TSODLULS_macraff_ui64 >> (8 * TSODLULS_macraff_ui8)) != 0){\
+    ++TSODLULS_macraff_ui8;\
+  }\
+  TSODLULS_macraff_isize_4 = 0;\
+  TSODLULS_macraff_i = 0;\
+\
+  TSODLULS_check_padding_parameters__macraff(\
+      TSODLULS_macraff_i,\
+      TSODLULS_macraff_i8_7,\
+      TSODLULS_macraff_i8_8,\
+      TSODLULS_macraff_i8_9,\
+      TSODLULS_macraff_i8_10,\
+      TSODLULS_macraff_i8_11,\
+      TSODLULS_macraff_i8_12\
+  );\
+  if(TSODLULS_macraff_i != 0){\
+    (i_aff) = TSODLULS_macraff_i;\
+    break;\
+  }\
+\
+  TSODLULS_compute_size_needed__macraff(\
+      TSODLULS_macraff_isize_4,\
+      TSODLULS_macraff_ui8 + 1,\
+      TSODLULS_macraff_i8_7,\
+      TSODLULS_macraff_i8_8,\
+      TSODLULS_macraff_i8_9,\
+      TSODLULS_macraff_i8_10,\
+      TSODLULS_macraff_i8_11,\
+      TSODLULS_macraff_i8_12\
+  );\
+\
+  TSODLULS_element_allocate_space_for_key__macraff(\
+      TSODLULS_macraff_i,\
+      TSODLULS_macraff_p_sort_element_2,\
+      TSODLULS_macraff_isize_4\
+  );\
+  if(TSODLULS_macraff_i != 0){\
+    (i_aff) = TSODLULS_macraff_i;\
+    break;\
+  }\
+\
+  for(TSODLULS_macraff_ui16 = 0; TSODLULS_macraff_ui16 <= TSODLULS_macraff_ui8; ++TSODLULS_macraff_ui16){\
+    TSODLULS_padd__macraff(\
+        TSODLULS_macraff_p_sort_element_2,\
+        TSODLULS_macraff_i8_7,\
+        TSODLULS_macraff_i8_8,\
+        TSODLULS_macraff_i8_12\
+    );\
+\
+    if(TSODLULS_macraff_ui16 == 0){\
+      TSODLULS_macraff_p_sort_element_2->s_key[TSODLULS_macraff_p_sort_element_2->i_key_size++] = TSODLULS_macraff_ui8;\
+    }\
+    else{\
+      TSODLULS_macraff_p_sort_element_2->s_key[TSODLULS_macraff_p_sort_element_2->i_key_size++] =\
+          (uint8_t)((TSODLULS_macraff_ui64 >> (8 * (TSODLULS_macraff_ui8 - TSODLULS_macraff_ui16))) % 256);\
+    }\
+    TSODLULS_macraff_i8_12 = (TSODLULS_macraff_i8_12 + 1) % TSODLULS_macraff_i8_11;\
+\
+    TSODLULS_padd__macraff(\
+        TSODLULS_macraff_p_sort_element_2,\
+        TSODLULS_macraff_i8_9,\
+        TSODLULS_macraff_i8_10,\
+        TSODLULS_macraff_i8_12\
+    );\
+  }\
+  (i_aff) = 0;\
+}while(0);
+
+
+
+/**
+ * Adding TSO-encoding to the current key
+ * From int64 with a variable-length encoding (see TSODLULS_add_bytes_to_key_from_int64_varint())
+ * This macraff requires the following auxiliary variables:
+ *   uint8_t TSODLULS_macraff_ui8;
+ *   uint16_t TSODLULS_macraff_ui16;
+ *   uint32_t TSODLULS_macraff_ui32;
+ *   uint64_t TSODLULS_macraff_ui64;
+ *   int8_t TSODLULS_macraff_i8;
+ *   int8_t TSODLULS_macraff_i8_2;
+ *   int8_t TSODLULS_macraff_i8_3;
+ *   int8_t TSODLULS_macraff_i8_4;
+ *   int8_t TSODLULS_macraff_i8_5;
+ *   int8_t TSODLULS_macraff_i8_6;
+ *   int8_t TSODLULS_macraff_i8_7;
+ *   int8_t TSODLULS_macraff_i8_8;
+ *   int8_t TSODLULS_macraff_i8_9;
+ *   int8_t TSODLULS_macraff_i8_10;
+ *   int8_t TSODLULS_macraff_i8_11;
+ *   int8_t TSODLULS_macraff_i8_12;
+ *   int TSODLULS_macraff_i;
+ *   size_t TSODLULS_macraff_isize;
+ *   size_t TSODLULS_macraff_isize_2;
+ *   size_t TSODLULS_macraff_isize_3;
+ *   size_t TSODLULS_macraff_isize_4;
+ *   t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+ *   t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+ *   void* TSODLULS_macraff_p_void;
+ * There are many auxiliary variables because of nested macraffs.
+ */
+#define TSODLULS_add_bytes_to_key_from_int64_varint__macraff(\
+  i_aff,\
+  p_sort_element,\
+  i64,\
+  i_number_of_lex_padding_bytes_before,\
+  i_number_of_contrelex_padding_bytes_before,\
+  i_number_of_lex_padding_bytes_after,\
+  i_number_of_contrelex_padding_bytes_after,\
+  i_number_of_contiguous_data_bytes,\
+  i_current_offset\
+) \
+do{\
+  TSODLULS_macraff_p_sort_element_2 = (p_sort_element);\
+  TSODLULS_macraff_ui64 = (uint64_t)((int64_t)(i64));\
+  TSODLULS_macraff_ui32 = (TSODLULS_macraff_ui64 >> 63);\
+  TSODLULS_macraff_i8_7 = (i_number_of_lex_padding_bytes_before);\
+  TSODLULS_macraff_i8_8 = (i_number_of_contrelex_padding_bytes_before);\
+  TSODLULS_macraff_i8_9 = (i_number_of_lex_padding_bytes_after);\
+  TSODLULS_macraff_i8_10 = (i_number_of_contrelex_padding_bytes_after);\
+  TSODLULS_macraff_i8_11 = (i_number_of_contiguous_data_bytes);\
+  TSODLULS_macraff_i8_12 = (i_current_offset);\
+\
+  TSODLULS_macraff_ui8 = 0;\
+  while(TSODLULS_macraff_ui8 < 8 && ((TSODLULS_macraff_ui32 ? ~TSODLULS_macraff_ui64 : TSODLULS_macraff_ui64) >> (8 * TSODLULS_macraff_ui8)) != 0){\
+    ++TSODLULS_macraff_ui8;\
+  }\
+  TSODLULS_macraff_ui32 = TSODLULS_macraff_ui32 ? (8 - TSODLULS_macraff_ui8) : (9 + TSODLULS_macraff_ui8);\
+  TSODLULS_macraff_isize_4 = 0;\
+  TSODLULS_macraff_i = 0;\
+\
+  TSODLULS_check_padding_parameters__macraff(\
+      TSODLULS_macraff_i,\
+      TSODLULS_macraff_i8_7,\
+      TSODLULS_macraff_i8_8,\
+      TSODLULS_macraff_i8_9,\
+      TSODLULS_macraff_i8_10,\
+      TSODLULS_macraff_i8_11,\
+      TSODLULS_macraff_i8_12\
+  );\
+  if(TSODLULS_macraff_i != 0){\
+    (i_aff) = TSODLULS_macraff_i;\
+    break;\
+  }\
+\
+  TSODLULS_compute_size_needed__macraff(\
+      TSODLULS_macraff_isize_4,\
+      TSODLULS_macraff_ui8 + 1,\
+      TSODLULS_macraff_i8_7,\
+      TSODLULS_macraff_i8_8,\
+      TSODLULS_macraff_i8_9,\
+      TSODLULS_macraff_i8_10,\
+      TSODLULS_macraff_i8_11,\
+      TSODLULS_macraff_i8_12\
+  );\
+\
+  TSODLULS_element_allocate_space_for_key__macraff(\
+      TSODLULS_macraff_i,\
+      TSODLULS_macraff_p_sort_element_2,\
+      TSODLULS_macraff_isize_4\
+  );\
+  if(TSODLULS_macraff_i != 0){\
+    (i_aff) = TSODLULS_macraff_i;\
+    break;\
+  }\
+\
+  for(TSODLULS_macraff_ui16 = 0; TSODLULS_macraff_ui16 <= TSODLULS_macraff_ui8; ++TSODLULS_macraff_ui16){\
+    TSODLULS_padd__macraff(\
+        TSODLULS_macraff_p_sort_element_2,\
+        TSODLULS_macraff_i8_7,\
+        TSODLULS_macraff_i8_8,\
+        TSODLULS_macraff_i8_12\
+    );\
+\
+    if(TSODLULS_macraff_ui16 == 0){\
+      TSODLULS_macraff_p_sort_element_2->s_key[TSODLULS_macraff_p_sort_element_2->i_key_size++] = (uint8_t)TSODLULS_macraff_ui32;\
+    }\
+    else{\
+      TSODLULS_macraff_p_sort_element_2->s_key[TSODLULS_macraff_p_sort_element_2->i_key_size++] =\
+          (uint8_t)((TSODLULS_macraff_ui64 >> (8 * (TSODLULS_macraff_ui8 - TSODLULS_macraff_ui16))) % 256);\
+    }\
+    TSODLULS_macraff_i8_12 = (TSODLULS_macraff_i8_12 + 1) % TSODLULS_macraff_i8_11;\
+\
+    TSODLULS_padd__macraff(\
+        TSODLULS_macraff_p_sort_element_2,\
+        TSODLULS_macraff_i8_9,\
+        TSODLULS_macraff_i8_10,\
+        TSODLULS_macraff_i8_12\
+    );\
+  }\
+  (i_aff) = 0;\
+}while(0);
+
+
+
@@ -41,11 +41,17 @@ void TSODLULS_init_element(t_TSODLULS_sort_element* p_element){
 /**
  * Miscellaneous functions
  * Free the key of a TSODLULS element (if necessary) and reinitializes the corresponding fields
+ * The keys in a key arena (I_KEY_ARENA_FLAG in i_allocated_size) are not freed, they belong to the arena.
  * Available as a macraff (see TSODLULS_misc__macro.h).
  */
 void TSODLULS_free_key(t_TSODLULS_sort_element* p_element){
   if(p_element->s_key != NULL){
-    TSODLULS_free(p_element->s_key);
+    if(p_element->i_allocated_size & I_KEY_ARENA_FLAG){
+      p_element->s_key = NULL;
+    }
+    else{
+      TSODLULS_free(p_element->s_key);
+    }
     p_element->i_key_size = 0;
     p_element->i_allocated_size = 0;
   }
@@ -95,6 +101,8 @@ void TSODLULS_free_keys_in_array_of_elements(
 /**
  * Miscellaneous functions
  * (Re)Allocate space for the key of a TSODLULS element
+ * A key that is not owned by the element (in a key arena, or i_allocated_size is 0)
+ * is copied in a new heap allocated key when it must grow, it is never reallocated.
  * Available as a macraff (see TSODLULS_misc__macro.h).
  */
 int TSODLULS_element_allocate_space_for_key(
@@ -104,38 +112,61 @@ int TSODLULS_element_allocate_space_for_key(
   size_t i_number_of_elements_for_realloc = 0;
   void* p_for_realloc = NULL;
 
-  if(p_sort_element->i_allocated_size == 0){
-    p_sort_element->s_key = calloc(i_size_needed, sizeof(uint8_t));
-    if(p_sort_element ==  NULL){
+  if(p_sort_element->i_allocated_size != 0 && !(p_sort_element->i_allocated_size & I_KEY_ARENA_FLAG)){
+    if(p_sort_element->i_allocated_size - p_sort_element->i_key_size >= i_size_needed){
+      return 0;
+    }
+
+    i_number_of_elements_for_realloc = p_sort_element->i_allocated_size;
+    do{
+      i_number_of_elements_for_realloc = i_number_of_elements_for_realloc << 1;
+      if(i_number_of_elements_for_realloc <= p_sort_element->i_allocated_size){
+        return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      }
+    }
+    while(i_number_of_elements_for_realloc - p_sort_element->i_key_size < i_size_needed);
+
+    if(i_number_of_elements_for_realloc > SIZE_MAX / sizeof(uint8_t)){
       return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
     }
-    p_sort_element->i_allocated_size = i_size_needed;
-    return 0;
-  }
-  if(p_sort_element->i_allocated_size - p_sort_element->i_key_size >= i_size_needed){
-    return 0;
-  }
 
-  i_number_of_elements_for_realloc = p_sort_element->i_allocated_size;
-  do{
-    i_number_of_elements_for_realloc = i_number_of_elements_for_realloc << 1;
-    if(i_number_of_elements_for_realloc <= p_sort_element->i_allocated_size){
+    p_for_realloc = realloc(
+        p_sort_element->s_key,
+        i_number_of_elements_for_realloc * sizeof(uint8_t)
+    );
+    if(p_for_realloc == NULL){
       return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
     }
+    p_sort_element->s_key = (uint8_t*) p_for_realloc;
+    p_sort_element->i_allocated_size = i_number_of_elements_for_realloc;
+    return 0;
   }
-  while(i_number_of_elements_for_realloc - p_sort_element->i_key_size < i_size_needed);
 
-  if(i_number_of_elements_for_realloc * sizeof(uint8_t) <= i_number_of_elements_for_realloc){
+  //the key is not owned by the element: a key in a key arena is used while it has room
+  if(
+    p_sort_element->i_allocated_size != 0
+    && (p_sort_element->i_allocated_size & ~I_KEY_ARENA_FLAG) - p_sort_element->i_key_size >= i_size_needed
+  ){
+    return 0;
+  }
+  //and the key is copied in a new heap allocated key when it must grow
+  if(i_size_needed > SIZE_MAX - p_sort_element->i_key_size){
     return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
   }
-
-  p_for_realloc = realloc(
-      p_sort_element->s_key,
-      i_number_of_elements_for_realloc * sizeof(uint8_t)
-  );
+  i_number_of_elements_for_realloc = p_sort_element->i_key_size + i_size_needed;
+  if(i_number_of_elements_for_realloc < ((p_sort_element->i_allocated_size & ~I_KEY_ARENA_FLAG) << 1)){
+    i_number_of_elements_for_realloc = (p_sort_element->i_allocated_size & ~I_KEY_ARENA_FLAG) << 1;
+  }
+  if(i_number_of_elements_for_realloc == 0){
+    i_number_of_elements_for_realloc = 1;
+  }
+  p_for_realloc = calloc(i_number_of_elements_for_realloc, sizeof(uint8_t));
   if(p_for_realloc == NULL){
     return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
   }
+  if(p_sort_element->i_key_size > 0){
+    memcpy(p_for_realloc, p_sort_element->s_key, p_sort_element->i_key_size);
+  }
   p_sort_element->s_key = (uint8_t*) p_for_realloc;
   p_sort_element->i_allocated_size = i_number_of_elements_for_realloc;
   return 0;
@@ -177,3 +208,247 @@ int TSODLULS_init_array_of_elements__short(
 
 
 
+/**
+ * Miscellaneous functions
+ * Initialize a key arena
+ * No memory is allocated until the first key is placed in the arena.
+ * If i_slab_size is 0, I_KEY_ARENA_DEFAULT_SLAB_SIZE is used.
+ */
+void TSODLULS_key_arena_init(t_TSODLULS_key_arena* p_arena, size_t i_slab_size){
+  p_arena->arr_slabs = NULL;
+  p_arena->i_number_of_slabs = 0;
+  p_arena->i_allocated_number_of_slabs = 0;
+  p_arena->i_slab_size = (i_slab_size == 0) ? I_KEY_ARENA_DEFAULT_SLAB_SIZE : i_slab_size;
+  p_arena->i_size_of_last_slab = 0;
+  p_arena->i_used_in_last_slab = 0;
+}//end function TSODLULS_key_arena_init()
+
+
+
+/**
+ * Miscellaneous functions
+ * Allocate space in a key arena (bump allocation)
+ * A new slab is allocated only when the last one is full.
+ * A request bigger than the slab size gets a slab of its own.
+ */
+int TSODLULS_key_arena_allocate(
+  t_TSODLULS_key_arena* p_arena,
+  size_t i_size_needed,
+  uint8_t** p_s_space
+){
+  size_t i_number_of_slabs_for_realloc = 0;
+  size_t i_size_of_new_slab = 0;
+  void* p_for_realloc = NULL;
+
+  if(
+    p_arena->i_number_of_slabs > 0
+    && p_arena->i_size_of_last_slab - p_arena->i_used_in_last_slab >= i_size_needed
+  ){
+    *p_s_space = p_arena->arr_slabs[p_arena->i_number_of_slabs - 1] + p_arena->i_used_in_last_slab;
+    p_arena->i_used_in_last_slab += i_size_needed;
+    return 0;
+  }
+
+  if(p_arena->i_number_of_slabs == p_arena->i_allocated_number_of_slabs){
+    i_number_of_slabs_for_realloc = p_arena->i_allocated_number_of_slabs << 1;
+    if(i_number_of_slabs_for_realloc == 0){
+      i_number_of_slabs_for_realloc = 16;
+    }
+    if(i_number_of_slabs_for_realloc <= p_arena->i_allocated_number_of_slabs){
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    p_for_realloc = realloc(p_arena->arr_slabs, i_number_of_slabs_for_realloc * sizeof(uint8_t*));
+    if(p_for_realloc == NULL){
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    p_arena->arr_slabs = (uint8_t**) p_for_realloc;
+    p_arena->i_allocated_number_of_slabs = i_number_of_slabs_for_realloc;
+  }
+
+  i_size_of_new_slab = p_arena->i_slab_size;
+  if(i_size_of_new_slab < i_size_needed){
+    i_size_of_new_slab = i_size_needed;
+  }
+  p_arena->arr_slabs[p_arena->i_number_of_slabs] = malloc(i_size_of_new_slab * sizeof(uint8_t));
+  if(p_arena->arr_slabs[p_arena->i_number_of_slabs] == NULL){
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  ++(p_arena->i_number_of_slabs);
+  p_arena->i_size_of_last_slab = i_size_of_new_slab;
+  p_arena->i_used_in_last_slab = i_size_needed;
+  *p_s_space = p_arena->arr_slabs[p_arena->i_number_of_slabs - 1];
+  return 0;
+}//end function TSODLULS_key_arena_allocate()
+
+
+
+/**
+ * Miscellaneous functions
+ * Reserve space in a key arena for the key of a TSODLULS element
+ * Use it when the size of the key is known up front (or an upper bound is known):
+ * the add_bytes functions then write directly in the arena without any allocation,
+ * as long as the reserved size is not exceeded.
+ * A key that grows past the reserved size is copied in a heap allocated key,
+ * that TSODLULS_free_key() frees (I_KEY_ARENA_FLAG marks the keys still in the arena).
+ * The element must not own a heap allocated key.
+ */
+int TSODLULS_key_arena_reserve_key(
+  t_TSODLULS_key_arena* p_arena,
+  t_TSODLULS_sort_element* p_sort_element,
+  size_t i_key_size
+){
+  int i_result = 0;
+  i_result = TSODLULS_key_arena_allocate(p_arena, i_key_size, &(p_sort_element->s_key));
+  if(i_result != 0){
+    return i_result;
+  }
+  p_sort_element->i_key_size = 0;
+  p_sort_element->i_allocated_size = I_KEY_ARENA_FLAG | i_key_size;
+  return 0;
+}//end function TSODLULS_key_arena_reserve_key()
+
+
+
+/**
+ * Miscellaneous functions
+ * Copy a key built in a TSODLULS element (the builder) into a key arena
+ * Use it when the size of the key is only estimated:
+ * the key is built with the add_bytes functions in the builder,
+ * whose buffer is reused from one key to the next and grows only a few times,
+ * then it is copied in the arena and the builder is reset (its buffer is kept).
+ * The target element must not own a heap allocated key.
+ */
+int TSODLULS_key_arena_commit_key(
+  t_TSODLULS_key_arena* p_arena,
+  t_TSODLULS_sort_element* p_builder,
+  t_TSODLULS_sort_element* p_sort_element
+){
+  int i_result = 0;
+  i_result = TSODLULS_key_arena_allocate(p_arena, p_builder->i_key_size, &(p_sort_element->s_key));
+  if(i_result != 0){
+    return i_result;
+  }
+  memcpy(p_sort_element->s_key, p_builder->s_key, p_builder->i_key_size);
+  p_sort_element->i_key_size = p_builder->i_key_size;
+  p_sort_element->i_allocated_size = I_KEY_ARENA_FLAG | p_builder->i_key_size;
+  p_builder->i_key_size = 0;
+  return 0;
+}//end function TSODLULS_key_arena_commit_key()
+
+
+
+/**
+ * Miscellaneous functions
+ * Initialize an array of TSODLULS elements with keys reserved in a key arena
+ * i_key_size is the size reserved for each key (see TSODLULS_key_arena_reserve_key()).
+ * If the slab size of the arena is smaller than the space needed, a single slab is allocated for all keys.
+ */
+int TSODLULS_key_arena_init_array_of_elements(
+  t_TSODLULS_key_arena* p_arena,
+  t_TSODLULS_sort_element** p_arr_elements,
+  size_t i_number_of_elements,
+  size_t i_key_size
+){
+  int i_result = 0;
+  uint8_t* s_keys = NULL;
+  i_result = TSODLULS_init_array_of_elements(p_arr_elements, i_number_of_elements);
+  if(i_result != 0){
+    return i_result;
+  }
+  if(i_key_size == 0 || i_number_of_elements == 0){
+    return 0;
+  }
+  if(i_number_of_elements > SIZE_MAX / i_key_size){
+    TSODLULS_free(*p_arr_elements);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  i_result = TSODLULS_key_arena_allocate(p_arena, i_number_of_elements * i_key_size, &s_keys);
+  if(i_result != 0){
+    TSODLULS_free(*p_arr_elements);
+    return i_result;
+  }
+  for(size_t i = 0; i < i_number_of_elements; ++i){
+    (*p_arr_elements)[i].s_key = s_keys + i * i_key_size;
+    (*p_arr_elements)[i].i_allocated_size = I_KEY_ARENA_FLAG | i_key_size;
+  }
+  return 0;
+}//end function TSODLULS_key_arena_init_array_of_elements()
+
+
+
+/**
+ * Miscellaneous functions
+ * Free all the slabs of a key arena at once
+ * The keys of the elements still in the arena are skipped by TSODLULS_free_key(),
+ * hence the keys that grew out of the arena can be freed before or after.
+ */
+void TSODLULS_key_arena_free(t_TSODLULS_key_arena* p_arena){
+  for(size_t i = 0; i < p_arena->i_number_of_slabs; ++i){
+    TSODLULS_free(p_arena->arr_slabs[i]);
+  }
+  if(p_arena->arr_slabs != NULL){
+    TSODLULS_free(p_arena->arr_slabs);
+  }
+  p_arena->i_number_of_slabs = 0;
+  p_arena->i_allocated_number_of_slabs = 0;
+  p_arena->i_size_of_last_slab = 0;
+  p_arena->i_used_in_last_slab = 0;
+}//end function TSODLULS_key_arena_free()
+
+
+
+/**
+ * Miscellaneous functions
+ * Initialize a cost model for the sort dispatchers with the default values
+ * (see I_SORT_MODEL__SAMPLE_SIZE and the following constants)
+ */
+void TSODLULS_sort_model_init(t_TSODLULS_sort_model* p_model){
+  p_model->i_sample_size = I_SORT_MODEL__SAMPLE_SIZE;
+  p_model->i_insertion_threshold = I_SORT_MODEL__INSERTION_THRESHOLD;
+  p_model->f_comparison_cost = F_SORT_MODEL__COMPARISON_COST;
+  p_model->f_comparison_byte_cost = F_SORT_MODEL__COMPARISON_BYTE_COST;
+  p_model->f_radix_setup_cost = F_SORT_MODEL__RADIX_SETUP_COST;
+  p_model->f_radix_level_cost = F_SORT_MODEL__RADIX_LEVEL_COST;
+  p_model->f_radix_count_cost = F_SORT_MODEL__RADIX_COUNT_COST;
+  p_model->f_radix_pass_cost = F_SORT_MODEL__RADIX_PASS_COST;
+  p_model->f_radix_instance_cost = F_SORT_MODEL__RADIX_INSTANCE_COST;
+  p_model->i_insertion_threshold__short = I_SORT_MODEL__INSERTION_THRESHOLD__SHORT;
+  p_model->f_comparison_cost__short = F_SORT_MODEL__COMPARISON_COST__SHORT;
+  p_model->f_radix_setup_cost__short = F_SORT_MODEL__RADIX_SETUP_COST__SHORT;
+  p_model->f_radix_level_cost__short = F_SORT_MODEL__RADIX_LEVEL_COST__SHORT;
+  p_model->f_radix_count_cost__short = F_SORT_MODEL__RADIX_COUNT_COST__SHORT;
+  p_model->f_radix_pass_cost__short = F_SORT_MODEL__RADIX_PASS_COST__SHORT;
+  p_model->f_radix_instance_cost__short = F_SORT_MODEL__RADIX_INSTANCE_COST__SHORT;
+}//end function TSODLULS_sort_model_init()
+
+
+
+__thread t_TSODLULS_sort_stats* p_TSODLULS_sort_stats = NULL;
+
+
+
+/**
+ * Miscellaneous functions
+ * Set all the counters of the stats to 0
+ */
+void TSODLULS_sort_stats_init(t_TSODLULS_sort_stats* p_stats){
+  memset(p_stats, 0, sizeof(t_TSODLULS_sort_stats));
+}//end function TSODLULS_sort_stats_init()
+
+
+
+/**
+ * Miscellaneous functions
+ * Attach the stats to the current thread, the following sort calls of this thread add their counters to it
+ * (see t_TSODLULS_sort_stats). NULL detaches the current stats.
+ * Returns I_ERROR__SORT_STATS_NOT_COMPILED if the library was compiled without -DTSODLULS_STATS.
+ */
+int TSODLULS_sort_stats_attach(t_TSODLULS_sort_stats* p_stats){
+#ifdef TSODLULS_STATS
+  p_TSODLULS_sort_stats = p_stats;
+  return 0;
+#else
+  p_TSODLULS_sort_stats = NULL;
+  return p_stats == NULL ? 0 : I_ERROR__SORT_STATS_NOT_COMPILED;
+#endif
+}//end function TSODLULS_sort_stats_attach()
@@ -32,6 +32,7 @@ void TSODLULS_init_element(t_TSODLULS_sort_element* p_element);
 /**
  * Miscellaneous functions
  * Free the key of a TSODLULS element (if necessary) and reinitializes the corresponding fields
+ * The keys in a key arena (I_KEY_ARENA_FLAG in i_allocated_size) are not freed, they belong to the arena.
  * Available as a macraff (see TSODLULS_misc__macro.h).
  */
 void TSODLULS_free_key(t_TSODLULS_sort_element* p_element);
@@ -59,6 +60,8 @@ void TSODLULS_free_keys_in_array_of_elements(t_TSODLULS_sort_element* arr_elemen
 /**
  * Miscellaneous functions
  * (Re)Allocate space for the key of a TSODLULS element
+ * A key that is not owned by the element (in a key arena, or i_allocated_size is 0)
+ * is copied in a new heap allocated key when it must grow, it is never reallocated.
  * Available as a macraff (see TSODLULS_misc__macro.h).
  */
 int TSODLULS_element_allocate_space_for_key(
@@ -89,3 +92,114 @@ int TSODLULS_init_array_of_elements__short(
 
 
 
+/**
+ * Miscellaneous functions
+ * Initialize a key arena
+ * No memory is allocated until the first key is placed in the arena.
+ * If i_slab_size is 0, I_KEY_ARENA_DEFAULT_SLAB_SIZE is used.
+ */
+void TSODLULS_key_arena_init(t_TSODLULS_key_arena* p_arena, size_t i_slab_size);
+
+
+
+/**
+ * Miscellaneous functions
+ * Allocate space in a key arena (bump allocation)
+ * A new slab is allocated only when the last one is full.
+ * A request bigger than the slab size gets a slab of its own.
+ */
+int TSODLULS_key_arena_allocate(
+  t_TSODLULS_key_arena* p_arena,
+  size_t i_size_needed,
+  uint8_t** p_s_space
+);
+
+
+
+/**
+ * Miscellaneous functions
+ * Reserve space in a key arena for the key of a TSODLULS element
+ * Use it when the size of the key is known up front (or an upper bound is known):
+ * the add_bytes functions then write directly in the arena without any allocation,
+ * as long as the reserved size is not exceeded.
+ * A key that grows past the reserved size is copied in a heap allocated key,
+ * that TSODLULS_free_key() frees (I_KEY_ARENA_FLAG marks the keys still in the arena).
+ * The element must not own a heap allocated key.
+ */
+int TSODLULS_key_arena_reserve_key(
+  t_TSODLULS_key_arena* p_arena,
+  t_TSODLULS_sort_element* p_sort_element,
+  size_t i_key_size
+);
+
+
+
+/**
+ * Miscellaneous functions
+ * Copy a key built in a TSODLULS element (the builder) into a key arena
+ * Use it when the size of the key is only estimated:
+ * the key is built with the add_bytes functions in the builder,
+ * whose buffer is reused from one key to the next and grows only a few times,
+ * then it is copied in the arena and the builder is reset (its buffer is kept).
+ * The target element must not own a heap allocated key.
+ */
+int TSODLULS_key_arena_commit_key(
+  t_TSODLULS_key_arena* p_arena,
+  t_TSODLULS_sort_element* p_builder,
+  t_TSODLULS_sort_element* p_sort_element
+);
+
+
+
+/**
+ * Miscellaneous functions
+ * Initialize an array of TSODLULS elements with keys reserved in a key arena
+ * i_key_size is the size reserved for each key (see TSODLULS_key_arena_reserve_key()).
+ * If the slab size of the arena is smaller than the space needed, a single slab is allocated for all keys.
+ */
+int TSODLULS_key_arena_init_array_of_elements(
+  t_TSODLULS_key_arena* p_arena,
+  t_TSODLULS_sort_element** p_arr_elements,
+  size_t i_number_of_elements,
+  size_t i_key_size
+);
+
+
+
+/**
+ * Miscellaneous functions
+ * Free all the slabs of a key arena at once
+ * The keys of the elements still in the arena are skipped by TSODLULS_free_key(),
+ * hence the keys that grew out of the arena can be freed before or after.
+ */
+void TSODLULS_key_arena_free(t_TSODLULS_key_arena* p_arena);
+
+
+
+/**
+ * Miscellaneous functions
+ * Initialize a cost model for the sort dispatchers with the default values
+ * (see I_SORT_MODEL__SAMPLE_SIZE and the following constants)
+ */
+void TSODLULS_sort_model_init(t_TSODLULS_sort_model* p_model);
+
+
+
+/**
+ * Miscellaneous functions
+ * Set all the counters of the stats to 0
+ */
+void TSODLULS_sort_stats_init(t_TSODLULS_sort_stats* p_stats);
+
+
+
+/**
+ * Miscellaneous functions
+ * Attach the stats to the current thread, the following sort calls of this thread add their counters to it
+ * (see t_TSODLULS_sort_stats). NULL detaches the current stats.
+ * Returns I_ERROR__SORT_STATS_NOT_COMPILED if the library was compiled without -DTSODLULS_STATS.
+ */
+int TSODLULS_sort_stats_attach(t_TSODLULS_sort_stats* p_stats);
+
+
+
@@ -55,6 +55,7 @@ do{\
 /**
  * Miscellaneous functions
  * Free the key of a TSODLULS element (if necessary) and reinitializes the corresponding fields
+ * The keys in a key arena (I_KEY_ARENA_FLAG in i_allocated_size) are not freed, they belong to the arena.
  * This macraff requires the following auxiliary variable:
  *   t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
  */
@@ -62,7 +63,12 @@ do{\
 do{\
   TSODLULS_macraff_p_sort_element = (p_element);\
   if(TSODLULS_macraff_p_sort_element->s_key != NULL){\
-    TSODLULS_free(TSODLULS_macraff_p_sort_element->s_key);\
+    if(TSODLULS_macraff_p_sort_element->i_allocated_size & I_KEY_ARENA_FLAG){\
+      TSODLULS_macraff_p_sort_element->s_key = NULL;\
+    }\
+    else{\
+      TSODLULS_free(TSODLULS_macraff_p_sort_element->s_key);\
+    }\
     TSODLULS_macraff_p_sort_element->i_key_size = 0;\
     TSODLULS_macraff_p_sort_element->i_allocated_size = 0;\
   }\
@@ -126,6 +132,8 @@ do{\
 /**
  * Miscellaneous functions
  * (Re)Allocate space for the key of a TSODLULS element
+ * A key that is not owned by the element (in a key arena, or i_allocated_size is 0)
+ * is copied in a new heap allocated key when it must grow, it is never reallocated.
  * This macraff requires the following auxiliary variables:
  *   t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
  *   size_t TSODLULS_macraff_isize;
@@ -143,44 +151,72 @@ do{\
   TSODLULS_macraff_isize_2 = 0;\
   TSODLULS_macraff_p_void = NULL;\
 \
-  if(TSODLULS_macraff_p_sort_element->i_allocated_size == 0){\
-    TSODLULS_macraff_p_sort_element->s_key = calloc(TSODLULS_macraff_isize, sizeof(uint8_t));\
-    if(TSODLULS_macraff_p_sort_element ==  NULL){\
+  if(\
+    TSODLULS_macraff_p_sort_element->i_allocated_size != 0\
+    && !(TSODLULS_macraff_p_sort_element->i_allocated_size & I_KEY_ARENA_FLAG)\
+  ){\
+    if(TSODLULS_macraff_p_sort_element->i_allocated_size - TSODLULS_macraff_p_sort_element->i_key_size >= TSODLULS_macraff_isize){\
+      (i_aff) = 0;\
+      break;\
+    }\
+\
+    TSODLULS_macraff_isize_2 = TSODLULS_macraff_p_sort_element->i_allocated_size;\
+    do{\
+      TSODLULS_macraff_isize_2 = TSODLULS_macraff_isize_2 << 1;\
+      if(TSODLULS_macraff_isize_2 <= TSODLULS_macraff_p_sort_element->i_allocated_size){\
+        break;\
+      }\
+    }\
+    while(TSODLULS_macraff_isize_2 - TSODLULS_macraff_p_sort_element->i_key_size < TSODLULS_macraff_isize);\
+\
+    if(TSODLULS_macraff_isize_2 <= TSODLULS_macraff_p_sort_element->i_allocated_size\
+      || TSODLULS_macraff_isize_2 > SIZE_MAX / sizeof(uint8_t)\
+    ){\
       (i_aff) = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;\
       break;\
     }\
-    TSODLULS_macraff_p_sort_element->i_allocated_size = TSODLULS_macraff_isize;\
-    (i_aff) = 0;\
-    break;\
-  }\
-  if(TSODLULS_macraff_p_sort_element->i_allocated_size - TSODLULS_macraff_p_sort_element->i_key_size >= TSODLULS_macraff_isize){\
-    (i_aff) = 0;\
-    break;\
-  }\
 \
-  TSODLULS_macraff_isize_2 = TSODLULS_macraff_p_sort_element->i_allocated_size;\
-  do{\
-    TSODLULS_macraff_isize_2 = TSODLULS_macraff_isize_2 << 1;\
-    if(TSODLULS_macraff_isize_2 <= TSODLULS_macraff_p_sort_element->i_allocated_size){\
+    TSODLULS_macraff_p_void = realloc(\
+        TSODLULS_macraff_p_sort_element->s_key,\
+        TSODLULS_macraff_isize_2 * sizeof(uint8_t)\
+    );\
+    if(TSODLULS_macraff_p_void == NULL){\
       (i_aff) = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;\
       break;\
     }\
+    TSODLULS_macraff_p_sort_element->s_key = (uint8_t*) TSODLULS_macraff_p_void;\
+    TSODLULS_macraff_p_sort_element->i_allocated_size = TSODLULS_macraff_isize_2;\
+    (i_aff) = 0;\
+    break;\
   }\
-  while(TSODLULS_macraff_isize_2 - TSODLULS_macraff_p_sort_element->i_key_size < TSODLULS_macraff_isize);\
 \
-  if(TSODLULS_macraff_isize_2 * sizeof(uint8_t) <= TSODLULS_macraff_isize_2){\
+  if(\
+    TSODLULS_macraff_p_sort_element->i_allocated_size != 0\
+    && (TSODLULS_macraff_p_sort_element->i_allocated_size & ~I_KEY_ARENA_FLAG)\
+       - TSODLULS_macraff_p_sort_element->i_key_size >= TSODLULS_macraff_isize\
+  ){\
+    (i_aff) = 0;\
+    break;\
+  }\
+  if(TSODLULS_macraff_isize > SIZE_MAX - TSODLULS_macraff_p_sort_element->i_key_size){\
     (i_aff) = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;\
     break;\
   }\
-\
-  TSODLULS_macraff_p_void = realloc(\
-      TSODLULS_macraff_p_sort_element->s_key,\
-      TSODLULS_macraff_isize_2 * sizeof(uint8_t)\
-  );\
+  TSODLULS_macraff_isize_2 = TSODLULS_macraff_p_sort_element->i_key_size + TSODLULS_macraff_isize;\
+  if(TSODLULS_macraff_isize_2 < ((TSODLULS_macraff_p_sort_element->i_allocated_size & ~I_KEY_ARENA_FLAG) << 1)){\
+    TSODLULS_macraff_isize_2 = (TSODLULS_macraff_p_sort_element->i_allocated_size & ~I_KEY_ARENA_FLAG) << 1;\
+  }\
+  if(TSODLULS_macraff_isize_2 == 0){\
+    TSODLULS_macraff_isize_2 = 1;\
+  }\
+  TSODLULS_macraff_p_void = calloc(TSODLULS_macraff_isize_2, sizeof(uint8_t));\
   if(TSODLULS_macraff_p_void == NULL){\
     (i_aff) = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;\
     break;\
   }\
+  if(TSODLULS_macraff_p_sort_element->i_key_size > 0){\
+    memcpy(TSODLULS_macraff_p_void, TSODLULS_macraff_p_sort_element->s_key, TSODLULS_macraff_p_sort_element->i_key_size);\
+  }\
   TSODLULS_macraff_p_sort_element->s_key = (uint8_t*) TSODLULS_macraff_p_void;\
   TSODLULS_macraff_p_sort_element->i_allocated_size = TSODLULS_macraff_isize_2;\
   (i_aff) = 0;\
@@ -267,3 +267,134 @@ uint8_t TSODLULS_add_bits_with_bit_level_offset(
 
 
 
+/**
+ * Padding functions
+ * Initialize a padding plan
+ * The padding parameters are checked once and the layouts of the bytes added to a key
+ * are precomputed for uint8, uint16, uint32 and uint64, and for each current offset.
+ * See TSODLULS_add_bytes_to_key_from_uint8_with_padding_plan() and the following functions.
+ */
+int TSODLULS_padding_plan_init(
+  t_TSODLULS_padding_plan* p_plan,
+  int8_t i_number_of_lex_padding_bytes_before,
+  int8_t i_number_of_contrelex_padding_bytes_before,
+  int8_t i_number_of_lex_padding_bytes_after,
+  int8_t i_number_of_contrelex_padding_bytes_after,
+  int8_t i_number_of_contiguous_data_bytes
+){
+  int i_result = 0;
+  size_t arr_i_widths[4] = {1, 2, 4, 8};
+  size_t i_total_size = 0;
+  size_t i_template_start = 0;
+  int8_t i_current_offset = 0;
+  t_TSODLULS_padding_layout* arr_layouts = NULL;
+  t_TSODLULS_padding_layout* p_layout = NULL;
+  t_TSODLULS_sort_element template_element;
+
+  p_plan->arr_layouts_uint8 = NULL;
+  p_plan->arr_layouts_uint16 = NULL;
+  p_plan->arr_layouts_uint32 = NULL;
+  p_plan->arr_layouts_uint64 = NULL;
+  p_plan->s_templates = NULL;
+
+  i_result = TSODLULS_check_padding_parameters(
+      i_number_of_lex_padding_bytes_before,
+      i_number_of_contrelex_padding_bytes_before,
+      i_number_of_lex_padding_bytes_after,
+      i_number_of_contrelex_padding_bytes_after,
+      i_number_of_contiguous_data_bytes,
+      0
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+  p_plan->i_number_of_lex_padding_bytes_before = i_number_of_lex_padding_bytes_before;
+  p_plan->i_number_of_contrelex_padding_bytes_before = i_number_of_contrelex_padding_bytes_before;
+  p_plan->i_number_of_lex_padding_bytes_after = i_number_of_lex_padding_bytes_after;
+  p_plan->i_number_of_contrelex_padding_bytes_after = i_number_of_contrelex_padding_bytes_after;
+  p_plan->i_number_of_contiguous_data_bytes = i_number_of_contiguous_data_bytes;
+
+  //one layout for each width and each current offset
+  arr_layouts = calloc(4 * i_number_of_contiguous_data_bytes, sizeof(t_TSODLULS_padding_layout));
+  if(arr_layouts == NULL){
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  for(size_t i = 0; i < 4; ++i){
+    for(int8_t j = 0; j < i_number_of_contiguous_data_bytes; ++j){
+      p_layout = &(arr_layouts[i * i_number_of_contiguous_data_bytes + j]);
+      p_layout->i_size = TSODLULS_compute_size_needed(
+          arr_i_widths[i],
+          i_number_of_lex_padding_bytes_before,
+          i_number_of_contrelex_padding_bytes_before,
+          i_number_of_lex_padding_bytes_after,
+          i_number_of_contrelex_padding_bytes_after,
+          i_number_of_contiguous_data_bytes,
+          j
+      );
+      i_total_size += p_layout->i_size;
+    }
+  }
+
+  p_plan->s_templates = calloc(i_total_size, sizeof(uint8_t));
+  if(p_plan->s_templates == NULL){
+    TSODLULS_free(arr_layouts);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+
+  //the templates are written with the usual padding function, data bytes are left at 0
+  TSODLULS_init_element(&template_element);
+  template_element.s_key = p_plan->s_templates;
+  template_element.i_allocated_size = i_total_size;
+  for(size_t i = 0; i < 4; ++i){
+    for(int8_t j = 0; j < i_number_of_contiguous_data_bytes; ++j){
+      p_layout = &(arr_layouts[i * i_number_of_contiguous_data_bytes + j]);
+      i_template_start = template_element.i_key_size;
+      p_layout->s_template = p_plan->s_templates + i_template_start;
+      i_current_offset = j;
+      for(size_t k = 0; k < arr_i_widths[i]; ++k){
+        TSODLULS_padd(
+            &template_element,
+            i_number_of_lex_padding_bytes_before,
+            i_number_of_contrelex_padding_bytes_before,
+            i_current_offset
+        );
+        p_layout->arr_data_positions[k] = template_element.i_key_size - i_template_start;
+        template_element.s_key[template_element.i_key_size++] = 0;
+        i_current_offset = (i_current_offset + 1) % i_number_of_contiguous_data_bytes;
+        TSODLULS_padd(
+            &template_element,
+            i_number_of_lex_padding_bytes_after,
+            i_number_of_contrelex_padding_bytes_after,
+            i_current_offset
+        );
+      }
+    }
+  }
+
+  p_plan->arr_layouts_uint8 = arr_layouts;
+  p_plan->arr_layouts_uint16 = arr_layouts + i_number_of_contiguous_data_bytes;
+  p_plan->arr_layouts_uint32 = arr_layouts + 2 * i_number_of_contiguous_data_bytes;
+  p_plan->arr_layouts_uint64 = arr_layouts + 3 * i_number_of_contiguous_data_bytes;
+  return 0;
+}//end function TSODLULS_padding_plan_init()
+
+
+
+/**
+ * Padding functions
+ * Free the layouts of a padding plan
+ */
+void TSODLULS_padding_plan_free(t_TSODLULS_padding_plan* p_plan){
+  if(p_plan->arr_layouts_uint8 != NULL){
+    TSODLULS_free(p_plan->arr_layouts_uint8);
+  }
+  if(p_plan->s_templates != NULL){
+    TSODLULS_free(p_plan->s_templates);
+  }
+  p_plan->arr_layouts_uint16 = NULL;
+  p_plan->arr_layouts_uint32 = NULL;
+  p_plan->arr_layouts_uint64 = NULL;
+}//end function TSODLULS_padding_plan_free()
+
+
+
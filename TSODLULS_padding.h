@@ -107,3 +107,29 @@ uint8_t TSODLULS_add_bits_with_bit_level_offset(
 
 
 
+/**
+ * Padding functions
+ * Initialize a padding plan
+ * The padding parameters are checked once and the layouts of the bytes added to a key
+ * are precomputed for uint8, uint16, uint32 and uint64, and for each current offset.
+ * See TSODLULS_add_bytes_to_key_from_uint8_with_padding_plan() and the following functions.
+ */
+int TSODLULS_padding_plan_init(
+  t_TSODLULS_padding_plan* p_plan,
+  int8_t i_number_of_lex_padding_bytes_before,
+  int8_t i_number_of_contrelex_padding_bytes_before,
+  int8_t i_number_of_lex_padding_bytes_after,
+  int8_t i_number_of_contrelex_padding_bytes_after,
+  int8_t i_number_of_contiguous_data_bytes
+);
+
+
+
+/**
+ * Padding functions
+ * Free the layouts of a padding plan
+ */
+void TSODLULS_padding_plan_free(t_TSODLULS_padding_plan* p_plan);
+
+
+
@@ -0,0 +1,232 @@
+/*
+This file is part of TSODLULS library.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+
+#include "TSODLULS.h"
+
+
+
+//------------------------------------------------------------------------------------
+//Internal functions
+//------------------------------------------------------------------------------------
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_stable)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_insertion)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_radix8_count)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_radix8_count_insertion)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_pdqsort)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_samplesort)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_radix64_short_view)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_prefix8_hybrid)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort__short)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_stable__short)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(TSODLULS_sort_insertion__short)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count__short)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count_insertion__short)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count_network__short)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(TSODLULS_qsort_inlined__short)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(TSODLULS_qsort_vectorized__short)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(TSODLULS_sort_samplesort__short)
+
+
+
+/**
+ * Sort engines functions
+ * Qsort from the C library as a sort engine for long cells
+ */
+static int TSODLULS_qsort__sort_engine(void* arr_elements, size_t i_number_of_elements, uint8_t i_max_length){
+  qsort(
+    arr_elements,
+    i_number_of_elements,
+    sizeof(t_TSODLULS_sort_element),
+    TSODLULS_compare_nextified_key_in_cell_by_words
+  );
+  return 0;
+}//end function TSODLULS_qsort__sort_engine()
+
+
+
+/**
+ * Sort engines functions
+ * Qsort from the C library as a sort engine for short cells
+ */
+static int TSODLULS_qsort__short__sort_engine(void* arr_elements, size_t i_number_of_elements, uint8_t i_max_length){
+  qsort(
+    arr_elements,
+    i_number_of_elements,
+    sizeof(t_TSODLULS_sort_element__short),
+    TSODLULS_compare_nextified_key_in_cell__short
+  );
+  return 0;
+}//end function TSODLULS_qsort__short__sort_engine()
+
+
+
+/**
+ * The radix sorts with insertion sort are not flagged as stable:
+ * their insertion sort for at most 5 elements first swaps the minimum at the beginning, like in glibc.
+ */
+static const t_TSODLULS_sort_engine arr_TSODLULS_sort_engines[] = {
+  TSODLULS_SORT_ENGINE(TSODLULS_sort, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_stable, I_CELL_TYPE__LONG, 1),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_insertion, I_CELL_TYPE__LONG, 1),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count, I_CELL_TYPE__LONG, 1),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_pdqsort, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_samplesort, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix64_short_view, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_prefix8_hybrid, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_qsort, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort__short, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_stable__short, I_CELL_TYPE__SHORT, 1),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_insertion__short, I_CELL_TYPE__SHORT, 1),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count__short, I_CELL_TYPE__SHORT, 1),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__short, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_network__short, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_qsort_inlined__short, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_qsort_vectorized__short, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_samplesort__short, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_qsort__short, I_CELL_TYPE__SHORT, 0),
+};
+
+#define I_NUMBER_OF_BUILTIN_SORT_ENGINES (sizeof(arr_TSODLULS_sort_engines) / sizeof(t_TSODLULS_sort_engine))
+
+static t_TSODLULS_sort_engine* arr_TSODLULS_registered_sort_engines = NULL;
+static size_t i_TSODLULS_number_of_registered_sort_engines = 0;
+static size_t i_TSODLULS_allocated_registered_sort_engines = 0;
+
+
+
+//------------------------------------------------------------------------------------
+//External functions
+//------------------------------------------------------------------------------------
+/**
+ * Sort engines functions
+ * Returns the number of sort engines: the engines of this library, then the registered engines
+ */
+size_t TSODLULS_get_number_of_sort_engines(){
+  return I_NUMBER_OF_BUILTIN_SORT_ENGINES + i_TSODLULS_number_of_registered_sort_engines;
+}//end function TSODLULS_get_number_of_sort_engines()
+
+
+
+/**
+ * Sort engines functions
+ * Returns the sort engine at this index (see TSODLULS_get_number_of_sort_engines()), or NULL
+ */
+const t_TSODLULS_sort_engine* TSODLULS_get_sort_engine(size_t i_index){
+  if(i_index < I_NUMBER_OF_BUILTIN_SORT_ENGINES){
+    return &(arr_TSODLULS_sort_engines[i_index]);
+  }
+  i_index -= I_NUMBER_OF_BUILTIN_SORT_ENGINES;
+  if(i_index < i_TSODLULS_number_of_registered_sort_engines){
+    return &(arr_TSODLULS_registered_sort_engines[i_index]);
+  }
+  return NULL;
+}//end function TSODLULS_get_sort_engine()
+
+
+
+/**
+ * Sort engines functions
+ * Returns the sort engine with this name, or NULL
+ */
+const t_TSODLULS_sort_engine* TSODLULS_find_sort_engine(const char* s_name){
+  size_t i_number_of_engines = TSODLULS_get_number_of_sort_engines();
+  for(size_t i = 0; i < i_number_of_engines; ++i){
+    const t_TSODLULS_sort_engine* p_engine = TSODLULS_get_sort_engine(i);
+    if(strcmp(p_engine->s_name, s_name) == 0){
+      return p_engine;
+    }
+  }
+  return NULL;
+}//end function TSODLULS_find_sort_engine()
+
+
+
+/**
+ * Sort engines functions
+ * Add a sort engine to the registry, the engine is copied but not its name.
+ * Returns I_ERROR__SORT_ENGINE_NAME_ALREADY_USED if an engine with the same name exists.
+ * The registry is not thread safe: register the engines before the threads start sorting.
+ */
+int TSODLULS_register_sort_engine(const t_TSODLULS_sort_engine* p_engine){
+  size_t i_number_of_elements_for_realloc = 0;
+  void* p_for_realloc = NULL;
+
+  if(TSODLULS_find_sort_engine(p_engine->s_name) != NULL){
+    return I_ERROR__SORT_ENGINE_NAME_ALREADY_USED;
+  }
+  if(i_TSODLULS_number_of_registered_sort_engines == i_TSODLULS_allocated_registered_sort_engines){
+    i_number_of_elements_for_realloc = i_TSODLULS_allocated_registered_sort_engines == 0 ?
+        16 : i_TSODLULS_allocated_registered_sort_engines << 1;
+    if(i_number_of_elements_for_realloc > SIZE_MAX / sizeof(t_TSODLULS_sort_engine)){
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    p_for_realloc = realloc(
+        arr_TSODLULS_registered_sort_engines,
+        i_number_of_elements_for_realloc * sizeof(t_TSODLULS_sort_engine)
+    );
+    if(p_for_realloc == NULL){
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    arr_TSODLULS_registered_sort_engines = (t_TSODLULS_sort_engine*) p_for_realloc;
+    i_TSODLULS_allocated_registered_sort_engines = i_number_of_elements_for_realloc;
+  }
+  arr_TSODLULS_registered_sort_engines[i_TSODLULS_number_of_registered_sort_engines] = *p_engine;
+  ++i_TSODLULS_number_of_registered_sort_engines;
+  return 0;
+}//end function TSODLULS_register_sort_engine()
+
+
+
+/**
+ * Sort engines functions
+ * Free the memory used by the registered engines, the engines of this library remain.
+ */
+void TSODLULS_free_registered_sort_engines(){
+  free(arr_TSODLULS_registered_sort_engines);
+  arr_TSODLULS_registered_sort_engines = NULL;
+  i_TSODLULS_number_of_registered_sort_engines = 0;
+  i_TSODLULS_allocated_registered_sort_engines = 0;
+}//end function TSODLULS_free_registered_sort_engines()
+
+
+
+/**
+ * Sort engines functions
+ * Sort with the engine of this name,
+ * arr_elements is an array of t_TSODLULS_sort_element or t_TSODLULS_sort_element__short
+ * depending on the cell type of the engine (see t_TSODLULS_sort_engine).
+ * Returns I_ERROR__UNKNOWN_SORT_ENGINE if there is no engine with this name.
+ */
+int TSODLULS_sort_with_engine(
+  const char* s_name,
+  void* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+){
+  const t_TSODLULS_sort_engine* p_engine = TSODLULS_find_sort_engine(s_name);
+  if(p_engine == NULL){
+    return I_ERROR__UNKNOWN_SORT_ENGINE;
+  }
+  return p_engine->f_sort(arr_elements, i_number_of_elements, i_max_length);
+}//end function TSODLULS_sort_with_engine()
+
+
+
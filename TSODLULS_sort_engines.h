@@ -0,0 +1,77 @@
+/*
+This file is part of TSODLULS library.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+
+//------------------------------------------------------------------------------------
+//Sort engines
+//------------------------------------------------------------------------------------
+/**
+ * Sort engines functions
+ * Returns the number of sort engines: the engines of this library, then the registered engines
+ */
+size_t TSODLULS_get_number_of_sort_engines();
+
+
+
+/**
+ * Sort engines functions
+ * Returns the sort engine at this index (see TSODLULS_get_number_of_sort_engines()), or NULL
+ */
+const t_TSODLULS_sort_engine* TSODLULS_get_sort_engine(size_t i_index);
+
+
+
+/**
+ * Sort engines functions
+ * Returns the sort engine with this name, or NULL
+ */
+const t_TSODLULS_sort_engine* TSODLULS_find_sort_engine(const char* s_name);
+
+
+
+/**
+ * Sort engines functions
+ * Add a sort engine to the registry, the engine is copied but not its name.
+ * Returns I_ERROR__SORT_ENGINE_NAME_ALREADY_USED if an engine with the same name exists.
+ * The registry is not thread safe: register the engines before the threads start sorting.
+ */
+int TSODLULS_register_sort_engine(const t_TSODLULS_sort_engine* p_engine);
+
+
+
+/**
+ * Sort engines functions
+ * Free the memory used by the registered engines, the engines of this library remain.
+ */
+void TSODLULS_free_registered_sort_engines();
+
+
+
+/**
+ * Sort engines functions
+ * Sort with the engine of this name,
+ * arr_elements is an array of t_TSODLULS_sort_element or t_TSODLULS_sort_element__short
+ * depending on the cell type of the engine (see t_TSODLULS_sort_engine).
+ * Returns I_ERROR__UNKNOWN_SORT_ENGINE if there is no engine with this name.
+ */
+int TSODLULS_sort_with_engine(
+  const char* s_name,
+  void* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
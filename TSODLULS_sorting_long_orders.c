@@ -17,7 +17,1500 @@ along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
 ©Copyright 2018-2019 Laurent Lyaudet
 */
 
+#define _GNU_SOURCE//pthread_setaffinity_np() and CPU_SET() for TSODLULS_sort_parallel_numa()
 #include "TSODLULS.h"
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+
+
+
+//------------------------------------------------------------------------------------
+//Internal functions
+//------------------------------------------------------------------------------------
+/**
+ * Sorting functions for long nextified strings
+ * TSODLULS_sort_radix8_count_insertion() in buffers given by the caller,
+ * so that they can be shared by many sorts: arr_elements_copy has room for i_number_of_elements cells
+ * and *p_arr_instances for *p_i_max_number_of_instances instances (at least 1).
+ * The stack of instances is reallocated when needed, the caller frees it even after an error.
+ * The buffers are not used when there is at most 5 elements.
+ */
+static int TSODLULS_sort_radix8_count_insertion_in_buffers(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  t_TSODLULS_sort_element* arr_elements_copy,
+  t_TSODLULS_radix_instance** p_arr_instances,
+  size_t* p_i_max_number_of_instances
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The function of the threads of TSODLULS_sort_segmented_parallel()
+ */
+static void* TSODLULS_sort_segmented_task(void* p_task){
+  t_TSODLULS_segmented_sort_task* p_segmented_sort_task = (t_TSODLULS_segmented_sort_task*) p_task;
+  p_segmented_sort_task->i_result = TSODLULS_sort_segmented(
+      (t_TSODLULS_sort_element*) p_segmented_sort_task->arr_elements,
+      p_segmented_sort_task->arr_segment_offsets,
+      p_segmented_sort_task->i_number_of_segments
+  );
+  return NULL;
+}//end function TSODLULS_sort_segmented_task()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Key order of two cells for TSODLULS_pdqsort(): memcmp() on the common length,
+ * then the shortest key first.
+ */
+static inline int TSODLULS_is_key_smaller(
+  const t_TSODLULS_sort_element* p_cell1,
+  const t_TSODLULS_sort_element* p_cell2
+){
+  int i_result;
+  uint64_t TSODLULS_macraff_ui64;
+  uint64_t TSODLULS_macraff_ui64_2;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+  TSODLULS_compare_nextified_keys_in_cells__macraff(i_result, p_cell1, p_cell2, 0);
+  return i_result < 0;
+}//end function TSODLULS_is_key_smaller()
+
+
+
+#define TSODLULS_swap_cells(p_cell1, p_cell2) \
+  tmp_cell = *(p_cell1); *(p_cell1) = *(p_cell2); *(p_cell2) = tmp_cell
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Insertion sort of the cells from begin included to end excluded for TSODLULS_pdqsort().
+ * If b_guarded is 0, the cell before begin must not be greater than the other cells.
+ * If i_limit is not 0, it stops and returns 0 as soon as more than i_limit cells were moved,
+ * otherwise it returns 1.
+ */
+static inline int TSODLULS_pdqsort_insertion_sort(
+  t_TSODLULS_sort_element* begin,
+  t_TSODLULS_sort_element* end,
+  unsigned int b_guarded,
+  size_t i_limit
+){
+  t_TSODLULS_sort_element tmp_cell;
+  t_TSODLULS_sort_element* sift;
+  t_TSODLULS_sort_element* sift_1;
+  size_t i_moved = 0;
+
+  if(begin == end){
+    return 1;
+  }
+
+  for(t_TSODLULS_sort_element* cur = begin + 1; cur != end; ++cur){
+    if(i_limit != 0 && i_moved > i_limit){
+      return 0;
+    }
+    sift = cur;
+    sift_1 = cur - 1;
+    if(TSODLULS_is_key_smaller(sift, sift_1)){
+      tmp_cell = *sift;
+      do{
+        *sift = *sift_1;
+        --sift;
+      }
+      while((!b_guarded || sift != begin) && TSODLULS_is_key_smaller(&tmp_cell, --sift_1));
+      *sift = tmp_cell;
+      i_moved += (size_t)(cur - sift);
+    }
+  }
+  return 1;
+}//end function TSODLULS_pdqsort_insertion_sort()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Sorts 3 cells for the choice of the pivot of TSODLULS_pdqsort().
+ */
+static inline void TSODLULS_pdqsort_sort3(
+  t_TSODLULS_sort_element* p_cell1,
+  t_TSODLULS_sort_element* p_cell2,
+  t_TSODLULS_sort_element* p_cell3
+){
+  t_TSODLULS_sort_element tmp_cell;
+  if(TSODLULS_is_key_smaller(p_cell2, p_cell1)){
+    TSODLULS_swap_cells(p_cell1, p_cell2);
+  }
+  if(TSODLULS_is_key_smaller(p_cell3, p_cell2)){
+    TSODLULS_swap_cells(p_cell2, p_cell3);
+  }
+  if(TSODLULS_is_key_smaller(p_cell2, p_cell1)){
+    TSODLULS_swap_cells(p_cell1, p_cell2);
+  }
+}//end function TSODLULS_pdqsort_sort3()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Heapsort of the cells from begin included to end excluded,
+ * when TSODLULS_pdqsort() found too many bad partitions.
+ */
+static void TSODLULS_pdqsort_heapsort(t_TSODLULS_sort_element* begin, t_TSODLULS_sort_element* end){
+  t_TSODLULS_sort_element tmp_cell;
+  size_t i_number_of_elements = (size_t)(end - begin);
+  size_t i_parent = 0;
+  size_t i_child = 0;
+
+#define TSODLULS_pdqsort_sift_down(i_root, i_size) \
+  i_parent = (i_root);\
+  while((i_child = 2 * i_parent + 1) < (i_size)){\
+    if(i_child + 1 < (i_size) && TSODLULS_is_key_smaller(&(begin[i_child]), &(begin[i_child + 1]))){\
+      ++i_child;\
+    }\
+    if(!TSODLULS_is_key_smaller(&(begin[i_parent]), &(begin[i_child]))){\
+      break;\
+    }\
+    TSODLULS_swap_cells(&(begin[i_parent]), &(begin[i_child]));\
+    i_parent = i_child;\
+  }
+
+  for(size_t i = i_number_of_elements / 2; i > 0; --i){
+    TSODLULS_pdqsort_sift_down(i - 1, i_number_of_elements);
+  }
+  for(size_t i = i_number_of_elements; i > 1; --i){
+    TSODLULS_swap_cells(&(begin[0]), &(begin[i - 1]));
+    TSODLULS_pdqsort_sift_down(0, i - 1);
+  }
+
+#undef TSODLULS_pdqsort_sift_down
+}//end function TSODLULS_pdqsort_heapsort()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The loop of TSODLULS_pdqsort() on the cells from begin included to end excluded.
+ * b_leftmost is 0 when the cell before begin is not greater than the other cells.
+ * After i_bad_allowed highly unbalanced partitions, the cells are sorted by heapsort.
+ */
+static void TSODLULS_pdqsort_loop(
+  t_TSODLULS_sort_element* begin,
+  t_TSODLULS_sort_element* end,
+  size_t i_bad_allowed,
+  unsigned int b_leftmost
+){
+  t_TSODLULS_sort_element tmp_cell;
+  t_TSODLULS_sort_element pivot;
+  t_TSODLULS_sort_element* first;
+  t_TSODLULS_sort_element* last;
+  t_TSODLULS_sort_element* pivot_pos;
+  size_t i_size = 0;
+  size_t i_half = 0;
+  size_t i_left_size = 0;
+  size_t i_right_size = 0;
+  unsigned int b_already_partitioned = 0;
+
+  while(1){
+    i_size = (size_t)(end - begin);
+    if(i_size < I_PDQSORT_INSERTION_THRESHOLD){
+      TSODLULS_pdqsort_insertion_sort(begin, end, b_leftmost, 0);
+      return;
+    }
+
+    //pivot in begin, median of 3 or pseudomedian of 9
+    i_half = i_size / 2;
+    if(i_size > I_PDQSORT_NINTHER_THRESHOLD){
+      TSODLULS_pdqsort_sort3(begin, begin + i_half, end - 1);
+      TSODLULS_pdqsort_sort3(begin + 1, begin + (i_half - 1), end - 2);
+      TSODLULS_pdqsort_sort3(begin + 2, begin + (i_half + 1), end - 3);
+      TSODLULS_pdqsort_sort3(begin + (i_half - 1), begin + i_half, begin + (i_half + 1));
+      TSODLULS_swap_cells(begin, begin + i_half);
+    }
+    else{
+      TSODLULS_pdqsort_sort3(begin + i_half, begin, end - 1);
+    }
+
+    //if the pivot is equal to the cell before begin, the cells equal to the pivot go left and are sorted
+    if(!b_leftmost && !TSODLULS_is_key_smaller(begin - 1, begin)){
+      pivot = *begin;
+      first = begin;
+      last = end;
+      while(TSODLULS_is_key_smaller(&pivot, --last));
+      if(last + 1 == end){
+        while(first < last && !TSODLULS_is_key_smaller(&pivot, ++first));
+      }
+      else{
+        while(!TSODLULS_is_key_smaller(&pivot, ++first));
+      }
+      while(first < last){
+        TSODLULS_swap_cells(first, last);
+        while(TSODLULS_is_key_smaller(&pivot, --last));
+        while(!TSODLULS_is_key_smaller(&pivot, ++first));
+      }
+      *begin = *last;
+      *last = pivot;
+      begin = last + 1;
+      continue;
+    }
+
+    //partition: the cells smaller than the pivot go left
+    pivot = *begin;
+    first = begin;
+    last = end;
+    while(TSODLULS_is_key_smaller(++first, &pivot));
+    if(first - 1 == begin){
+      while(first < last && !TSODLULS_is_key_smaller(--last, &pivot));
+    }
+    else{
+      while(!TSODLULS_is_key_smaller(--last, &pivot));
+    }
+    b_already_partitioned = first >= last;
+    while(first < last){
+      TSODLULS_swap_cells(first, last);
+      while(TSODLULS_is_key_smaller(++first, &pivot));
+      while(!TSODLULS_is_key_smaller(--last, &pivot));
+    }
+    pivot_pos = first - 1;
+    *begin = *pivot_pos;
+    *pivot_pos = pivot;
+
+    i_left_size = (size_t)(pivot_pos - begin);
+    i_right_size = (size_t)(end - (pivot_pos + 1));
+    if(i_left_size < i_size / 8 || i_right_size < i_size / 8){
+      //highly unbalanced partition, some cells are swapped to break the patterns
+      if(--i_bad_allowed == 0){
+        TSODLULS_pdqsort_heapsort(begin, end);
+        return;
+      }
+      if(i_left_size >= I_PDQSORT_INSERTION_THRESHOLD){
+        TSODLULS_swap_cells(begin, begin + i_left_size / 4);
+        TSODLULS_swap_cells(pivot_pos - 1, pivot_pos - i_left_size / 4);
+        if(i_left_size > I_PDQSORT_NINTHER_THRESHOLD){
+          TSODLULS_swap_cells(begin + 1, begin + (i_left_size / 4 + 1));
+          TSODLULS_swap_cells(begin + 2, begin + (i_left_size / 4 + 2));
+          TSODLULS_swap_cells(pivot_pos - 2, pivot_pos - (i_left_size / 4 + 1));
+          TSODLULS_swap_cells(pivot_pos - 3, pivot_pos - (i_left_size / 4 + 2));
+        }
+      }
+      if(i_right_size >= I_PDQSORT_INSERTION_THRESHOLD){
+        TSODLULS_swap_cells(pivot_pos + 1, pivot_pos + (1 + i_right_size / 4));
+        TSODLULS_swap_cells(end - 1, end - i_right_size / 4);
+        if(i_right_size > I_PDQSORT_NINTHER_THRESHOLD){
+          TSODLULS_swap_cells(pivot_pos + 2, pivot_pos + (2 + i_right_size / 4));
+          TSODLULS_swap_cells(pivot_pos + 3, pivot_pos + (3 + i_right_size / 4));
+          TSODLULS_swap_cells(end - 2, end - (1 + i_right_size / 4));
+          TSODLULS_swap_cells(end - 3, end - (2 + i_right_size / 4));
+        }
+      }
+    }
+    else if(
+      b_already_partitioned
+      && TSODLULS_pdqsort_insertion_sort(begin, pivot_pos, 1, I_PDQSORT_PARTIAL_INSERTION_LIMIT)
+      && TSODLULS_pdqsort_insertion_sort(pivot_pos + 1, end, 1, I_PDQSORT_PARTIAL_INSERTION_LIMIT)
+    ){
+      return;//the cells were almost sorted
+    }
+
+    //recursion on the left part and loop on the right part
+    TSODLULS_pdqsort_loop(begin, pivot_pos, i_bad_allowed, b_leftmost);
+    begin = pivot_pos + 1;
+    b_leftmost = 0;
+  }//end while(1)
+}//end function TSODLULS_pdqsort_loop()
+
+#undef TSODLULS_swap_cells
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Free the buffers of a samplesort (see TSODLULS_samplesort_init())
+ */
+static void TSODLULS_samplesort_free(t_TSODLULS_samplesort* p_samplesort){
+  if(p_samplesort->arr_threads != NULL){
+    for(size_t i = 0; i < p_samplesort->i_number_of_threads; ++i){
+      TSODLULS_free(p_samplesort->arr_threads[i].arr_buffers);
+      TSODLULS_free(p_samplesort->arr_threads[i].arr_buffer_counts);
+      TSODLULS_free(p_samplesort->arr_threads[i].arr_bucket_sizes);
+      TSODLULS_free(p_samplesort->arr_threads[i].arr_swap_buffers);
+    }
+  }
+  if(p_samplesort->arr_mutexes != NULL){
+    for(size_t i = 0; i < I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS; ++i){
+      pthread_mutex_destroy(&(p_samplesort->arr_mutexes[i]));
+    }
+    pthread_mutex_destroy(&(p_samplesort->next_bucket_mutex));
+  }
+  TSODLULS_free(p_samplesort->arr_threads);
+  TSODLULS_free(p_samplesort->arr_mutexes);
+  TSODLULS_free(p_samplesort->arr_tree);
+  TSODLULS_free(p_samplesort->arr_splitters);
+  TSODLULS_free(p_samplesort->arr_overflow);
+  TSODLULS_free(p_samplesort->arr_bucket_starts);
+  TSODLULS_free(p_samplesort->arr_bucket_writes);
+  TSODLULS_free(p_samplesort->arr_bucket_reads);
+  TSODLULS_free(p_samplesort->arr_pending_reads);
+}//end function TSODLULS_samplesort_free()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Allocate the buffers of a samplesort with i_number_of_threads threads,
+ * they do not depend on the number of elements to sort.
+ */
+static int TSODLULS_samplesort_init(t_TSODLULS_samplesort* p_samplesort, size_t i_number_of_threads){
+  pthread_mutex_t* arr_mutexes = NULL;
+  unsigned int b_allocated = 1;
+
+  memset(p_samplesort, 0, sizeof(t_TSODLULS_samplesort));
+  p_samplesort->i_number_of_threads = i_number_of_threads;
+  p_samplesort->i_random = 0x9E3779B97F4A7C15ull;
+  p_samplesort->arr_tree = calloc(I_SAMPLESORT_MAX_NUMBER_OF_LEAVES, sizeof(t_TSODLULS_sort_element));
+  p_samplesort->arr_splitters = calloc(I_SAMPLESORT_MAX_NUMBER_OF_LEAVES, sizeof(t_TSODLULS_sort_element));
+  p_samplesort->arr_overflow = calloc(I_SAMPLESORT_BLOCK_SIZE, sizeof(t_TSODLULS_sort_element));
+  p_samplesort->arr_bucket_starts = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS + 1, sizeof(size_t));
+  p_samplesort->arr_bucket_writes = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(size_t));
+  p_samplesort->arr_bucket_reads = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(size_t));
+  p_samplesort->arr_pending_reads = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(size_t));
+  p_samplesort->arr_threads = calloc(i_number_of_threads, sizeof(t_TSODLULS_samplesort_thread));
+  if(
+    p_samplesort->arr_tree == NULL
+    || p_samplesort->arr_splitters == NULL
+    || p_samplesort->arr_overflow == NULL
+    || p_samplesort->arr_bucket_starts == NULL
+    || p_samplesort->arr_bucket_writes == NULL
+    || p_samplesort->arr_bucket_reads == NULL
+    || p_samplesort->arr_pending_reads == NULL
+    || p_samplesort->arr_threads == NULL
+  ){
+    TSODLULS_samplesort_free(p_samplesort);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+
+  for(size_t i = 0; i < i_number_of_threads; ++i){
+    t_TSODLULS_samplesort_thread* p_thread = &(p_samplesort->arr_threads[i]);
+    p_thread->p_samplesort = p_samplesort;
+    p_thread->i_thread = i;
+    p_thread->arr_buffers = calloc(
+        I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS * I_SAMPLESORT_BLOCK_SIZE,
+        sizeof(t_TSODLULS_sort_element)
+    );
+    p_thread->arr_buffer_counts = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(size_t));
+    p_thread->arr_bucket_sizes = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(size_t));
+    p_thread->arr_swap_buffers = calloc(2 * I_SAMPLESORT_BLOCK_SIZE, sizeof(t_TSODLULS_sort_element));
+    if(
+      p_thread->arr_buffers == NULL
+      || p_thread->arr_buffer_counts == NULL
+      || p_thread->arr_bucket_sizes == NULL
+      || p_thread->arr_swap_buffers == NULL
+    ){
+      b_allocated = 0;
+    }
+  }
+
+  //the mutexes are destroyed by TSODLULS_samplesort_free() only if they were all initialized
+  arr_mutexes = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(pthread_mutex_t));
+  if(!b_allocated || arr_mutexes == NULL){
+    TSODLULS_free(arr_mutexes);
+    TSODLULS_samplesort_free(p_samplesort);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  for(size_t i = 0; i < I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS; ++i){
+    pthread_mutex_init(&(arr_mutexes[i]), NULL);
+  }
+  pthread_mutex_init(&(p_samplesort->next_bucket_mutex), NULL);
+  p_samplesort->arr_mutexes = arr_mutexes;
+
+  return 0;
+}//end function TSODLULS_samplesort_init()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Xorshift generator of the samples of the samplesort
+ */
+static inline uint64_t TSODLULS_samplesort_random(t_TSODLULS_samplesort* p_samplesort){
+  p_samplesort->i_random ^= p_samplesort->i_random << 13;
+  p_samplesort->i_random ^= p_samplesort->i_random >> 7;
+  p_samplesort->i_random ^= p_samplesort->i_random << 17;
+  return p_samplesort->i_random;
+}//end function TSODLULS_samplesort_random()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Choose the splitters of the samplesort in a random sample moved at the beginning of the array,
+ * without duplicates, and build the search tree.
+ * The number of leaves is the smallest power of two above the number of splitters,
+ * the last splitter is repeated to fill the tree.
+ */
+static void TSODLULS_samplesort_build_tree(
+  t_TSODLULS_samplesort* p_samplesort,
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+){
+  t_TSODLULS_sort_element* arr_tree = (t_TSODLULS_sort_element*) p_samplesort->arr_tree;
+  t_TSODLULS_sort_element* arr_splitters = (t_TSODLULS_sort_element*) p_samplesort->arr_splitters;
+  t_TSODLULS_sort_element tmp_cell;
+  int i_comparison = 0;
+  uint64_t TSODLULS_macraff_ui64;
+  uint64_t TSODLULS_macraff_ui64_2;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+  size_t i_log2 = 0;
+  size_t i_sample_size = 0;
+  size_t i_number_of_splitters = 0;
+  size_t i_log2_number_of_leaves = 1;
+  size_t i_number_of_leaves = 0;
+  size_t j = 0;
+
+  //oversampling factor of 0.2 * log2(n) as in IPS4o
+  for(size_t i = i_number_of_elements; i > 1; i >>= 1){
+    ++i_log2;
+  }
+  i_sample_size = (i_log2 < 10 ? 1 : i_log2 / 5) * I_SAMPLESORT_MAX_NUMBER_OF_LEAVES;
+  if(i_sample_size > i_number_of_elements){
+    i_sample_size = i_number_of_elements;
+  }
+  for(size_t i = 0; i < i_sample_size; ++i){
+    j = i + TSODLULS_samplesort_random(p_samplesort) % (i_number_of_elements - i);
+    tmp_cell = arr_elements[i]; arr_elements[i] = arr_elements[j]; arr_elements[j] = tmp_cell;//swapping
+  }
+  TSODLULS_pdqsort(arr_elements, i_sample_size);
+
+  for(size_t i = 1; i < I_SAMPLESORT_MAX_NUMBER_OF_LEAVES; ++i){
+    j = i * i_sample_size / I_SAMPLESORT_MAX_NUMBER_OF_LEAVES;
+    if(j == 0){
+      continue;
+    }
+    if(i_number_of_splitters > 0){
+      TSODLULS_compare_nextified_keys_in_cells__macraff(
+          i_comparison,
+          &(arr_elements[j - 1]),
+          &(arr_splitters[i_number_of_splitters]),
+          0
+      );
+    }
+    if(i_number_of_splitters == 0 || i_comparison != 0){
+      arr_splitters[++i_number_of_splitters] = arr_elements[j - 1];
+    }
+  }
+  if(i_number_of_splitters == 0){
+    arr_splitters[++i_number_of_splitters] = arr_elements[0];
+  }
+  while(((size_t)1 << i_log2_number_of_leaves) <= i_number_of_splitters){
+    ++i_log2_number_of_leaves;
+  }
+  i_number_of_leaves = (size_t)1 << i_log2_number_of_leaves;
+  for(size_t i = i_number_of_splitters + 1; i < i_number_of_leaves; ++i){
+    arr_splitters[i] = arr_splitters[i_number_of_splitters];
+  }
+
+  for(size_t i_level = 0; i_level < i_log2_number_of_leaves; ++i_level){
+    for(size_t i = (size_t)1 << i_level; i < (size_t)2 << i_level; ++i){
+      arr_tree[i] = arr_splitters[((2 * (i - ((size_t)1 << i_level)) + 1) * i_number_of_leaves) >> (i_level + 1)];
+    }
+  }
+  p_samplesort->i_log2_number_of_leaves = i_log2_number_of_leaves;
+  p_samplesort->i_number_of_buckets = 2 * i_number_of_leaves - 1;
+}//end function TSODLULS_samplesort_build_tree()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Bucket of a cell in the search tree of the samplesort.
+ * After the descent in the tree, j is the number of splitters smaller than or equal to the key.
+ */
+static inline size_t TSODLULS_samplesort_classify(
+  const t_TSODLULS_samplesort* p_samplesort,
+  const t_TSODLULS_sort_element* p_cell
+){
+  const t_TSODLULS_sort_element* arr_tree = (const t_TSODLULS_sort_element*) p_samplesort->arr_tree;
+  const t_TSODLULS_sort_element* arr_splitters = (const t_TSODLULS_sort_element*) p_samplesort->arr_splitters;
+  size_t i_node = 1;
+  size_t j = 0;
+  int i_comparison = 0;
+  uint64_t TSODLULS_macraff_ui64;
+  uint64_t TSODLULS_macraff_ui64_2;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+  for(size_t i_level = 0; i_level < p_samplesort->i_log2_number_of_leaves; ++i_level){
+    TSODLULS_compare_nextified_keys_in_cells__macraff(i_comparison, &(arr_tree[i_node]), p_cell, 0);
+    i_node = 2 * i_node + (i_comparison <= 0);
+  }
+  j = i_node - ((size_t)1 << p_samplesort->i_log2_number_of_leaves);
+  if(j == 0){
+    return 0;
+  }
+  TSODLULS_compare_nextified_keys_in_cells__macraff(i_comparison, &(arr_splitters[j]), p_cell, 0);
+  return 2 * j - (i_comparison == 0);
+}//end function TSODLULS_samplesort_classify()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The function of the threads for the classification of the samplesort:
+ * the cells of the stripe of the thread are classified in the buffers of the buckets,
+ * and each full buffer is written back as a block at the beginning of the stripe.
+ */
+static void* TSODLULS_samplesort_classify_task(void* p_task){
+  t_TSODLULS_samplesort_thread* p_thread = (t_TSODLULS_samplesort_thread*) p_task;
+  const t_TSODLULS_samplesort* p_samplesort = p_thread->p_samplesort;
+  t_TSODLULS_sort_element* arr_elements = (t_TSODLULS_sort_element*) p_samplesort->arr_elements;
+  t_TSODLULS_sort_element* arr_buffers = (t_TSODLULS_sort_element*) p_thread->arr_buffers;
+  size_t* arr_buffer_counts = p_thread->arr_buffer_counts;
+  size_t* arr_bucket_sizes = p_thread->arr_bucket_sizes;
+  size_t i_write = p_thread->i_stripe_first;
+  size_t i_bucket = 0;
+
+  memset(arr_buffer_counts, 0, p_samplesort->i_number_of_buckets * sizeof(size_t));
+  memset(arr_bucket_sizes, 0, p_samplesort->i_number_of_buckets * sizeof(size_t));
+
+  //at most one block per bucket is buffered, hence the blocks written never overlap the unread cells
+  for(size_t i = p_thread->i_stripe_first; i < p_thread->i_stripe_end; ++i){
+    i_bucket = TSODLULS_samplesort_classify(p_samplesort, &(arr_elements[i]));
+    arr_buffers[i_bucket * I_SAMPLESORT_BLOCK_SIZE + arr_buffer_counts[i_bucket]] = arr_elements[i];
+    if(++arr_buffer_counts[i_bucket] == I_SAMPLESORT_BLOCK_SIZE){
+      memcpy(
+          &(arr_elements[i_write]),
+          &(arr_buffers[i_bucket * I_SAMPLESORT_BLOCK_SIZE]),
+          I_SAMPLESORT_BLOCK_SIZE * sizeof(t_TSODLULS_sort_element)
+      );
+      i_write += I_SAMPLESORT_BLOCK_SIZE;
+      arr_buffer_counts[i_bucket] = 0;
+      arr_bucket_sizes[i_bucket] += I_SAMPLESORT_BLOCK_SIZE;
+    }
+  }
+
+  for(size_t b = 0; b < p_samplesort->i_number_of_buckets; ++b){
+    arr_bucket_sizes[b] += arr_buffer_counts[b];
+  }
+  p_thread->i_number_of_full_blocks = (i_write - p_thread->i_stripe_first) / I_SAMPLESORT_BLOCK_SIZE;
+  return NULL;
+}//end function TSODLULS_samplesort_classify_task()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The function of the threads for the permutation of the blocks of the samplesort.
+ * Each bucket has a write pointer and a read pointer on block boundaries:
+ * the blocks before the write pointer are in place, the blocks between the write pointer
+ * and the read pointer are not processed yet, and the blocks after are empty.
+ * A thread reads the last unprocessed block of a bucket and writes it at the write pointer of its bucket,
+ * if an unprocessed block was there, it is swapped and its own bucket is processed the same way.
+ * A block is only written at an empty place once the pending reads of its bucket are done.
+ */
+static void* TSODLULS_samplesort_permute_task(void* p_task){
+  t_TSODLULS_samplesort_thread* p_thread = (t_TSODLULS_samplesort_thread*) p_task;
+  t_TSODLULS_samplesort* p_samplesort = p_thread->p_samplesort;
+  t_TSODLULS_sort_element* arr_elements = (t_TSODLULS_sort_element*) p_samplesort->arr_elements;
+  t_TSODLULS_sort_element* p_block = (t_TSODLULS_sort_element*) p_thread->arr_swap_buffers;
+  t_TSODLULS_sort_element* p_other_block = p_block + I_SAMPLESORT_BLOCK_SIZE;
+  t_TSODLULS_sort_element* p_tmp_block = NULL;
+  size_t i_number_of_buckets = p_samplesort->i_number_of_buckets;
+  size_t i_bucket = p_thread->i_thread * i_number_of_buckets / p_samplesort->i_number_of_threads;
+  size_t i_target = 0;
+  size_t i_read = 0;
+  size_t i_write = 0;
+  size_t i_read_end = 0;
+  size_t i_pending_reads = 0;
+
+  for(size_t i = 0; i < i_number_of_buckets; ++i){
+    while(1){
+      pthread_mutex_lock(&(p_samplesort->arr_mutexes[i_bucket]));
+      if(p_samplesort->arr_bucket_reads[i_bucket] <= p_samplesort->arr_bucket_writes[i_bucket]){
+        pthread_mutex_unlock(&(p_samplesort->arr_mutexes[i_bucket]));
+        break;
+      }
+      p_samplesort->arr_bucket_reads[i_bucket] -= I_SAMPLESORT_BLOCK_SIZE;
+      i_read = p_samplesort->arr_bucket_reads[i_bucket];
+      ++p_samplesort->arr_pending_reads[i_bucket];
+      pthread_mutex_unlock(&(p_samplesort->arr_mutexes[i_bucket]));
+      memcpy(p_block, &(arr_elements[i_read]), I_SAMPLESORT_BLOCK_SIZE * sizeof(t_TSODLULS_sort_element));
+      pthread_mutex_lock(&(p_samplesort->arr_mutexes[i_bucket]));
+      --p_samplesort->arr_pending_reads[i_bucket];
+      pthread_mutex_unlock(&(p_samplesort->arr_mutexes[i_bucket]));
+
+      while(1){
+        i_target = TSODLULS_samplesort_classify(p_samplesort, &(p_block[0]));
+        pthread_mutex_lock(&(p_samplesort->arr_mutexes[i_target]));
+        i_write = p_samplesort->arr_bucket_writes[i_target];
+        p_samplesort->arr_bucket_writes[i_target] += I_SAMPLESORT_BLOCK_SIZE;
+        i_read_end = p_samplesort->arr_bucket_reads[i_target];
+        pthread_mutex_unlock(&(p_samplesort->arr_mutexes[i_target]));
+        if(i_write < i_read_end){
+          //an unprocessed block is swapped
+          memcpy(
+              p_other_block,
+              &(arr_elements[i_write]),
+              I_SAMPLESORT_BLOCK_SIZE * sizeof(t_TSODLULS_sort_element)
+          );
+          memcpy(&(arr_elements[i_write]), p_block, I_SAMPLESORT_BLOCK_SIZE * sizeof(t_TSODLULS_sort_element));
+          p_tmp_block = p_block; p_block = p_other_block; p_other_block = p_tmp_block;
+          continue;
+        }
+        do{
+          pthread_mutex_lock(&(p_samplesort->arr_mutexes[i_target]));
+          i_pending_reads = p_samplesort->arr_pending_reads[i_target];
+          pthread_mutex_unlock(&(p_samplesort->arr_mutexes[i_target]));
+          if(i_pending_reads > 0){
+            sched_yield();
+          }
+        }
+        while(i_pending_reads > 0);
+        if(i_write + I_SAMPLESORT_BLOCK_SIZE > p_samplesort->i_number_of_elements){
+          memcpy(
+              p_samplesort->arr_overflow,
+              p_block,
+              I_SAMPLESORT_BLOCK_SIZE * sizeof(t_TSODLULS_sort_element)
+          );
+        }
+        else{
+          memcpy(&(arr_elements[i_write]), p_block, I_SAMPLESORT_BLOCK_SIZE * sizeof(t_TSODLULS_sort_element));
+        }
+        break;
+      }
+    }
+    if(++i_bucket == i_number_of_buckets){
+      i_bucket = 0;
+    }
+  }
+  return NULL;
+}//end function TSODLULS_samplesort_permute_task()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Run a function on all the threads of the samplesort (including the calling thread).
+ * If a thread cannot be created, its function is run by the calling thread.
+ */
+static void TSODLULS_samplesort_run_threads(t_TSODLULS_samplesort* p_samplesort, void* (*f_task)(void*)){
+  for(size_t i = 1; i < p_samplesort->i_number_of_threads; ++i){
+    p_samplesort->arr_threads[i].b_started = pthread_create(
+        &(p_samplesort->arr_threads[i].thread),
+        NULL,
+        f_task,
+        &(p_samplesort->arr_threads[i])
+    ) == 0;
+  }
+  f_task(&(p_samplesort->arr_threads[0]));
+  for(size_t i = 1; i < p_samplesort->i_number_of_threads; ++i){
+    if(p_samplesort->arr_threads[i].b_started){
+      pthread_join(p_samplesort->arr_threads[i].thread, NULL);
+    }
+    else{
+      f_task(&(p_samplesort->arr_threads[i]));
+    }
+  }
+}//end function TSODLULS_samplesort_run_threads()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * One partition step of the samplesort, the bucket starts are in p_samplesort->arr_bucket_starts afterwards:
+ * - the splitters are chosen,
+ * - the threads classify the cells of their stripes,
+ * - the full blocks are moved at the beginning of the array,
+ * - the threads move the blocks in their buckets,
+ * - the partial blocks of the buffers and the overflowing cells of the last block of each bucket
+ *   are written at the beginning and the end of the bucket.
+ */
+static void TSODLULS_samplesort_partition(
+  t_TSODLULS_samplesort* p_samplesort,
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+){
+  t_TSODLULS_samplesort_thread* arr_threads = p_samplesort->arr_threads;
+  size_t* arr_bucket_starts = p_samplesort->arr_bucket_starts;
+  size_t i_number_of_threads = p_samplesort->i_number_of_threads;
+  size_t i_number_of_buckets = 0;
+  size_t i_stripe_size = 0;
+  size_t i_full_blocks_end = 0;
+  size_t i_full_thread = 0;
+  size_t i_full_block = 0;
+  size_t i_empty_end = 0;
+  size_t i_bucket_start = 0;
+  size_t i_bucket_end = 0;
+  size_t i_aligned_start = 0;
+  size_t i_aligned_end = 0;
+  size_t i_write = 0;
+  size_t i_destination = 0;
+  size_t i_destination_end = 0;
+  size_t i_copy = 0;
+  size_t i_count = 0;
+  t_TSODLULS_sort_element* p_source = NULL;
+
+#define TSODLULS_samplesort_align(i_offset) \
+  (((i_offset) + I_SAMPLESORT_BLOCK_SIZE - 1) / I_SAMPLESORT_BLOCK_SIZE * I_SAMPLESORT_BLOCK_SIZE)
+
+  p_samplesort->arr_elements = arr_elements;
+  p_samplesort->i_number_of_elements = i_number_of_elements;
+  TSODLULS_samplesort_build_tree(p_samplesort, arr_elements, i_number_of_elements);
+  i_number_of_buckets = p_samplesort->i_number_of_buckets;
+
+  //classification in stripes of whole blocks
+  i_stripe_size = TSODLULS_samplesort_align((i_number_of_elements + i_number_of_threads - 1) / i_number_of_threads);
+  for(size_t t = 0; t < i_number_of_threads; ++t){
+    arr_threads[t].i_stripe_first = t * i_stripe_size < i_number_of_elements ? t * i_stripe_size : i_number_of_elements;
+    arr_threads[t].i_stripe_end = arr_threads[t].i_stripe_first + i_stripe_size < i_number_of_elements ?
+      arr_threads[t].i_stripe_first + i_stripe_size : i_number_of_elements;
+  }
+  TSODLULS_samplesort_run_threads(p_samplesort, TSODLULS_samplesort_classify_task);
+
+  arr_bucket_starts[0] = 0;
+  for(size_t b = 0; b < i_number_of_buckets; ++b){
+    arr_bucket_starts[b + 1] = arr_bucket_starts[b];
+    for(size_t t = 0; t < i_number_of_threads; ++t){
+      arr_bucket_starts[b + 1] += arr_threads[t].arr_bucket_sizes[b];
+    }
+  }
+  for(size_t t = 0; t < i_number_of_threads; ++t){
+    i_full_blocks_end += arr_threads[t].i_number_of_full_blocks * I_SAMPLESORT_BLOCK_SIZE;
+  }
+
+  //the empty blocks before i_full_blocks_end receive the full blocks after it, from the last stripe
+  i_full_thread = i_number_of_threads - 1;
+  i_full_block = arr_threads[i_full_thread].i_stripe_first
+               + arr_threads[i_full_thread].i_number_of_full_blocks * I_SAMPLESORT_BLOCK_SIZE;
+  for(size_t t = 0; t < i_number_of_threads; ++t){
+    i_empty_end = arr_threads[t].i_stripe_end < i_full_blocks_end ? arr_threads[t].i_stripe_end : i_full_blocks_end;
+    for(
+      size_t i_empty = arr_threads[t].i_stripe_first + arr_threads[t].i_number_of_full_blocks * I_SAMPLESORT_BLOCK_SIZE;
+      i_empty < i_empty_end;
+      i_empty += I_SAMPLESORT_BLOCK_SIZE
+    ){
+      while(
+        i_full_block <= arr_threads[i_full_thread].i_stripe_first
+        || i_full_block <= i_full_blocks_end
+      ){
+        --i_full_thread;
+        i_full_block = arr_threads[i_full_thread].i_stripe_first
+                     + arr_threads[i_full_thread].i_number_of_full_blocks * I_SAMPLESORT_BLOCK_SIZE;
+      }
+      i_full_block -= I_SAMPLESORT_BLOCK_SIZE;
+      memcpy(
+          &(arr_elements[i_empty]),
+          &(arr_elements[i_full_block]),
+          I_SAMPLESORT_BLOCK_SIZE * sizeof(t_TSODLULS_sort_element)
+      );
+    }
+  }
+
+  //permutation of the blocks
+  for(size_t b = 0; b < i_number_of_buckets; ++b){
+    i_aligned_start = TSODLULS_samplesort_align(arr_bucket_starts[b]);
+    i_aligned_end = TSODLULS_samplesort_align(arr_bucket_starts[b + 1]);
+    if(i_aligned_end > i_full_blocks_end){
+      i_aligned_end = i_full_blocks_end;
+    }
+    p_samplesort->arr_bucket_writes[b] = i_aligned_start;
+    p_samplesort->arr_bucket_reads[b] = i_aligned_end > i_aligned_start ? i_aligned_end : i_aligned_start;
+    p_samplesort->arr_pending_reads[b] = 0;
+  }
+  TSODLULS_samplesort_run_threads(p_samplesort, TSODLULS_samplesort_permute_task);
+
+  //cleanup: the cells of the bucket that are not in its aligned blocks fill its head and its tail
+#define TSODLULS_samplesort_fill_bucket(p_cells, i_number_of_cells) \
+  p_source = (p_cells);\
+  i_count = (i_number_of_cells);\
+  while(i_count > 0){\
+    if(i_destination == i_destination_end){\
+      i_destination = i_write;\
+      i_destination_end = i_bucket_end;\
+    }\
+    i_copy = i_destination_end - i_destination < i_count ? i_destination_end - i_destination : i_count;\
+    memcpy(&(arr_elements[i_destination]), p_source, i_copy * sizeof(t_TSODLULS_sort_element));\
+    i_destination += i_copy;\
+    p_source += i_copy;\
+    i_count -= i_copy;\
+  }
+
+  for(size_t b = 0; b < i_number_of_buckets; ++b){
+    i_bucket_start = arr_bucket_starts[b];
+    i_bucket_end = arr_bucket_starts[b + 1];
+    i_aligned_start = TSODLULS_samplesort_align(i_bucket_start);
+    i_write = p_samplesort->arr_bucket_writes[b];
+    i_destination = i_bucket_start;
+    i_destination_end = i_aligned_start < i_bucket_end ? i_aligned_start : i_bucket_end;
+    if(i_write > i_aligned_start && i_write > i_bucket_end){
+      //the last block overflows in the head of the next bucket or after the array
+      if(i_write > i_number_of_elements){
+        i_copy = i_bucket_end - (i_write - I_SAMPLESORT_BLOCK_SIZE);
+        memcpy(
+            &(arr_elements[i_write - I_SAMPLESORT_BLOCK_SIZE]),
+            p_samplesort->arr_overflow,
+            i_copy * sizeof(t_TSODLULS_sort_element)
+        );
+        TSODLULS_samplesort_fill_bucket(
+            ((t_TSODLULS_sort_element*) p_samplesort->arr_overflow) + i_copy,
+            i_write - i_bucket_end
+        )
+      }
+      else{
+        TSODLULS_samplesort_fill_bucket(&(arr_elements[i_bucket_end]), i_write - i_bucket_end)
+      }
+    }
+    for(size_t t = 0; t < i_number_of_threads; ++t){
+      TSODLULS_samplesort_fill_bucket(
+          ((t_TSODLULS_sort_element*) arr_threads[t].arr_buffers) + b * I_SAMPLESORT_BLOCK_SIZE,
+          arr_threads[t].arr_buffer_counts[b]
+      )
+    }
+  }
+
+#undef TSODLULS_samplesort_fill_bucket
+#undef TSODLULS_samplesort_align
+}//end function TSODLULS_samplesort_partition()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Samplesort with one thread, the buckets are sorted recursively
+ */
+static int TSODLULS_samplesort_sequential(
+  t_TSODLULS_samplesort* p_samplesort,
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_depth
+){
+  int i_result = 0;
+  size_t arr_bucket_starts[I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS + 1];
+  size_t i_number_of_buckets = 0;
+  size_t i_bucket_size = 0;
+
+  if(i_number_of_elements <= I_SAMPLESORT_BASE_CASE_SIZE || i_depth >= I_SAMPLESORT_MAX_DEPTH){
+    return TSODLULS_pdqsort(arr_elements, i_number_of_elements);
+  }
+
+  TSODLULS_samplesort_partition(p_samplesort, arr_elements, i_number_of_elements);
+  i_number_of_buckets = p_samplesort->i_number_of_buckets;
+  memcpy(arr_bucket_starts, p_samplesort->arr_bucket_starts, (i_number_of_buckets + 1) * sizeof(size_t));
+
+  //the odd buckets contain equal keys
+  for(size_t b = 0; b < i_number_of_buckets && i_result == 0; b += 2){
+    i_bucket_size = arr_bucket_starts[b + 1] - arr_bucket_starts[b];
+    if(i_bucket_size > 1){
+      i_result = TSODLULS_samplesort_sequential(
+          p_samplesort,
+          &(arr_elements[arr_bucket_starts[b]]),
+          i_bucket_size,
+          i_depth + 1
+      );
+    }
+  }
+
+  return i_result;
+}//end function TSODLULS_samplesort_sequential()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The function of the threads sorting the buckets of TSODLULS_sort_samplesort_parallel()
+ * that are not big, each thread takes the next bucket and sorts it with its own buffers.
+ */
+static void* TSODLULS_samplesort_buckets_task(void* p_task){
+  t_TSODLULS_samplesort_thread* p_thread = (t_TSODLULS_samplesort_thread*) p_task;
+  t_TSODLULS_samplesort* p_samplesort = p_thread->p_samplesort;
+  t_TSODLULS_sort_element* arr_elements = (t_TSODLULS_sort_element*) p_samplesort->arr_elements;
+  t_TSODLULS_samplesort samplesort;
+  size_t i_bucket = 0;
+  size_t i_bucket_size = 0;
+
+  p_thread->i_result = TSODLULS_samplesort_init(&samplesort, 1);
+  if(p_thread->i_result != 0){
+    return NULL;//the other threads sort the buckets
+  }
+  while(p_thread->i_result == 0){
+    pthread_mutex_lock(&(p_samplesort->next_bucket_mutex));
+    i_bucket = p_samplesort->i_next_bucket;
+    p_samplesort->i_next_bucket += 2;
+    pthread_mutex_unlock(&(p_samplesort->next_bucket_mutex));
+    if(i_bucket >= p_samplesort->i_number_of_buckets){
+      break;
+    }
+    i_bucket_size = p_samplesort->arr_bucket_starts[i_bucket + 1] - p_samplesort->arr_bucket_starts[i_bucket];
+    if(
+      i_bucket_size > 1
+      && (
+        i_bucket_size <= p_samplesort->i_number_of_elements / p_samplesort->i_number_of_threads
+        || i_bucket_size == p_samplesort->i_number_of_elements
+      )
+    ){
+      p_thread->i_result = TSODLULS_samplesort_sequential(
+          &samplesort,
+          &(arr_elements[p_samplesort->arr_bucket_starts[i_bucket]]),
+          i_bucket_size,
+          1
+      );
+    }
+  }
+  TSODLULS_samplesort_free(&samplesort);
+  return NULL;
+}//end function TSODLULS_samplesort_buckets_task()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The 8 bytes of the key of p_cell from the byte i_depth, as a big-endian uint64:
+ * the bytes after the end of the key are 0.
+ */
+static inline uint64_t TSODLULS_get_key_word(const t_TSODLULS_sort_element* p_cell, size_t i_depth){
+  uint64_t i_word = 0;
+  if(p_cell->i_key_size >= i_depth + 8){
+    memcpy(&i_word, p_cell->s_key + i_depth, 8);
+    return be64toh(i_word);
+  }
+  for(size_t i = i_depth; i < p_cell->i_key_size; ++i){
+    i_word |= ((uint64_t)(p_cell->s_key[i])) << (56 - 8 * (i - i_depth));
+  }
+  return i_word;
+}//end function TSODLULS_get_key_word()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Sort a group of cells whose keys are equal before the byte i_depth by the next 8 bytes of their keys:
+ * the words are sorted in a view of short cells (arr_view) by f_sort__short()
+ * and the cells are permuted accordingly with arr_elements_copy.
+ * Both buffers have room for i_group_size cells, and arr_view has the sorted words afterwards.
+ * If all the words are equal (common prefix), the cells are not moved.
+ */
+static int TSODLULS_sort_by_key_word(
+  t_TSODLULS_sort_element* p_group,
+  size_t i_group_size,
+  size_t i_depth,
+  t_TSODLULS_sort_element__short* arr_view,
+  t_TSODLULS_sort_element* arr_elements_copy,
+  int (*f_sort__short)(t_TSODLULS_sort_element__short*, size_t, uint8_t)
+){
+  int i_result = 0;
+  unsigned int b_all_equal = 1;
+
+  for(size_t i = 0; i < i_group_size; ++i){
+    arr_view[i].i_key = TSODLULS_get_key_word(&(p_group[i]), i_depth);
+    arr_view[i].p_object = &(p_group[i]);
+    b_all_equal &= (arr_view[i].i_key == arr_view[0].i_key);
+  }
+  if(b_all_equal){
+    return 0;
+  }
+  i_result = f_sort__short(arr_view, i_group_size, 8);
+  if(i_result != 0){
+    return i_result;
+  }
+  for(size_t i = 0; i < i_group_size; ++i){
+    arr_elements_copy[i] = *((t_TSODLULS_sort_element*)(arr_view[i].p_object));
+  }
+  memcpy(p_group, arr_elements_copy, i_group_size * sizeof(t_TSODLULS_sort_element));
+  return 0;
+}//end function TSODLULS_sort_by_key_word()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Order a run of cells whose keys have the same word from the byte i_depth (see TSODLULS_get_key_word()):
+ * the keys ending in the word or at its end come first by increasing length (they are prefixes of the longer keys),
+ * and then the keys continuing after the word, whose number is returned.
+ * arr_elements_copy has room for i_run_size cells.
+ */
+static size_t TSODLULS_order_tied_keys_by_length(
+  t_TSODLULS_sort_element* p_run,
+  size_t i_run_size,
+  size_t i_depth,
+  t_TSODLULS_sort_element* arr_elements_copy
+){
+  size_t i_length = 0;
+  size_t arr_counts[10];//by length after the depth, 9 for the keys continuing after the word
+  size_t arr_offsets[10];
+
+  memset(arr_counts, 0, 10 * sizeof(size_t));
+  for(size_t i = 0; i < i_run_size; ++i){
+    i_length = p_run[i].i_key_size - i_depth;
+    ++arr_counts[i_length <= 8 ? i_length : 9];
+  }
+  if(arr_counts[9] == i_run_size){
+    return i_run_size;
+  }
+  arr_offsets[0] = 0;
+  for(int i = 1; i < 10; ++i){
+    arr_offsets[i] = arr_offsets[i - 1] + arr_counts[i - 1];
+  }
+  for(size_t i = 0; i < i_run_size; ++i){
+    i_length = p_run[i].i_key_size - i_depth;
+    arr_elements_copy[arr_offsets[i_length <= 8 ? i_length : 9]++] = p_run[i];
+  }
+  memcpy(p_run, arr_elements_copy, i_run_size * sizeof(t_TSODLULS_sort_element));
+  return arr_counts[9];
+}//end function TSODLULS_order_tied_keys_by_length()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A stable insertion sort for a small number of elements whose keys are equal before the byte i_offset
+ */
+static void TSODLULS_sort_insertion_from_offset(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_offset
+){
+  t_TSODLULS_sort_element tmp_cell;
+  size_t j = 0;
+  int i_comparison = 0;
+  uint64_t TSODLULS_macraff_ui64;
+  uint64_t TSODLULS_macraff_ui64_2;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+
+  for(size_t i = 1; i < i_number_of_elements; ++i){
+    tmp_cell = arr_elements[i];
+    for(j = i; j > 0; --j){
+      TSODLULS_compare_nextified_keys_in_cells__macraff(i_comparison, &tmp_cell, &(arr_elements[j - 1]), i_offset);
+      if(i_comparison >= 0){
+        break;
+      }
+      arr_elements[j] = arr_elements[j - 1];
+    }
+    arr_elements[j] = tmp_cell;
+  }
+}//end function TSODLULS_sort_insertion_from_offset()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The hash of a key for the dictionaries of keys (FNV-1a)
+ */
+static inline uint64_t TSODLULS_get_key_hash(const uint8_t* s_key, size_t i_key_size){
+  uint64_t i_hash = 14695981039346656037ULL;
+  for(size_t i = 0; i < i_key_size; ++i){
+    i_hash ^= s_key[i];
+    i_hash *= 1099511628211ULL;
+  }
+  return i_hash;
+}//end function TSODLULS_get_key_hash()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The slot of the key of a cell in the hash table of a dictionary of keys:
+ * the slot of the equal key, or the empty slot where it would be inserted.
+ */
+static size_t TSODLULS_key_dictionary_find_slot(
+  const t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* p_sort_element
+){
+  const t_TSODLULS_sort_element* p_key = NULL;
+  size_t i_slot = TSODLULS_get_key_hash(p_sort_element->s_key, p_sort_element->i_key_size)
+                & (p_dictionary->i_number_of_slots - 1);
+
+  while(p_dictionary->arr_slots[i_slot] != 0){
+    p_key = &(p_dictionary->arr_keys[p_dictionary->arr_slots[i_slot] - 1]);
+    if(
+      p_key->i_key_size == p_sort_element->i_key_size
+      && memcmp(p_key->s_key, p_sort_element->s_key, p_key->i_key_size) == 0
+    ){
+      break;
+    }
+    i_slot = (i_slot + 1) & (p_dictionary->i_number_of_slots - 1);
+  }
+  return i_slot;
+}//end function TSODLULS_key_dictionary_find_slot()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Rebuild the hash table of a dictionary of keys with i_number_of_slots slots (a power of 2)
+ * for the indexes of the keys in arr_keys.
+ */
+static int TSODLULS_key_dictionary_rehash(t_TSODLULS_key_dictionary* p_dictionary, size_t i_number_of_slots){
+  size_t* arr_slots = calloc(i_number_of_slots, sizeof(size_t));
+  if(arr_slots == NULL){
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  free(p_dictionary->arr_slots);
+  p_dictionary->arr_slots = arr_slots;
+  p_dictionary->i_number_of_slots = i_number_of_slots;
+  for(size_t i = 0; i < p_dictionary->i_number_of_keys; ++i){
+    p_dictionary->arr_slots[TSODLULS_key_dictionary_find_slot(p_dictionary, &(p_dictionary->arr_keys[i]))] = i + 1;
+  }
+  return 0;
+}//end function TSODLULS_key_dictionary_rehash()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Read a list of numbers like "0-3,8,10-11" in the file s_path (the CPUs or the nodes in /sys)
+ * and set arr_b_in_list[i] to 1 for the numbers i below i_max, returns the number of them.
+ */
+static size_t TSODLULS_numa_read_list(const char* s_path, unsigned char* arr_b_in_list, size_t i_max){
+  FILE* p_file = NULL;
+  unsigned long i_first = 0;
+  unsigned long i_last = 0;
+  size_t i_count = 0;
+  int i_char = 0;
+
+  memset(arr_b_in_list, 0, i_max);
+  p_file = fopen(s_path, "r");
+  if(p_file == NULL){
+    return 0;
+  }
+  while(fscanf(p_file, "%lu", &i_first) == 1){
+    i_last = i_first;
+    i_char = fgetc(p_file);
+    if(i_char == '-'){
+      if(fscanf(p_file, "%lu", &i_last) != 1){
+        break;
+      }
+      i_char = fgetc(p_file);
+    }
+    for(unsigned long i = i_first; i <= i_last && i < i_max; ++i){
+      if(!arr_b_in_list[i]){
+        arr_b_in_list[i] = 1;
+        ++i_count;
+      }
+    }
+    if(i_char != ','){
+      break;
+    }
+  }
+  fclose(p_file);
+  return i_count;
+}//end function TSODLULS_numa_read_list()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Read the NUMA nodes having CPUs and the node of each CPU in /sys/devices/system/node.
+ * Without this directory (no NUMA, not Linux), the machine is a single node and the CPUs are unknown.
+ */
+static void TSODLULS_numa_read_topology(t_TSODLULS_numa_sort* p_numa_sort){
+  unsigned char arr_b_nodes[I_NUMA_MAX_NODE_ID];
+  unsigned char arr_b_cpus[I_NUMA_MAX_CPU_ID];
+  char s_path[64];
+
+  p_numa_sort->i_number_of_nodes = 0;
+  for(size_t i = 0; i < I_NUMA_MAX_CPU_ID; ++i){
+    p_numa_sort->arr_cpu_nodes[i] = -1;
+  }
+  TSODLULS_numa_read_list("/sys/devices/system/node/online", arr_b_nodes, I_NUMA_MAX_NODE_ID);
+  for(size_t i = 0; i < I_NUMA_MAX_NODE_ID; ++i){
+    if(!arr_b_nodes[i]){
+      continue;
+    }
+    snprintf(s_path, sizeof(s_path), "/sys/devices/system/node/node%zu/cpulist", i);
+    if(TSODLULS_numa_read_list(s_path, arr_b_cpus, I_NUMA_MAX_CPU_ID) == 0){
+      continue;//a node with memory only
+    }
+    for(size_t j = 0; j < I_NUMA_MAX_CPU_ID; ++j){
+      if(arr_b_cpus[j]){
+        p_numa_sort->arr_cpu_nodes[j] = (int)(p_numa_sort->i_number_of_nodes);
+      }
+    }
+    p_numa_sort->arr_node_ids[p_numa_sort->i_number_of_nodes] = (int)i;
+    ++(p_numa_sort->i_number_of_nodes);
+  }
+  if(p_numa_sort->i_number_of_nodes == 0){
+    p_numa_sort->i_number_of_nodes = 1;
+    p_numa_sort->arr_node_ids[0] = 0;
+  }
+}//end function TSODLULS_numa_read_topology()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Pin the thread of the task to the CPUs of its node, when it is not the calling thread
+ * and the CPUs of the node are known.
+ */
+static void TSODLULS_numa_pin_thread(t_TSODLULS_numa_sort_thread* p_thread){
+#ifdef CPU_SET
+  cpu_set_t cpu_set;
+  size_t i_number_of_cpus = 0;
+
+  p_thread->b_pinned = 0;
+  if(!p_thread->b_own_thread){
+    return;
+  }
+  CPU_ZERO(&cpu_set);
+  for(size_t i = 0; i < I_NUMA_MAX_CPU_ID && i < CPU_SETSIZE; ++i){
+    if(p_thread->p_numa_sort->arr_cpu_nodes[i] == (int)(p_thread->i_node)){
+      CPU_SET(i, &cpu_set);
+      ++i_number_of_cpus;
+    }
+  }
+  if(i_number_of_cpus > 0){
+    p_thread->b_pinned = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set) == 0;
+  }
+#else
+  p_thread->b_pinned = 0;
+#endif
+}//end function TSODLULS_numa_pin_thread()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Allocate a buffer of i_size bytes on the node of the thread: when the machine has several nodes,
+ * the pages are bound to the node with mbind(), or interleaved on all the nodes if the thread is not pinned
+ * (it may run anywhere), and they are first touched by the thread.
+ * On a single node, the buffer is only allocated.
+ * The buffer is a new anonymous mapping: none of its pages were faulted in before mbind()
+ * (the heap may give pages already placed on another node), it must be freed with TSODLULS_numa_free_local().
+ */
+static void* TSODLULS_numa_alloc_local(t_TSODLULS_numa_sort_thread* p_thread, size_t i_size){
+  t_TSODLULS_numa_sort* p_numa_sort = p_thread->p_numa_sort;
+  void* p_buffer = NULL;
+  size_t i_page_size = 4096;
+  long i_sysconf_page_size = sysconf(_SC_PAGESIZE);
+
+  if(i_sysconf_page_size > 0){
+    i_page_size = (size_t)i_sysconf_page_size;
+  }
+  i_size = (i_size + i_page_size - 1) / i_page_size * i_page_size;
+  p_buffer = mmap(NULL, i_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(p_buffer == MAP_FAILED){
+    return NULL;
+  }
+  p_thread->i_buffer_size = i_size;
+  p_thread->b_bound = 0;
+  p_thread->b_interleaved = 0;
+  if(p_numa_sort->i_number_of_nodes > 1){
+#ifdef SYS_mbind
+    unsigned long arr_node_mask[I_NUMA_MAX_NODE_ID / (8 * sizeof(unsigned long))];
+    size_t i_first_node = p_thread->i_node;
+    size_t i_end_node = p_thread->i_node + 1;
+    int i_mode = 1;//MPOL_PREFERRED: the pages are on the node unless it is full
+    if(!p_thread->b_pinned){
+      i_first_node = 0;
+      i_end_node = p_numa_sort->i_number_of_nodes;
+      i_mode = 3;//MPOL_INTERLEAVE
+    }
+    memset(arr_node_mask, 0, sizeof(arr_node_mask));
+    for(size_t i = i_first_node; i < i_end_node; ++i){
+      arr_node_mask[p_numa_sort->arr_node_ids[i] / (8 * sizeof(unsigned long))]
+        |= 1UL << (p_numa_sort->arr_node_ids[i] % (8 * sizeof(unsigned long)));
+    }
+    if(syscall(SYS_mbind, p_buffer, i_size, i_mode, arr_node_mask, (unsigned long)(I_NUMA_MAX_NODE_ID + 1), 0) == 0){
+      p_thread->b_bound = p_thread->b_pinned;
+      p_thread->b_interleaved = !p_thread->b_pinned;
+    }
+#endif
+    memset(p_buffer, 0, i_size);
+  }
+  return p_buffer;
+}//end function TSODLULS_numa_alloc_local()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Free a buffer of the thread allocated with TSODLULS_numa_alloc_local()
+ */
+static void TSODLULS_numa_free_local(t_TSODLULS_numa_sort_thread* p_thread, void* p_buffer){
+  if(p_buffer != NULL){
+    munmap(p_buffer, p_thread->i_buffer_size);
+  }
+}//end function TSODLULS_numa_free_local()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The bucket of a cell in TSODLULS_sort_parallel_numa(), its first 2 bytes
+ */
+static inline size_t TSODLULS_numa_get_bucket(const t_TSODLULS_sort_element* p_cell){
+  size_t i_bucket = 0;
+  if(p_cell->i_key_size > 0){
+    i_bucket = ((size_t)(p_cell->s_key[0])) << 8;
+    if(p_cell->i_key_size > 1){
+      i_bucket |= p_cell->s_key[1];
+    }
+  }
+  return i_bucket;
+}//end function TSODLULS_numa_get_bucket()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Run a task of TSODLULS_sort_parallel_numa() in each thread, the calling thread waits for them
+ * and does the tasks whose thread could not be created.
+ */
+static void TSODLULS_numa_sort_run_threads(t_TSODLULS_numa_sort* p_numa_sort, void* (*f_task)(void*)){
+  for(size_t i = 0; i < p_numa_sort->i_number_of_threads; ++i){
+    p_numa_sort->arr_threads[i].b_own_thread = 1;
+    p_numa_sort->arr_threads[i].b_started = pthread_create(
+        &(p_numa_sort->arr_threads[i].thread),
+        NULL,
+        f_task,
+        &(p_numa_sort->arr_threads[i])
+    ) == 0;
+    if(!p_numa_sort->arr_threads[i].b_started){
+      p_numa_sort->arr_threads[i].b_own_thread = 0;
+    }
+  }
+  for(size_t i = 0; i < p_numa_sort->i_number_of_threads; ++i){
+    if(p_numa_sort->arr_threads[i].b_started){
+      pthread_join(p_numa_sort->arr_threads[i].thread, NULL);
+    }
+    else{
+      f_task(&(p_numa_sort->arr_threads[i]));
+    }
+  }
+}//end function TSODLULS_numa_sort_run_threads()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * First task of TSODLULS_sort_parallel_numa(): count the cells of each bucket in the stripe of the thread
+ */
+static void* TSODLULS_numa_sort_count_task(void* p_task){
+  t_TSODLULS_numa_sort_thread* p_thread = (t_TSODLULS_numa_sort_thread*) p_task;
+  t_TSODLULS_sort_element* arr_elements = p_thread->p_numa_sort->arr_elements;
+
+  TSODLULS_numa_pin_thread(p_thread);
+  for(size_t i = p_thread->i_stripe_first; i < p_thread->i_stripe_end; ++i){
+    ++(p_thread->arr_bucket_offsets[TSODLULS_numa_get_bucket(&(arr_elements[i]))]);
+  }
+  return NULL;
+}//end function TSODLULS_numa_sort_count_task()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Second task of TSODLULS_sort_parallel_numa(): allocate the buffers of the partition of the thread on its node
+ */
+static void* TSODLULS_numa_sort_alloc_task(void* p_task){
+  t_TSODLULS_numa_sort_thread* p_thread = (t_TSODLULS_numa_sort_thread*) p_task;
+
+  TSODLULS_numa_pin_thread(p_thread);
+  if(p_thread->i_partition_size == 0){
+    return NULL;
+  }
+  p_thread->arr_partition = TSODLULS_numa_alloc_local(p_thread, p_thread->i_partition_size * sizeof(t_TSODLULS_sort_element));
+  p_thread->arr_partition_copy = TSODLULS_numa_alloc_local(
+      p_thread,
+      p_thread->i_partition_size * sizeof(t_TSODLULS_sort_element)
+  );
+  if(p_thread->arr_partition == NULL || p_thread->arr_partition_copy == NULL){
+    p_thread->i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  return NULL;
+}//end function TSODLULS_numa_sort_alloc_task()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Third task of TSODLULS_sort_parallel_numa(): write the cells of the stripe of the thread
+ * in the partitions of the threads sorting their buckets
+ * For the stats, the bytes are local only if the thread is pinned now and the partition is bound to its node.
+ */
+static void* TSODLULS_numa_sort_distribute_task(void* p_task){
+  t_TSODLULS_numa_sort_thread* p_thread = (t_TSODLULS_numa_sort_thread*) p_task;
+  t_TSODLULS_numa_sort* p_numa_sort = p_thread->p_numa_sort;
+  t_TSODLULS_numa_sort_thread* p_owner = NULL;
+  t_TSODLULS_sort_element* arr_elements = p_numa_sort->arr_elements;
+  size_t i_bucket = 0;
+
+  TSODLULS_numa_pin_thread(p_thread);
+  for(size_t t = 0; p_thread->arr_bytes_to_threads != NULL && t < p_numa_sort->i_number_of_threads; ++t){
+    p_owner = &(p_numa_sort->arr_threads[t]);
+    if(p_numa_sort->i_number_of_nodes == 1
+      || (p_thread->b_pinned && p_owner->b_bound && p_owner->i_node == p_thread->i_node)
+    ){
+      p_thread->i_bytes_to_local_node += p_thread->arr_bytes_to_threads[t];
+    }
+    else{
+      p_thread->i_bytes_to_remote_node += p_thread->arr_bytes_to_threads[t];
+    }
+  }
+  for(size_t i = p_thread->i_stripe_first; i < p_thread->i_stripe_end; ++i){
+    i_bucket = TSODLULS_numa_get_bucket(&(arr_elements[i]));
+    p_numa_sort->arr_threads[p_numa_sort->arr_bucket_owners[i_bucket]].arr_partition[
+      (p_thread->arr_bucket_offsets[i_bucket])++
+    ] = arr_elements[i];
+  }
+  return NULL;
+}//end function TSODLULS_numa_sort_distribute_task()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Last task of TSODLULS_sort_parallel_numa(): sort the partition of the thread in its node-local buffers
+ * and copy it in the array
+ */
+static void* TSODLULS_numa_sort_sort_task(void* p_task){
+  t_TSODLULS_numa_sort_thread* p_thread = (t_TSODLULS_numa_sort_thread*) p_task;
+  t_TSODLULS_radix_instance* arr_instances = NULL;
+  size_t i_max_number_of_instances = 0;
+
+  TSODLULS_numa_pin_thread(p_thread);
+  if(p_thread->i_partition_size == 0){
+    return NULL;
+  }
+  if(p_thread->i_partition_size <= I_SORT_MODEL__INSERTION_THRESHOLD){
+    p_thread->i_result = TSODLULS_sort_insertion(p_thread->arr_partition, p_thread->i_partition_size);
+  }
+  else{
+    arr_instances = calloc(8, sizeof(t_TSODLULS_radix_instance));
+    if(arr_instances == NULL){
+      p_thread->i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      return NULL;
+    }
+    i_max_number_of_instances = 8;
+    p_thread->i_result = TSODLULS_sort_radix8_count_insertion_in_buffers(
+        p_thread->arr_partition,
+        p_thread->i_partition_size,
+        p_thread->arr_partition_copy,
+        &arr_instances,
+        &i_max_number_of_instances
+    );
+    TSODLULS_free(arr_instances);
+  }
+  if(p_thread->i_result == 0){
+    memcpy(
+        &(p_thread->p_numa_sort->arr_elements[p_thread->i_partition_first]),
+        p_thread->arr_partition,
+        p_thread->i_partition_size * sizeof(t_TSODLULS_sort_element)
+    );
+  }
+  return NULL;
+}//end function TSODLULS_numa_sort_sort_task()
 
 
 
@@ -26,23 +1519,688 @@ along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
 //------------------------------------------------------------------------------------
 /**
  * Sorting functions for long nextified strings
- * The current state of the art sorting function for nextified strings.
- * Its implementation may change without warning.
+ * The current state of the art sorting function for nextified strings.
+ * Its implementation may change without warning.
+ */
+int TSODLULS_sort(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements){
+  t_TSODLULS_sort_model model;
+  TSODLULS_sort_model_init(&model);
+  return TSODLULS_sort_with_model(&model, arr_elements, i_number_of_elements);
+}//end function TSODLULS_sort()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * The current state of the art stable sorting function for nextified strings.
+ * Its implementation may change without warning.
+ */
+int TSODLULS_sort_stable(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements){
+  if(i_number_of_elements <= I_SORT_MODEL__INSERTION_THRESHOLD){
+    return TSODLULS_sort_insertion(arr_elements, i_number_of_elements);
+  }
+  return TSODLULS_sort_radix8_count(arr_elements, i_number_of_elements);
+}//end function TSODLULS_sort_stable()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Choose the algorithm with the lowest cost for these elements according to the cost model
+ * (see t_TSODLULS_sort_model).
+ * Returns I_SORT_ALGORITHM__INSERTION, I_SORT_ALGORITHM__COMPARISON or I_SORT_ALGORITHM__RADIX.
+ */
+int TSODLULS_choose_sort_algorithm(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+){
+  size_t i_sample_size = 0;
+  size_t i_step = 0;
+  size_t i_prefix = 0;
+  size_t i_total_size = 0;
+  size_t i_average_size = 0;
+  size_t i_levels = 0;
+  size_t i_buckets = 1;
+  size_t i_instances = 0;
+  size_t i_log2 = 0;
+  size_t j = 0;
+  t_TSODLULS_sort_element* p_cell = NULL;
+  double f_comparison_cost = 0.0;
+  double f_radix_cost = 0.0;
+
+  if(i_number_of_elements <= p_model->i_insertion_threshold){
+    return I_SORT_ALGORITHM__INSERTION;
+  }
+
+  //common prefix and average size of a sample of the keys
+  i_sample_size = p_model->i_sample_size;
+  if(i_sample_size > i_number_of_elements){
+    i_sample_size = i_number_of_elements;
+  }
+  if(i_sample_size == 0){
+    i_sample_size = 1;
+  }
+  i_step = i_number_of_elements / i_sample_size;
+  i_prefix = arr_elements[0].i_key_size;
+  for(size_t i = 0; i < i_sample_size; ++i){
+    p_cell = &(arr_elements[i * i_step]);
+    i_total_size += p_cell->i_key_size;
+    for(j = 0; j < i_prefix && j < p_cell->i_key_size; ++j){
+      if(p_cell->s_key[j] != arr_elements[0].s_key[j]){
+        break;
+      }
+    }
+    i_prefix = j;
+  }
+  i_average_size = i_total_size / i_sample_size;
+
+  //levels before the buckets have at most 2 elements
+  while(i_prefix + i_levels < i_average_size && i_number_of_elements / i_buckets > 2){
+    if(i_levels > 0){
+      i_instances += i_buckets < i_number_of_elements / 4 ? i_buckets : i_number_of_elements / 4;
+    }
+    ++i_levels;
+    i_buckets *= 256;
+  }
+  for(size_t i = i_number_of_elements; i > 1; i >>= 1){
+    ++i_log2;
+  }
+
+  f_comparison_cost = ((double)i_number_of_elements) * i_log2
+    * (p_model->f_comparison_cost + i_prefix * p_model->f_comparison_byte_cost);
+  f_radix_cost = p_model->f_radix_setup_cost
+    + i_prefix * (p_model->f_radix_level_cost + i_number_of_elements * p_model->f_radix_count_cost)
+    + ((double)i_levels) * i_number_of_elements * p_model->f_radix_pass_cost
+    + i_instances * p_model->f_radix_instance_cost;
+  if(f_comparison_cost < f_radix_cost){
+    return I_SORT_ALGORITHM__COMPARISON;
+  }
+  return I_SORT_ALGORITHM__RADIX;
+}//end function TSODLULS_choose_sort_algorithm()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Sort with the algorithm chosen by TSODLULS_choose_sort_algorithm().
+ * It is not stable since the comparison model uses quicksort.
+ */
+int TSODLULS_sort_with_model(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+){
+  if(i_number_of_elements < 2){
+    return 0;//nothing to sort
+  }
+  switch(TSODLULS_choose_sort_algorithm(p_model, arr_elements, i_number_of_elements)){
+    case I_SORT_ALGORITHM__INSERTION:
+      return TSODLULS_sort_insertion(arr_elements, i_number_of_elements);
+    case I_SORT_ALGORITHM__COMPARISON:
+      return TSODLULS_pdqsort(arr_elements, i_number_of_elements);
+    default:
+      return TSODLULS_sort_radix8_count_insertion(arr_elements, i_number_of_elements);
+  }
+}//end function TSODLULS_sort_with_model()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A stable insertion sort for a small number of elements
+ */
+int TSODLULS_sort_insertion(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements){
+  t_TSODLULS_sort_element tmp_cell;
+  size_t j = 0;
+  int i_comparison = 0;
+  uint64_t TSODLULS_macraff_ui64;
+  uint64_t TSODLULS_macraff_ui64_2;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+
+  for(size_t i = 1; i < i_number_of_elements; ++i){
+    tmp_cell = arr_elements[i];
+    for(j = i; j > 0; --j){
+      //nextified strings, 8 bytes at a time
+      TSODLULS_compare_nextified_keys_in_cells__macraff(i_comparison, &tmp_cell, &(arr_elements[j - 1]), 0);
+      if(i_comparison >= 0){
+        break;
+      }
+      arr_elements[j] = arr_elements[j - 1];
+    }
+    arr_elements[j] = tmp_cell;
+  }
+  return 0;
+}//end function TSODLULS_sort_insertion()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Pattern-defeating quicksort (pdqsort of Orson Peters) inlined with long cells:
+ * the keys are compared 8 bytes at a time and then by their lengths, without function pointer.
+ * Sorted, reverse sorted and almost sorted cells are sorted in linear time,
+ * and the cells equal to a previous pivot are not partitioned again, hence few distinct keys are fast.
+ * Heapsort is used after too many bad partitions, hence O(n log n) in the worst case.
+ * It is not stable.
+ */
+int TSODLULS_pdqsort(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements){
+  size_t i_log2 = 0;
+  if(i_number_of_elements < 2){
+    return 0;//nothing to sort
+  }
+  for(size_t i = i_number_of_elements; i > 1; i >>= 1){
+    ++i_log2;
+  }
+  TSODLULS_pdqsort_loop(arr_elements, arr_elements + i_number_of_elements, i_log2, 1);
+  return 0;
+}//end function TSODLULS_pdqsort()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A radix sort with 64 bits digits: the next 8 bytes of the keys are loaded as big-endian uint64
+ * in a view of short cells (the bytes after the end of a key are 0), the view is sorted
+ * by TSODLULS_sort__short() and the cells are permuted accordingly.
+ * In a group of equal words, the keys ending in the word come first by increasing length
+ * (they are prefixes of the longer keys), and only the keys continuing after the word are sorted again.
+ * Hence long keys with long common prefixes use 8 times less rounds than with octets digits.
+ * The groups of at most I_SORT_MODEL__INSERTION_THRESHOLD cells are sorted by insertion sort.
+ * It is not stable.
+ */
+int TSODLULS_sort_radix64_short_view(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements){
+  int i_result = 0;
+  t_TSODLULS_sort_element__short* arr_view = NULL;
+  t_TSODLULS_sort_element* arr_elements_copy = NULL;
+  t_TSODLULS_sort_element* p_group = NULL;
+  t_TSODLULS_radix_instance__no_copy* arr_instances = NULL;
+  size_t i_max_number_of_instances = 8;
+  size_t i_current_instance = 0;
+  void* p_for_realloc = NULL;
+  size_t i_size_for_realloc = 0;
+  t_TSODLULS_radix_instance__no_copy current_instance;
+  size_t i_group_size = 0;
+  size_t i_run_end = 0;
+  size_t i_number_of_continuing_keys = 0;
+
+  if(i_number_of_elements <= I_SORT_MODEL__INSERTION_THRESHOLD){
+    return TSODLULS_sort_insertion(arr_elements, i_number_of_elements);
+  }
+
+  arr_view = calloc(i_number_of_elements, sizeof(t_TSODLULS_sort_element__short));
+  arr_elements_copy = calloc(i_number_of_elements, sizeof(t_TSODLULS_sort_element));
+  arr_instances = calloc(i_max_number_of_instances, sizeof(t_TSODLULS_radix_instance__no_copy));
+  if(arr_view == NULL || arr_elements_copy == NULL || arr_instances == NULL){
+    free(arr_view);
+    free(arr_elements_copy);
+    free(arr_instances);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+
+  arr_instances[0].i_offset_first = 0;
+  arr_instances[0].i_offset_last = i_number_of_elements - 1;
+  arr_instances[0].i_depth = 0;
+  i_current_instance = 1;
+
+  while(i_current_instance > 0){
+    current_instance = arr_instances[--i_current_instance];
+    p_group = &(arr_elements[current_instance.i_offset_first]);
+    i_group_size = current_instance.i_offset_last - current_instance.i_offset_first + 1;
+    if(i_group_size <= I_SORT_MODEL__INSERTION_THRESHOLD){
+      TSODLULS_sort_insertion_from_offset(p_group, i_group_size, current_instance.i_depth);
+      continue;
+    }
+
+    i_result = TSODLULS_sort_by_key_word(
+        p_group,
+        i_group_size,
+        current_instance.i_depth,
+        arr_view,
+        arr_elements_copy,
+        TSODLULS_sort__short
+    );
+    if(i_result != 0){
+      break;
+    }
+
+    //the groups of equal words
+    for(size_t i_run_start = 0; i_run_start < i_group_size; i_run_start = i_run_end){
+      i_run_end = i_run_start + 1;
+      while(i_run_end < i_group_size && arr_view[i_run_end].i_key == arr_view[i_run_start].i_key){
+        ++i_run_end;
+      }
+      if(i_run_end - i_run_start < 2){
+        continue;
+      }
+      i_number_of_continuing_keys = TSODLULS_order_tied_keys_by_length(
+          &(p_group[i_run_start]),
+          i_run_end - i_run_start,
+          current_instance.i_depth,
+          arr_elements_copy
+      );
+      //the keys continuing after the word are sorted with the next word
+      if(i_number_of_continuing_keys < 2){
+        continue;
+      }
+      if(i_current_instance == i_max_number_of_instances){
+        i_size_for_realloc = i_max_number_of_instances * 2 * sizeof(t_TSODLULS_radix_instance__no_copy);
+        //if we cannot allocate more
+        if(i_size_for_realloc <= i_max_number_of_instances * sizeof(t_TSODLULS_radix_instance__no_copy)){
+          i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+          break;
+        }
+        p_for_realloc = realloc(arr_instances, i_size_for_realloc);
+        if(p_for_realloc == NULL){
+          i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+          break;
+        }
+        arr_instances = (t_TSODLULS_radix_instance__no_copy*)p_for_realloc;
+        i_max_number_of_instances *= 2;
+      }
+      arr_instances[i_current_instance].i_offset_first = current_instance.i_offset_first + i_run_end - i_number_of_continuing_keys;
+      arr_instances[i_current_instance].i_offset_last = current_instance.i_offset_first + i_run_end - 1;
+      arr_instances[i_current_instance].i_depth = current_instance.i_depth + 8;
+      ++i_current_instance;
+    }
+    if(i_result != 0){
+      break;
+    }
+  }
+
+  free(arr_view);
+  free(arr_elements_copy);
+  free(arr_instances);
+  return i_result;
+}//end function TSODLULS_sort_radix64_short_view()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A hybrid sort: the first 8 bytes of the keys are packed in short cells pointing to the long cells
+ * (see TSODLULS_sort_radix64_short_view()), that are sorted by TSODLULS_sort_radix8_count_insertion__short()
+ * and moved 16 bytes at a time instead of 32, then the long cells are permuted once,
+ * and only the runs of equal prefixes are sorted by TSODLULS_sort_radix8_count_insertion() from the byte 8.
+ * It is fast when most keys differ within their first 8 bytes.
+ * It is not stable.
+ */
+int TSODLULS_sort_prefix8_hybrid(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements){
+  int i_result = 0;
+  t_TSODLULS_sort_element__short* arr_view = NULL;
+  t_TSODLULS_sort_element* arr_elements_copy = NULL;
+  t_TSODLULS_sort_element* p_run = NULL;
+  size_t i_run_end = 0;
+  size_t i_number_of_continuing_keys = 0;
+
+  if(i_number_of_elements <= I_SORT_MODEL__INSERTION_THRESHOLD){
+    return TSODLULS_sort_insertion(arr_elements, i_number_of_elements);
+  }
+
+  arr_view = calloc(i_number_of_elements, sizeof(t_TSODLULS_sort_element__short));
+  arr_elements_copy = calloc(i_number_of_elements, sizeof(t_TSODLULS_sort_element));
+  if(arr_view == NULL || arr_elements_copy == NULL){
+    free(arr_view);
+    free(arr_elements_copy);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+
+  i_result = TSODLULS_sort_by_key_word(
+      arr_elements,
+      i_number_of_elements,
+      0,
+      arr_view,
+      arr_elements_copy,
+      TSODLULS_sort_radix8_count_insertion__short
+  );
+
+  //the runs of equal prefixes
+  for(size_t i_run_start = 0; i_run_start < i_number_of_elements && i_result == 0; i_run_start = i_run_end){
+    i_run_end = i_run_start + 1;
+    while(i_run_end < i_number_of_elements && arr_view[i_run_end].i_key == arr_view[i_run_start].i_key){
+      ++i_run_end;
+    }
+    if(i_run_end - i_run_start < 2){
+      continue;
+    }
+    i_number_of_continuing_keys = TSODLULS_order_tied_keys_by_length(
+        &(arr_elements[i_run_start]),
+        i_run_end - i_run_start,
+        0,
+        arr_elements_copy
+    );
+    if(i_number_of_continuing_keys < 2){
+      continue;
+    }
+    //the long engine sorts the keys after the prefix
+    p_run = &(arr_elements[i_run_end - i_number_of_continuing_keys]);
+    for(size_t i = 0; i < i_number_of_continuing_keys; ++i){
+      p_run[i].s_key += 8;
+      p_run[i].i_key_size -= 8;
+    }
+    i_result = TSODLULS_sort_radix8_count_insertion(p_run, i_number_of_continuing_keys);
+    for(size_t i = 0; i < i_number_of_continuing_keys; ++i){
+      p_run[i].s_key -= 8;
+      p_run[i].i_key_size += 8;
+    }
+  }
+
+  free(arr_view);
+  free(arr_elements_copy);
+  return i_result;
+}//end function TSODLULS_sort_prefix8_hybrid()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A sort where the keys are built lazily: the keys contain the TSO-encoding of the first
+ * i_number_of_fields_in_keys fields of the objects, and after a sort, the cells with equal keys
+ * get the next field with p_key_extender->f_add_field() and are sorted again by this field,
+ * until their keys differ or all the fields are in their keys.
+ * With i_number_of_fields_in_keys == 0, the keys are empty (s_key may be NULL) and all the cells get the first field.
+ * Hence the encoding time is only spent on ties, when the first fields almost always decide the order.
+ * The encoding of each field must not be a prefix of another encoding of this field,
+ * like the encodings of TSODLULS_finite_orders.c, so that the order is the order of the full keys.
+ * The errors of TSODLULS_sort() and of f_add_field() are returned.
+ * It is not stable.
+ */
+int TSODLULS_sort_with_lazy_keys(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_fields_in_keys,
+  const t_TSODLULS_key_extender* p_key_extender
+){
+  int i_result = 0;
+  t_TSODLULS_radix_instance__no_copy* arr_instances = NULL;
+  size_t i_max_number_of_instances = 8;
+  size_t i_current_instance = 0;
+  void* p_for_realloc = NULL;
+  size_t i_size_for_realloc = 0;
+  t_TSODLULS_radix_instance__no_copy current_instance;
+  t_TSODLULS_sort_element* p_run = NULL;
+  size_t i_run_end = 0;
+  size_t i_run_size = 0;
+  size_t i_prefix_size = 0;
+
+  //without fields, the keys are all empty (maybe NULL), hence already sorted and all tied
+  if(i_number_of_fields_in_keys > 0){
+    i_result = TSODLULS_sort(arr_elements, i_number_of_elements);
+  }
+  if(i_result != 0 || i_number_of_elements < 2 || i_number_of_fields_in_keys >= p_key_extender->i_number_of_fields){
+    return i_result;
+  }
+
+  arr_instances = calloc(i_max_number_of_instances, sizeof(t_TSODLULS_radix_instance__no_copy));
+  if(arr_instances == NULL){
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  //the instances are sorted ranges whose cells with equal keys need the field i_depth
+  arr_instances[0].i_offset_first = 0;
+  arr_instances[0].i_offset_last = i_number_of_elements - 1;
+  arr_instances[0].i_depth = i_number_of_fields_in_keys;
+  i_current_instance = 1;
+
+  while(i_current_instance > 0 && i_result == 0){
+    current_instance = arr_instances[--i_current_instance];
+    for(
+      size_t i_run_start = current_instance.i_offset_first;
+      i_run_start <= current_instance.i_offset_last;
+      i_run_start = i_run_end
+    ){
+      p_run = &(arr_elements[i_run_start]);
+      i_prefix_size = p_run[0].i_key_size;
+      i_run_end = i_run_start + 1;
+      while(
+        i_run_end <= current_instance.i_offset_last
+        && arr_elements[i_run_end].i_key_size == i_prefix_size
+        && (i_prefix_size == 0 || memcmp(arr_elements[i_run_end].s_key, p_run[0].s_key, i_prefix_size) == 0)
+      ){
+        ++i_run_end;
+      }
+      i_run_size = i_run_end - i_run_start;
+      if(i_run_size < 2){
+        continue;
+      }
+
+      //the tied cells get the next field and are sorted by this field only
+      for(size_t i = 0; i < i_run_size && i_result == 0; ++i){
+        i_result = p_key_extender->f_add_field(&(p_run[i]), current_instance.i_depth, p_key_extender->p_context);
+      }
+      if(i_result != 0){
+        break;
+      }
+      for(size_t i = 0; i < i_run_size; ++i){
+        p_run[i].s_key += i_prefix_size;
+        p_run[i].i_key_size -= i_prefix_size;
+      }
+      i_result = TSODLULS_sort(p_run, i_run_size);
+      for(size_t i = 0; i < i_run_size; ++i){
+        p_run[i].s_key -= i_prefix_size;
+        p_run[i].i_key_size += i_prefix_size;
+      }
+      if(i_result != 0){
+        break;
+      }
+      if(current_instance.i_depth + 1 >= p_key_extender->i_number_of_fields){
+        continue;
+      }
+
+      if(i_current_instance == i_max_number_of_instances){
+        i_size_for_realloc = i_max_number_of_instances * 2 * sizeof(t_TSODLULS_radix_instance__no_copy);
+        //if we cannot allocate more
+        if(i_size_for_realloc <= i_max_number_of_instances * sizeof(t_TSODLULS_radix_instance__no_copy)){
+          i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+          break;
+        }
+        p_for_realloc = realloc(arr_instances, i_size_for_realloc);
+        if(p_for_realloc == NULL){
+          i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+          break;
+        }
+        arr_instances = (t_TSODLULS_radix_instance__no_copy*)p_for_realloc;
+        i_max_number_of_instances *= 2;
+      }
+      arr_instances[i_current_instance].i_offset_first = i_run_start;
+      arr_instances[i_current_instance].i_offset_last = i_run_end - 1;
+      arr_instances[i_current_instance].i_depth = current_instance.i_depth + 1;
+      ++i_current_instance;
+    }
+  }
+
+  free(arr_instances);
+  return i_result;
+}//end function TSODLULS_sort_with_lazy_keys()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Initialize an order-preserving dictionary with the distinct keys of the cells:
+ * the keys are sorted once and each distinct key gets its rank as an uint64.
+ * The keys are copied in the dictionary, hence the cells can be freed or reused afterwards,
+ * and the dictionary can be used for all the sorts of cells whose keys are in it
+ * (see TSODLULS_sort_with_key_dictionary()). Free it with TSODLULS_key_dictionary_free().
+ */
+int TSODLULS_key_dictionary_init(
+  t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+){
+  int i_result = 0;
+  size_t i_max_number_of_keys = 16;
+  size_t i_slot = 0;
+  void* p_for_realloc = NULL;
+  t_TSODLULS_sort_element* p_key = NULL;
+  uint8_t* s_space = NULL;
+
+  TSODLULS_key_arena_init(&(p_dictionary->key_arena), 0);
+  p_dictionary->arr_keys = calloc(i_max_number_of_keys, sizeof(t_TSODLULS_sort_element));
+  p_dictionary->i_number_of_keys = 0;
+  p_dictionary->arr_slots = NULL;
+  p_dictionary->i_number_of_slots = 0;
+  p_dictionary->i_max_length = 1;
+  if(p_dictionary->arr_keys == NULL){
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  i_result = TSODLULS_key_dictionary_rehash(p_dictionary, 2 * i_max_number_of_keys);
+  if(i_result != 0){
+    TSODLULS_key_dictionary_free(p_dictionary);
+    return i_result;
+  }
+
+  //the distinct keys are found with the hash table, without sorting all the cells
+  for(size_t i = 0; i < i_number_of_elements; ++i){
+    i_slot = TSODLULS_key_dictionary_find_slot(p_dictionary, &(arr_elements[i]));
+    if(p_dictionary->arr_slots[i_slot] != 0){
+      continue;
+    }
+    if(p_dictionary->i_number_of_keys == i_max_number_of_keys){
+      p_for_realloc = realloc(p_dictionary->arr_keys, 2 * i_max_number_of_keys * sizeof(t_TSODLULS_sort_element));
+      if(p_for_realloc == NULL){
+        TSODLULS_key_dictionary_free(p_dictionary);
+        return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      }
+      p_dictionary->arr_keys = (t_TSODLULS_sort_element*)p_for_realloc;
+      i_max_number_of_keys *= 2;
+    }
+    p_dictionary->arr_keys[p_dictionary->i_number_of_keys] = arr_elements[i];
+    p_dictionary->arr_slots[i_slot] = ++p_dictionary->i_number_of_keys;
+    if(2 * p_dictionary->i_number_of_keys > p_dictionary->i_number_of_slots){
+      i_result = TSODLULS_key_dictionary_rehash(p_dictionary, 2 * p_dictionary->i_number_of_slots);
+      if(i_result != 0){
+        TSODLULS_key_dictionary_free(p_dictionary);
+        return i_result;
+      }
+    }
+  }
+
+  //the distinct keys in increasing order, the ranks are their new indexes
+  TSODLULS_pdqsort(p_dictionary->arr_keys, p_dictionary->i_number_of_keys);
+  for(size_t i = 0; i < p_dictionary->i_number_of_keys; ++i){
+    p_key = &(p_dictionary->arr_keys[i]);
+    i_result = TSODLULS_key_arena_allocate(&(p_dictionary->key_arena), p_key->i_key_size, &s_space);
+    if(i_result != 0){
+      TSODLULS_key_dictionary_free(p_dictionary);
+      return i_result;
+    }
+    memcpy(s_space, p_key->s_key, p_key->i_key_size);
+    p_key->s_key = s_space;
+    p_key->i_allocated_size = I_KEY_ARENA_FLAG | p_key->i_key_size;
+    p_key->p_object = NULL;
+  }
+  i_result = TSODLULS_key_dictionary_rehash(p_dictionary, p_dictionary->i_number_of_slots);
+  if(i_result != 0){
+    TSODLULS_key_dictionary_free(p_dictionary);
+    return i_result;
+  }
+
+  //the number of bytes of the greatest rank
+  while(
+    p_dictionary->i_number_of_keys > 1
+    && p_dictionary->i_max_length < 8
+    && (((uint64_t)(p_dictionary->i_number_of_keys - 1)) >> (8 * p_dictionary->i_max_length)) != 0
+  ){
+    ++p_dictionary->i_max_length;
+  }
+  return 0;
+}//end function TSODLULS_key_dictionary_init()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Free the keys and the hash table of a dictionary of keys
  */
-int TSODLULS_sort(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements){
-  return TSODLULS_sort_radix8_count_insertion(arr_elements, i_number_of_elements);
-}//end function TSODLULS_sort()
+void TSODLULS_key_dictionary_free(t_TSODLULS_key_dictionary* p_dictionary){
+  TSODLULS_key_arena_free(&(p_dictionary->key_arena));
+  free(p_dictionary->arr_keys);
+  free(p_dictionary->arr_slots);
+  p_dictionary->arr_keys = NULL;
+  p_dictionary->i_number_of_keys = 0;
+  p_dictionary->arr_slots = NULL;
+  p_dictionary->i_number_of_slots = 0;
+}//end function TSODLULS_key_dictionary_free()
 
 
 
 /**
  * Sorting functions for long nextified strings
- * The current state of the art stable sorting function for nextified strings.
- * Its implementation may change without warning.
+ * Find the rank of the key of a cell in a dictionary of keys
+ * Returns I_ERROR__KEY_NOT_IN_DICTIONARY if the key was not in the cells of TSODLULS_key_dictionary_init().
  */
-int TSODLULS_sort_stable(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements){
-  return TSODLULS_sort_radix8_count_insertion(arr_elements, i_number_of_elements);
-}//end function TSODLULS_sort_stable()
+int TSODLULS_key_dictionary_get_rank(
+  const t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* p_sort_element,
+  uint64_t* p_i_rank
+){
+  size_t i_slot = TSODLULS_key_dictionary_find_slot(p_dictionary, p_sort_element);
+  if(p_dictionary->arr_slots[i_slot] == 0){
+    return I_ERROR__KEY_NOT_IN_DICTIONARY;
+  }
+  *p_i_rank = p_dictionary->arr_slots[i_slot] - 1;
+  return 0;
+}//end function TSODLULS_key_dictionary_get_rank()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Rewrite long cells as short cells whose keys are the ranks of the long keys in a dictionary of keys:
+ * arr_elements__short[i] has the object of arr_elements[i] and the short key of its key,
+ * so that the short cells are in the same order as the long cells.
+ * Returns I_ERROR__KEY_NOT_IN_DICTIONARY if a key is not in the dictionary.
+ */
+int TSODLULS_key_dictionary_fill_short_cells(
+  const t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  t_TSODLULS_sort_element__short* arr_elements__short
+){
+  int i_result = 0;
+  uint64_t i_rank = 0;
+
+  for(size_t i = 0; i < i_number_of_elements; ++i){
+    i_result = TSODLULS_key_dictionary_get_rank(p_dictionary, &(arr_elements[i]), &i_rank);
+    if(i_result != 0){
+      return i_result;
+    }
+    arr_elements__short[i].p_object = arr_elements[i].p_object;
+    arr_elements__short[i].i_key = i_rank << (8 * (8 - p_dictionary->i_max_length));
+  }
+  return 0;
+}//end function TSODLULS_key_dictionary_fill_short_cells()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Sort long cells with few distinct keys as short cells: the cells are rewritten in arr_elements__short
+ * with the ranks of their keys in the dictionary (see TSODLULS_key_dictionary_fill_short_cells()),
+ * and sorted with TSODLULS_sort__short() on the i_max_length bytes of the ranks.
+ * The objects are sorted in arr_elements__short, arr_elements is not modified.
+ * It is not stable.
+ */
+int TSODLULS_sort_with_key_dictionary(
+  const t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  t_TSODLULS_sort_element__short* arr_elements__short
+){
+  int i_result = TSODLULS_key_dictionary_fill_short_cells(
+      p_dictionary,
+      arr_elements,
+      i_number_of_elements,
+      arr_elements__short
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+  return TSODLULS_sort__short(arr_elements__short, i_number_of_elements, p_dictionary->i_max_length);
+}//end function TSODLULS_sort_with_key_dictionary()
 
 
 
@@ -104,6 +2262,7 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
         ++arr_counts[i_current_octet];
       }
     }
+    TSODLULS_SORT_STATS_ADD(i_histogram_passes, 1);
     //we deduce the offsets
     i_number_of_distinct_bytes = 0;
     for(int i = 0; i < 255; ++i){
@@ -117,6 +2276,7 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
     }
 
     if(i_number_of_distinct_bytes == 1){
+      TSODLULS_SORT_STATS_ADD(i_single_byte_skips, 1);
       ++current_instance.i_depth;
       if(current_instance.b_copy){
         //if we are done sorting this instance and all deeper subinstances
@@ -126,6 +2286,10 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
               &(arr_elements_copy[current_instance.i_offset_first]),
               (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element)
           );
+          TSODLULS_SORT_STATS_ADD(
+            i_bytes_memcpy,
+            (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element)
+          );
           if(i_current_instance == 0){
             break;
           }
@@ -151,6 +2315,10 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
         arr_elements[current_instance.i_offset_first + arr_offsets[i_current_octet]] = arr_elements_copy[i];
         ++arr_offsets[i_current_octet];
       }
+      TSODLULS_SORT_STATS_ADD(
+        i_bytes_scattered,
+        (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element)
+      );
       //instances creation
       for(int i = 0; i < 256; ++i){
         if(arr_counts[i] > 1//nothing to do for one element, result is in original array
@@ -175,6 +2343,7 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
             }
             arr_instances = (t_TSODLULS_radix_instance*)p_for_realloc;
             i_max_number_of_instances *= 2;
+            TSODLULS_SORT_STATS_ADD(i_instances_reallocs, 1);
           }
           arr_instances[i_current_instance].i_offset_first = current_instance.i_offset_first
                                                            + arr_offsets[i] - arr_counts[i];
@@ -183,6 +2352,8 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
           arr_instances[i_current_instance].i_depth = current_instance.i_depth + 1;
           arr_instances[i_current_instance].b_copy = 0;
           ++i_current_instance;
+          TSODLULS_SORT_STATS_ADD(i_instances_pushed, 1);
+          TSODLULS_SORT_STATS_MAX(i_max_instance_stack_depth, i_current_instance);
         }
       }//end for(int i = 0; i < 256; ++i)
     }
@@ -193,6 +2364,10 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
         arr_elements_copy[current_instance.i_offset_first + arr_offsets[i_current_octet]] = arr_elements[i];
         ++arr_offsets[i_current_octet];
       }
+      TSODLULS_SORT_STATS_ADD(
+        i_bytes_scattered,
+        (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element)
+      );
       //instances creation
       for(int i = 0; i < 256; ++i){
         if(arr_counts[i] > 1
@@ -217,6 +2392,7 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
             }
             arr_instances = (t_TSODLULS_radix_instance*)p_for_realloc;
             i_max_number_of_instances *= 2;
+            TSODLULS_SORT_STATS_ADD(i_instances_reallocs, 1);
           }
           arr_instances[i_current_instance].i_offset_first = current_instance.i_offset_first
                                                            + arr_offsets[i] - arr_counts[i];
@@ -225,6 +2401,8 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
           arr_instances[i_current_instance].i_depth = current_instance.i_depth + 1;
           arr_instances[i_current_instance].b_copy = 1;
           ++i_current_instance;
+          TSODLULS_SORT_STATS_ADD(i_instances_pushed, 1);
+          TSODLULS_SORT_STATS_MAX(i_max_instance_stack_depth, i_current_instance);
         }
         else if(arr_counts[i] > 0){//we still need to copy data in original array
           memcpy(
@@ -232,6 +2410,7 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
             &(arr_elements_copy[current_instance.i_offset_first + arr_offsets[i] - arr_counts[i]]),
             arr_counts[i] * sizeof(t_TSODLULS_sort_element)
           );
+          TSODLULS_SORT_STATS_ADD(i_bytes_memcpy, arr_counts[i] * sizeof(t_TSODLULS_sort_element));
         }
       }//end for(int i = 0; i < 256; ++i)
     }
@@ -252,29 +2431,40 @@ int TSODLULS_sort_radix8_count(t_TSODLULS_sort_element* arr_elements, size_t i_n
 
 /**
  * Sorting functions for long nextified strings
- * A stable sorting algorithm for nextified strings based on radix sort with octets digits
- * and counting sort as a subroutine.
- * When the number of elements to sort is at most: 5 for initial sort or 2 for radix sequel, we use insertion sort
+ * TSODLULS_sort_radix8_count_insertion() in buffers given by the caller,
+ * so that they can be shared by many sorts: arr_elements_copy has room for i_number_of_elements cells
+ * and *p_arr_instances for *p_i_max_number_of_instances instances (at least 1).
+ * The stack of instances is reallocated when needed, the caller frees it even after an error.
+ * The buffers are not used when there is at most 5 elements.
  */
-int TSODLULS_sort_radix8_count_insertion(
+static int TSODLULS_sort_radix8_count_insertion_in_buffers(
   t_TSODLULS_sort_element* arr_elements,
-  size_t i_number_of_elements
+  size_t i_number_of_elements,
+  t_TSODLULS_sort_element* arr_elements_copy,
+  t_TSODLULS_radix_instance** p_arr_instances,
+  size_t* p_i_max_number_of_instances
 ){
 
   int i_number_of_distinct_bytes = 0;
   size_t arr_counts[256];
   size_t arr_offsets[256];
   uint8_t i_current_octet = 0;
-  t_TSODLULS_sort_element* arr_elements_copy = NULL;
   t_TSODLULS_radix_instance current_instance;
-  t_TSODLULS_radix_instance* arr_instances = NULL;
-  size_t i_max_number_of_instances = 0;
+  t_TSODLULS_radix_instance* arr_instances = *p_arr_instances;
+  size_t i_max_number_of_instances = *p_i_max_number_of_instances;
   size_t i_current_instance = 0;
   void* p_for_realloc = NULL;
   size_t i_size_for_realloc = 0;
   t_TSODLULS_sort_element tmp_cell;
   t_TSODLULS_sort_element* p_cell1;
   t_TSODLULS_sort_element* p_cell2;
+  int i_comparison = 0;
+  uint64_t TSODLULS_macraff_ui64;
+  uint64_t TSODLULS_macraff_ui64_2;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
 
 #define min(x, y) ((x) < (y) ? (x) : (y))
 
@@ -291,18 +2481,6 @@ int TSODLULS_sort_radix8_count_insertion(
   current_instance.i_depth = 0;
   current_instance.b_copy = 0;
 
-  arr_elements_copy = calloc(i_number_of_elements, sizeof(t_TSODLULS_sort_element));
-  if(arr_elements_copy == NULL){
-    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
-  }
-
-  arr_instances = calloc(8, sizeof(t_TSODLULS_radix_instance));
-  if(arr_instances == NULL){
-    TSODLULS_free(arr_elements_copy);
-    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
-  }
-  i_max_number_of_instances =  8;
-
   while(1){
     //we initialize the counters
     for(int i = 0; i < 256; ++i){
@@ -322,6 +2500,7 @@ int TSODLULS_sort_radix8_count_insertion(
         ++arr_counts[i_current_octet];
       }
     }
+    TSODLULS_SORT_STATS_ADD(i_histogram_passes, 1);
     //we deduce the offsets
     i_number_of_distinct_bytes = 0;
     for(int i = 0; i < 255; ++i){
@@ -335,6 +2514,7 @@ int TSODLULS_sort_radix8_count_insertion(
     }
 
     if(i_number_of_distinct_bytes == 1){
+      TSODLULS_SORT_STATS_ADD(i_single_byte_skips, 1);
       ++current_instance.i_depth;
       if(current_instance.b_copy){
         //if we are done sorting this instance and all deeper subinstances
@@ -344,6 +2524,10 @@ int TSODLULS_sort_radix8_count_insertion(
               &(arr_elements_copy[current_instance.i_offset_first]),
               (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element)
           );
+          TSODLULS_SORT_STATS_ADD(
+            i_bytes_memcpy,
+            (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element)
+          );
           if(i_current_instance == 0){
             break;
           }
@@ -369,6 +2553,10 @@ int TSODLULS_sort_radix8_count_insertion(
         arr_elements[current_instance.i_offset_first + arr_offsets[i_current_octet]] = arr_elements_copy[i];
         ++arr_offsets[i_current_octet];
       }
+      TSODLULS_SORT_STATS_ADD(
+        i_bytes_scattered,
+        (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element)
+      );
       //instances creation
       for(int i = 0; i < 256; ++i){
         if(arr_counts[i] > 2
@@ -381,18 +2569,19 @@ int TSODLULS_sort_radix8_count_insertion(
             i_size_for_realloc = i_max_number_of_instances * 2 * sizeof(t_TSODLULS_radix_instance);
             //if we cannot allocate more
             if(i_size_for_realloc <= i_max_number_of_instances * sizeof(t_TSODLULS_radix_instance)){
-              TSODLULS_free(arr_elements_copy);
-              TSODLULS_free(arr_instances);
+              *p_arr_instances = arr_instances;
+              *p_i_max_number_of_instances = i_max_number_of_instances;
               return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
             }
             p_for_realloc = realloc(arr_instances, i_size_for_realloc);
             if(p_for_realloc == NULL){
-              TSODLULS_free(arr_elements_copy);
-              TSODLULS_free(arr_instances);
+              *p_arr_instances = arr_instances;
+              *p_i_max_number_of_instances = i_max_number_of_instances;
               return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
             }
             arr_instances = (t_TSODLULS_radix_instance*)p_for_realloc;
             i_max_number_of_instances *= 2;
+            TSODLULS_SORT_STATS_ADD(i_instances_reallocs, 1);
           }
           arr_instances[i_current_instance].i_offset_first = current_instance.i_offset_first
                                                            + arr_offsets[i] - arr_counts[i];
@@ -401,22 +2590,20 @@ int TSODLULS_sort_radix8_count_insertion(
           arr_instances[i_current_instance].i_depth = current_instance.i_depth + 1;
           arr_instances[i_current_instance].b_copy = 0;
           ++i_current_instance;
+          TSODLULS_SORT_STATS_ADD(i_instances_pushed, 1);
+          TSODLULS_SORT_STATS_MAX(i_max_instance_stack_depth, i_current_instance);
         }
         else if(arr_counts[i] == 2
           //for nextified strings this test can be done on only one element
           && arr_elements[current_instance.i_offset_first + arr_offsets[i] - 1].i_key_size
                > current_instance.i_depth + 1
         ){
+          TSODLULS_SORT_STATS_ADD(i_insertion_sorts, 1);
           p_cell1 = &(arr_elements[current_instance.i_offset_first + arr_offsets[i] - 2]);
           p_cell2 = p_cell1 + 1;
-          for(size_t j = current_instance.i_depth + 1, j_max = min(p_cell1->i_key_size, p_cell2->i_key_size); j < j_max; ++j){
-            if(p_cell2->s_key[j] < p_cell1->s_key[j]){
-              tmp_cell = *p_cell1; *p_cell1 = *p_cell2; *p_cell2 = tmp_cell;//swapping
-              break;
-            }
-            if(p_cell2->s_key[j] > p_cell1->s_key[j]){
-              break;
-            }
+          TSODLULS_compare_nextified_keys_in_cells__macraff(i_comparison, p_cell1, p_cell2, current_instance.i_depth + 1);
+          if(i_comparison > 0){
+            tmp_cell = *p_cell1; *p_cell1 = *p_cell2; *p_cell2 = tmp_cell;//swapping
           }
         }
       }//end for(int i = 0; i < 256; ++i)
@@ -428,6 +2615,10 @@ int TSODLULS_sort_radix8_count_insertion(
         arr_elements_copy[current_instance.i_offset_first + arr_offsets[i_current_octet]] = arr_elements[i];
         ++arr_offsets[i_current_octet];
       }
+      TSODLULS_SORT_STATS_ADD(
+        i_bytes_scattered,
+        (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element)
+      );
       //instances creation
       for(int i = 0; i < 256; ++i){
         if(arr_counts[i] > 2
@@ -440,18 +2631,19 @@ int TSODLULS_sort_radix8_count_insertion(
             i_size_for_realloc = i_max_number_of_instances * 2 * sizeof(t_TSODLULS_radix_instance);
             //if we cannot allocate more
             if(i_size_for_realloc <= i_max_number_of_instances * sizeof(t_TSODLULS_radix_instance)){
-              TSODLULS_free(arr_elements_copy);
-              TSODLULS_free(arr_instances);
+              *p_arr_instances = arr_instances;
+              *p_i_max_number_of_instances = i_max_number_of_instances;
               return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
             }
             p_for_realloc = realloc(arr_instances, i_size_for_realloc);
             if(p_for_realloc == NULL){
-              TSODLULS_free(arr_elements_copy);
-              TSODLULS_free(arr_instances);
+              *p_arr_instances = arr_instances;
+              *p_i_max_number_of_instances = i_max_number_of_instances;
               return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
             }
             arr_instances = (t_TSODLULS_radix_instance*)p_for_realloc;
             i_max_number_of_instances *= 2;
+            TSODLULS_SORT_STATS_ADD(i_instances_reallocs, 1);
           }
           arr_instances[i_current_instance].i_offset_first = current_instance.i_offset_first
                                                            + arr_offsets[i] - arr_counts[i];
@@ -460,6 +2652,8 @@ int TSODLULS_sort_radix8_count_insertion(
           arr_instances[i_current_instance].i_depth = current_instance.i_depth + 1;
           arr_instances[i_current_instance].b_copy = 1;
           ++i_current_instance;
+          TSODLULS_SORT_STATS_ADD(i_instances_pushed, 1);
+          TSODLULS_SORT_STATS_MAX(i_max_instance_stack_depth, i_current_instance);
         }
         else if(arr_counts[i] > 0){//we still need to copy data in original array
           memcpy(
@@ -467,21 +2661,18 @@ int TSODLULS_sort_radix8_count_insertion(
             &(arr_elements_copy[current_instance.i_offset_first + arr_offsets[i] - arr_counts[i]]),
             arr_counts[i] * sizeof(t_TSODLULS_sort_element)
           );
+          TSODLULS_SORT_STATS_ADD(i_bytes_memcpy, arr_counts[i] * sizeof(t_TSODLULS_sort_element));
           if(arr_counts[i] == 2
             //for nextified strings this test can be done on only one element
             && arr_elements_copy[current_instance.i_offset_first + arr_offsets[i] - 1].i_key_size
                  > current_instance.i_depth + 1
           ){
+            TSODLULS_SORT_STATS_ADD(i_insertion_sorts, 1);
             p_cell1 = &(arr_elements[current_instance.i_offset_first + arr_offsets[i] - 2]);
             p_cell2 = p_cell1 + 1;
-            for(size_t j = current_instance.i_depth + 1, j_max = min(p_cell1->i_key_size, p_cell2->i_key_size); j < j_max; ++j){
-              if(p_cell2->s_key[j] < p_cell1->s_key[j]){
-                tmp_cell = *p_cell1; *p_cell1 = *p_cell2; *p_cell2 = tmp_cell;//swapping
-                break;
-              }
-              if(p_cell2->s_key[j] > p_cell1->s_key[j]){
-                break;
-              }
+            TSODLULS_compare_nextified_keys_in_cells__macraff(i_comparison, p_cell1, p_cell2, current_instance.i_depth + 1);
+            if(i_comparison > 0){
+              tmp_cell = *p_cell1; *p_cell1 = *p_cell2; *p_cell2 = tmp_cell;//swapping
             }
           }
         }
@@ -495,8 +2686,8 @@ int TSODLULS_sort_radix8_count_insertion(
     current_instance = arr_instances[--i_current_instance];
   }//end while(true)
 
-  TSODLULS_free(arr_elements_copy);
-  TSODLULS_free(arr_instances);
+  *p_arr_instances = arr_instances;
+  *p_i_max_number_of_instances = i_max_number_of_instances;
 
   return 0;//this is costly to scan again all memory with insertion sort at the end
   //If there is at most 5 elements that's what we use, otherwise we continue what we started with radix
@@ -509,28 +2700,22 @@ int TSODLULS_sort_radix8_count_insertion(
      the array (*not* one beyond it!). */
 
   label_insertion_sort:
+  TSODLULS_SORT_STATS_ADD(i_insertion_sorts, 1);
   {
     t_TSODLULS_sort_element* const end_ptr = &arr_elements[(i_number_of_elements - 1)];
     t_TSODLULS_sort_element* tmp_ptr = arr_elements;
     t_TSODLULS_sort_element* thresh = min(end_ptr, arr_elements + 5);
     t_TSODLULS_sort_element* run_ptr;
-    size_t i;
-    size_t i_max;
 
     /* Find smallest element in first threshold and place it at the
        array's beginning.  This is the smallest array element,
        and the operation speeds up insertion sort's inner loop. */
 
     for(run_ptr = tmp_ptr + 1; run_ptr <= thresh; ++run_ptr){
-      //nextified strings
-      for(i = 0, i_max = min(run_ptr->i_key_size, tmp_ptr->i_key_size); i < i_max; ++i){
-        if(run_ptr->s_key[i] < tmp_ptr->s_key[i]){
-          tmp_ptr = run_ptr;
-          break;
-        }
-        if(run_ptr->s_key[i] > tmp_ptr->s_key[i]){
-          break;
-        }
+      //nextified strings, 8 bytes at a time
+      TSODLULS_compare_nextified_keys_in_cells__macraff(i_comparison, run_ptr, tmp_ptr, 0);
+      if(i_comparison < 0){
+        tmp_ptr = run_ptr;
       }
     }
 
@@ -543,30 +2728,15 @@ int TSODLULS_sort_radix8_count_insertion(
     while((++run_ptr) <= end_ptr){
       tmp_ptr = run_ptr - 1;
       int b_do_while = 0;
-      //nextified strings
-      for(i = 0, i_max = min(run_ptr->i_key_size, tmp_ptr->i_key_size); i < i_max; ++i){
-        if(run_ptr->s_key[i] < tmp_ptr->s_key[i]){
-          b_do_while = 1;
-          break;
-        }
-        if(run_ptr->s_key[i] > tmp_ptr->s_key[i]){
-          break;
-        }
-      }
+      //nextified strings, 8 bytes at a time
+      TSODLULS_compare_nextified_keys_in_cells__macraff(i_comparison, run_ptr, tmp_ptr, 0);
+      b_do_while = i_comparison < 0;
       //while(run_ptr->i_key < tmp_ptr->i_key){
       while(b_do_while){
         --tmp_ptr;
-        b_do_while = 0;
-        //nextified strings
-        for(i = 0, i_max = min(run_ptr->i_key_size, tmp_ptr->i_key_size); i < i_max; ++i){
-          if(run_ptr->s_key[i] < tmp_ptr->s_key[i]){
-            b_do_while = 1;
-            break;
-          }
-          if(run_ptr->s_key[i] > tmp_ptr->s_key[i]){
-            break;
-          }
-        }
+        //nextified strings, 8 bytes at a time
+        TSODLULS_compare_nextified_keys_in_cells__macraff(i_comparison, run_ptr, tmp_ptr, 0);
+        b_do_while = i_comparison < 0;
       }
       ++tmp_ptr;
       if(tmp_ptr != run_ptr){
@@ -587,7 +2757,474 @@ int TSODLULS_sort_radix8_count_insertion(
   }
 
   return 0;
+}//end function TSODLULS_sort_radix8_count_insertion_in_buffers()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A stable sorting algorithm for nextified strings based on radix sort with octets digits
+ * and counting sort as a subroutine.
+ * When the number of elements to sort is at most: 5 for initial sort or 2 for radix sequel, we use insertion sort
+ */
+int TSODLULS_sort_radix8_count_insertion(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+){
+  int i_result = 0;
+  t_TSODLULS_sort_element* arr_elements_copy = NULL;
+  t_TSODLULS_radix_instance* arr_instances = NULL;
+  size_t i_max_number_of_instances = 0;
+
+  if(i_number_of_elements > 5){
+    arr_elements_copy = calloc(i_number_of_elements, sizeof(t_TSODLULS_sort_element));
+    if(arr_elements_copy == NULL){
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+
+    arr_instances = calloc(8, sizeof(t_TSODLULS_radix_instance));
+    if(arr_instances == NULL){
+      TSODLULS_free(arr_elements_copy);
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    i_max_number_of_instances =  8;
+  }
+
+  i_result = TSODLULS_sort_radix8_count_insertion_in_buffers(
+      arr_elements,
+      i_number_of_elements,
+      arr_elements_copy,
+      &arr_instances,
+      &i_max_number_of_instances
+  );
+
+  TSODLULS_free(arr_elements_copy);
+  TSODLULS_free(arr_instances);
+
+  return i_result;
 }//end function TSODLULS_sort_radix8_count_insertion()
 
 
 
+/**
+ * Sorting functions for long nextified strings
+ * Sort independently the segments of the array: the segment i is made of the cells from
+ * arr_segment_offsets[i] included to arr_segment_offsets[i + 1] excluded,
+ * arr_segment_offsets has i_number_of_segments + 1 non-decreasing offsets.
+ * The buffers of the radix sort are allocated once for all the segments,
+ * and small segments are sorted by insertion sort.
+ * It is not stable.
+ */
+int TSODLULS_sort_segmented(
+  t_TSODLULS_sort_element* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments
+){
+  int i_result = 0;
+  size_t i_number_of_elements = 0;
+  size_t i_max_number_of_elements = 0;
+  t_TSODLULS_sort_element* arr_elements_copy = NULL;
+  t_TSODLULS_radix_instance* arr_instances = NULL;
+  size_t i_max_number_of_instances = 0;
+
+  //the buffers are sized for the biggest segment
+  for(size_t i = 0; i < i_number_of_segments; ++i){
+    if(arr_segment_offsets[i + 1] < arr_segment_offsets[i]){
+      return I_ERROR__SEGMENT_OFFSETS_SHOULD_BE_NON_DECREASING;
+    }
+    i_number_of_elements = arr_segment_offsets[i + 1] - arr_segment_offsets[i];
+    if(i_number_of_elements > i_max_number_of_elements){
+      i_max_number_of_elements = i_number_of_elements;
+    }
+  }
+
+  if(i_max_number_of_elements > I_SORT_MODEL__INSERTION_THRESHOLD){
+    arr_elements_copy = calloc(i_max_number_of_elements, sizeof(t_TSODLULS_sort_element));
+    if(arr_elements_copy == NULL){
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+
+    //the stack of instances grows when needed and is kept for the next segments
+    arr_instances = calloc(8, sizeof(t_TSODLULS_radix_instance));
+    if(arr_instances == NULL){
+      TSODLULS_free(arr_elements_copy);
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    i_max_number_of_instances =  8;
+  }
+
+  for(size_t i = 0; i < i_number_of_segments && i_result == 0; ++i){
+    i_number_of_elements = arr_segment_offsets[i + 1] - arr_segment_offsets[i];
+    if(i_number_of_elements <= I_SORT_MODEL__INSERTION_THRESHOLD){
+      i_result = TSODLULS_sort_insertion(&(arr_elements[arr_segment_offsets[i]]), i_number_of_elements);
+    }
+    else{
+      i_result = TSODLULS_sort_radix8_count_insertion_in_buffers(
+          &(arr_elements[arr_segment_offsets[i]]),
+          i_number_of_elements,
+          arr_elements_copy,
+          &arr_instances,
+          &i_max_number_of_instances
+      );
+    }
+  }
+
+  TSODLULS_free(arr_elements_copy);
+  TSODLULS_free(arr_instances);
+
+  return i_result;
+}//end function TSODLULS_sort_segmented()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Same as TSODLULS_sort_segmented() with the segments spread across i_number_of_threads threads
+ * (including the calling thread), each thread sorting consecutive segments with its own buffers.
+ * If a thread cannot be created, its segments are sorted by the calling thread.
+ */
+int TSODLULS_sort_segmented_parallel(
+  t_TSODLULS_sort_element* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments,
+  size_t i_number_of_threads
+){
+  int i_result = 0;
+  size_t i_number_of_tasks = 0;
+  size_t i_first_segment = 0;
+  size_t i_last_segment = 0;
+  size_t i_number_of_elements = 0;
+  size_t i_number_of_elements_per_task = 0;
+  t_TSODLULS_segmented_sort_task* arr_tasks = NULL;
+  pthread_t* arr_threads = NULL;
+  unsigned int* arr_b_started = NULL;
+
+  if(i_number_of_segments == 0){
+    return 0;
+  }
+  for(size_t i = 0; i < i_number_of_segments; ++i){
+    if(arr_segment_offsets[i + 1] < arr_segment_offsets[i]){
+      return I_ERROR__SEGMENT_OFFSETS_SHOULD_BE_NON_DECREASING;
+    }
+  }
+  if(i_number_of_threads > i_number_of_segments){
+    i_number_of_threads = i_number_of_segments;
+  }
+  if(i_number_of_threads <= 1){
+    return TSODLULS_sort_segmented(arr_elements, arr_segment_offsets, i_number_of_segments);
+  }
+
+  arr_tasks = calloc(i_number_of_threads, sizeof(t_TSODLULS_segmented_sort_task));
+  arr_threads = calloc(i_number_of_threads, sizeof(pthread_t));
+  arr_b_started = calloc(i_number_of_threads, sizeof(unsigned int));
+  if(arr_tasks == NULL || arr_threads == NULL || arr_b_started == NULL){
+    TSODLULS_free(arr_tasks);
+    TSODLULS_free(arr_threads);
+    TSODLULS_free(arr_b_started);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+
+  //each task gets consecutive segments with about the same number of elements
+  i_number_of_elements = arr_segment_offsets[i_number_of_segments] - arr_segment_offsets[0];
+  i_number_of_elements_per_task = i_number_of_elements / i_number_of_threads + 1;
+  while(i_first_segment < i_number_of_segments){
+    i_last_segment = i_first_segment + 1;
+    if(i_number_of_tasks == i_number_of_threads - 1){
+      i_last_segment = i_number_of_segments;
+    }
+    while(
+      i_last_segment < i_number_of_segments
+      && arr_segment_offsets[i_last_segment] - arr_segment_offsets[i_first_segment] < i_number_of_elements_per_task
+    ){
+      ++i_last_segment;
+    }
+    arr_tasks[i_number_of_tasks].arr_elements = arr_elements;
+    arr_tasks[i_number_of_tasks].arr_segment_offsets = &(arr_segment_offsets[i_first_segment]);
+    arr_tasks[i_number_of_tasks].i_number_of_segments = i_last_segment - i_first_segment;
+    ++i_number_of_tasks;
+    i_first_segment = i_last_segment;
+  }
+
+  //the calling thread does the first task
+  for(size_t i = 1; i < i_number_of_tasks; ++i){
+    arr_b_started[i] = pthread_create(
+        &(arr_threads[i]),
+        NULL,
+        TSODLULS_sort_segmented_task,
+        &(arr_tasks[i])
+    ) == 0;
+  }
+  TSODLULS_sort_segmented_task(&(arr_tasks[0]));
+  for(size_t i = 1; i < i_number_of_tasks; ++i){
+    if(arr_b_started[i]){
+      pthread_join(arr_threads[i], NULL);
+    }
+    else{
+      TSODLULS_sort_segmented_task(&(arr_tasks[i]));
+    }
+  }
+  for(size_t i = 0; i < i_number_of_tasks; ++i){
+    if(arr_tasks[i].i_result != 0){
+      i_result = arr_tasks[i].i_result;
+      break;
+    }
+  }
+
+  TSODLULS_free(arr_tasks);
+  TSODLULS_free(arr_threads);
+  TSODLULS_free(arr_b_started);
+
+  return i_result;
+}//end function TSODLULS_sort_segmented_parallel()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * In-place super scalar samplesort (IPS4o of Axtmann, Witt, Ferizovic and Sanders):
+ * the cells are classified with a search tree of up to 127 splitters chosen in a random sample,
+ * compared with TSODLULS_compare_nextified_keys_in_cells(), and distributed in blocks of I_SAMPLESORT_BLOCK_SIZE cells.
+ * A splitter that is a frequent key gets its own equality bucket, that is not sorted again,
+ * hence skewed and low entropy keys are fast.
+ * The memory used does not depend on the number of elements (about 512 KiB of buffers, the keys are not moved).
+ * The buckets are sorted recursively and the partitions of at most I_SAMPLESORT_BASE_CASE_SIZE cells
+ * are sorted by TSODLULS_pdqsort().
+ * It is not stable.
+ */
+int TSODLULS_sort_samplesort(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+){
+  return TSODLULS_sort_samplesort_parallel(arr_elements, i_number_of_elements, 1);
+}//end function TSODLULS_sort_samplesort()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Same as TSODLULS_sort_samplesort() with i_number_of_threads threads (including the calling thread):
+ * the classification and the permutation of the blocks are done by all the threads,
+ * the buckets of more than 1/i_number_of_threads of the cells are sorted with all the threads,
+ * and the other buckets are shared by the threads, each one sorting the next bucket with its own buffers.
+ * If a thread cannot be created, its work is done by the calling thread.
+ */
+int TSODLULS_sort_samplesort_parallel(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_threads
+){
+  int i_result = 0;
+  t_TSODLULS_samplesort samplesort;
+  size_t i_bucket_size = 0;
+
+  if(i_number_of_elements <= I_SAMPLESORT_BASE_CASE_SIZE){
+    return TSODLULS_pdqsort(arr_elements, i_number_of_elements);
+  }
+  //each thread gets at least a base case
+  if(i_number_of_threads > i_number_of_elements / I_SAMPLESORT_BASE_CASE_SIZE){
+    i_number_of_threads = i_number_of_elements / I_SAMPLESORT_BASE_CASE_SIZE;
+  }
+  if(i_number_of_threads == 0){
+    i_number_of_threads = 1;
+  }
+
+  i_result = TSODLULS_samplesort_init(&samplesort, i_number_of_threads);
+  if(i_result != 0){
+    return i_result;
+  }
+  if(i_number_of_threads == 1){
+    i_result = TSODLULS_samplesort_sequential(&samplesort, arr_elements, i_number_of_elements, 0);
+    TSODLULS_samplesort_free(&samplesort);
+    return i_result;
+  }
+
+  TSODLULS_samplesort_partition(&samplesort, arr_elements, i_number_of_elements);
+
+  //the big buckets are sorted one after the other with all the threads, the odd buckets contain equal keys
+  for(size_t b = 0; b < samplesort.i_number_of_buckets && i_result == 0; b += 2){
+    i_bucket_size = samplesort.arr_bucket_starts[b + 1] - samplesort.arr_bucket_starts[b];
+    if(i_bucket_size > i_number_of_elements / i_number_of_threads && i_bucket_size < i_number_of_elements){
+      i_result = TSODLULS_sort_samplesort_parallel(
+          &(arr_elements[samplesort.arr_bucket_starts[b]]),
+          i_bucket_size,
+          i_number_of_threads
+      );
+    }
+  }
+
+  //the other buckets are shared by the threads
+  if(i_result == 0){
+    samplesort.i_next_bucket = 0;
+    TSODLULS_samplesort_run_threads(&samplesort, TSODLULS_samplesort_buckets_task);
+    for(size_t t = 0; t < i_number_of_threads; ++t){
+      if(samplesort.arr_threads[t].i_result != 0){
+        i_result = samplesort.arr_threads[t].i_result;
+        break;
+      }
+    }
+  }
+
+  TSODLULS_samplesort_free(&samplesort);
+
+  return i_result;
+}//end function TSODLULS_sort_samplesort_parallel()
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A parallel sort for NUMA machines with i_number_of_threads threads, the calling thread only waits:
+ * the threads are spread round-robin on the NUMA nodes and pinned to the CPUs of their node,
+ * the cells are distributed by the first 2 bytes of their keys in contiguous ranges of buckets,
+ * one per thread, in buffers allocated and first touched by the thread on its node
+ * (and bound to the node with mbind() when the machine has several nodes, or interleaved on all the nodes
+ * when the thread could not be pinned),
+ * then each thread sorts its partition with TSODLULS_sort_radix8_count_insertion() in node-local buffers
+ * and copies it in arr_elements.
+ * The topology is read in /sys/devices/system/node, a machine without it is a single node,
+ * and the threads that cannot be pinned or created still work (the latter by the calling thread).
+ * If p_numa_stats is not NULL, it is filled with the nodes used and the traffic between nodes
+ * (the writes of the threads that could not be pinned are counted as remote).
+ * The partitions are balanced only when the first 2 bytes of the keys are spread.
+ * It is not stable.
+ */
+int TSODLULS_sort_parallel_numa(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_threads,
+  t_TSODLULS_numa_stats* p_numa_stats
+){
+  int i_result = 0;
+  t_TSODLULS_numa_sort* p_numa_sort = NULL;
+  t_TSODLULS_numa_sort_thread* arr_threads = NULL;
+  size_t i_stripe_size = 0;
+  size_t i_bucket_start = 0;
+  size_t i_bucket_size = 0;
+  size_t i_owner = 0;
+  size_t i_count = 0;
+
+  //the topology is in a heap structure, it has arrays indexed by the nodes and the CPUs
+  p_numa_sort = calloc(1, sizeof(t_TSODLULS_numa_sort));
+  if(p_numa_sort == NULL){
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  TSODLULS_numa_read_topology(p_numa_sort);
+  if(p_numa_stats != NULL){
+    memset(p_numa_stats, 0, sizeof(t_TSODLULS_numa_stats));
+    p_numa_stats->i_number_of_nodes = p_numa_sort->i_number_of_nodes;
+    p_numa_stats->i_number_of_threads = 1;
+  }
+
+  //each thread gets at least a base case
+  if(i_number_of_threads > i_number_of_elements / I_SAMPLESORT_BASE_CASE_SIZE){
+    i_number_of_threads = i_number_of_elements / I_SAMPLESORT_BASE_CASE_SIZE;
+  }
+  if(i_number_of_threads <= 1){
+    TSODLULS_free(p_numa_sort);
+    return TSODLULS_sort_radix8_count_insertion(arr_elements, i_number_of_elements);
+  }
+
+  p_numa_sort->arr_elements = arr_elements;
+  p_numa_sort->i_number_of_elements = i_number_of_elements;
+  p_numa_sort->i_number_of_threads = i_number_of_threads;
+  p_numa_sort->arr_bucket_owners = calloc(I_NUMA_NUMBER_OF_BUCKETS, sizeof(size_t));
+  p_numa_sort->arr_threads = calloc(i_number_of_threads, sizeof(t_TSODLULS_numa_sort_thread));
+  arr_threads = p_numa_sort->arr_threads;
+  if(p_numa_sort->arr_bucket_owners == NULL || arr_threads == NULL){
+    i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  i_stripe_size = i_number_of_elements / i_number_of_threads;
+  for(size_t t = 0; t < i_number_of_threads && i_result == 0; ++t){
+    arr_threads[t].p_numa_sort = p_numa_sort;
+    arr_threads[t].i_thread = t;
+    arr_threads[t].i_node = t % p_numa_sort->i_number_of_nodes;
+    arr_threads[t].i_stripe_first = t * i_stripe_size;
+    arr_threads[t].i_stripe_end = (t == i_number_of_threads - 1) ? i_number_of_elements : (t + 1) * i_stripe_size;
+    arr_threads[t].arr_bucket_offsets = calloc(I_NUMA_NUMBER_OF_BUCKETS, sizeof(size_t));
+    if(arr_threads[t].arr_bucket_offsets == NULL){
+      i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    if(p_numa_stats != NULL){
+      arr_threads[t].arr_bytes_to_threads = calloc(i_number_of_threads, sizeof(size_t));
+      if(arr_threads[t].arr_bytes_to_threads == NULL){
+        i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      }
+    }
+  }
+
+  if(i_result == 0){
+    TSODLULS_numa_sort_run_threads(p_numa_sort, TSODLULS_numa_sort_count_task);
+
+    //the buckets go to the threads in contiguous ranges of about the same number of cells,
+    //and the cells of a bucket are written in the partition of its thread in the order of the stripes
+    for(size_t b = 0; b < I_NUMA_NUMBER_OF_BUCKETS; ++b){
+      i_bucket_size = 0;
+      for(size_t t = 0; t < i_number_of_threads; ++t){
+        i_bucket_size += arr_threads[t].arr_bucket_offsets[b];
+      }
+      i_owner = (i_bucket_start + i_bucket_size / 2) / (i_number_of_elements / i_number_of_threads + 1);
+      if(i_owner < p_numa_sort->arr_bucket_owners[b > 0 ? b - 1 : 0]){
+        i_owner = p_numa_sort->arr_bucket_owners[b - 1];
+      }
+      p_numa_sort->arr_bucket_owners[b] = i_owner;
+      if(arr_threads[i_owner].i_partition_size == 0){
+        arr_threads[i_owner].i_partition_first = i_bucket_start;
+      }
+      for(size_t t = 0; t < i_number_of_threads; ++t){
+        i_count = arr_threads[t].arr_bucket_offsets[b];
+        arr_threads[t].arr_bucket_offsets[b] = arr_threads[i_owner].i_partition_size;
+        arr_threads[i_owner].i_partition_size += i_count;
+        if(p_numa_stats != NULL){
+          arr_threads[t].arr_bytes_to_threads[i_owner] += i_count * sizeof(t_TSODLULS_sort_element);
+        }
+      }
+      i_bucket_start += i_bucket_size;
+    }
+
+    TSODLULS_numa_sort_run_threads(p_numa_sort, TSODLULS_numa_sort_alloc_task);
+    for(size_t t = 0; t < i_number_of_threads; ++t){
+      if(arr_threads[t].i_result != 0){
+        i_result = arr_threads[t].i_result;
+        break;
+      }
+    }
+  }
+
+  if(i_result == 0){
+    TSODLULS_numa_sort_run_threads(p_numa_sort, TSODLULS_numa_sort_distribute_task);
+    TSODLULS_numa_sort_run_threads(p_numa_sort, TSODLULS_numa_sort_sort_task);
+    for(size_t t = 0; t < i_number_of_threads; ++t){
+      if(arr_threads[t].i_result != 0){
+        i_result = arr_threads[t].i_result;
+        break;
+      }
+    }
+  }
+
+  if(p_numa_stats != NULL){
+    p_numa_stats->i_number_of_threads = i_number_of_threads;
+  }
+  for(size_t t = 0; arr_threads != NULL && t < i_number_of_threads; ++t){
+    if(p_numa_stats != NULL){
+      p_numa_stats->i_number_of_pinned_threads += arr_threads[t].b_pinned;
+      if(arr_threads[t].arr_partition_copy != NULL){
+        p_numa_stats->i_number_of_bound_buffers += 2 * arr_threads[t].b_bound;
+        p_numa_stats->i_number_of_interleaved_buffers += 2 * arr_threads[t].b_interleaved;
+      }
+      p_numa_stats->i_bytes_to_local_node += arr_threads[t].i_bytes_to_local_node;
+      p_numa_stats->i_bytes_to_remote_node += arr_threads[t].i_bytes_to_remote_node;
+    }
+    TSODLULS_free(arr_threads[t].arr_bucket_offsets);
+    TSODLULS_free(arr_threads[t].arr_bytes_to_threads);
+    TSODLULS_numa_free_local(&(arr_threads[t]), arr_threads[t].arr_partition);
+    TSODLULS_numa_free_local(&(arr_threads[t]), arr_threads[t].arr_partition_copy);
+  }
+  TSODLULS_free(arr_threads);
+  TSODLULS_free(p_numa_sort->arr_bucket_owners);
+  TSODLULS_free(p_numa_sort);
+
+  return i_result;
+}//end function TSODLULS_sort_parallel_numa()
+
+
+
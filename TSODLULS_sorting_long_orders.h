@@ -38,6 +38,173 @@ int TSODLULS_sort_stable(t_TSODLULS_sort_element* arr_elements, size_t i_number_
 
 
 
+/**
+ * Sorting functions for long nextified strings
+ * Choose the algorithm with the lowest cost for these elements according to the cost model
+ * (see t_TSODLULS_sort_model).
+ * Returns I_SORT_ALGORITHM__INSERTION, I_SORT_ALGORITHM__COMPARISON or I_SORT_ALGORITHM__RADIX.
+ */
+int TSODLULS_choose_sort_algorithm(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Sort with the algorithm chosen by TSODLULS_choose_sort_algorithm().
+ * It is not stable since the comparison model uses quicksort.
+ */
+int TSODLULS_sort_with_model(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A stable insertion sort for a small number of elements
+ */
+int TSODLULS_sort_insertion(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Pattern-defeating quicksort (pdqsort of Orson Peters) inlined with long cells:
+ * the keys are compared with memcmp() and then their lengths, without function pointer.
+ * Sorted, reverse sorted and almost sorted cells are sorted in linear time,
+ * and the cells equal to a previous pivot are not partitioned again, hence few distinct keys are fast.
+ * Heapsort is used after too many bad partitions, hence O(n log n) in the worst case.
+ * It is not stable.
+ */
+int TSODLULS_pdqsort(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A radix sort with 64 bits digits: the next 8 bytes of the keys are loaded as big-endian uint64
+ * in a view of short cells (the bytes after the end of a key are 0), the view is sorted
+ * by TSODLULS_sort__short() and the cells are permuted accordingly.
+ * In a group of equal words, the keys ending in the word come first by increasing length
+ * (they are prefixes of the longer keys), and only the keys continuing after the word are sorted again.
+ * Hence long keys with long common prefixes use 8 times less rounds than with octets digits.
+ * The groups of at most I_SORT_MODEL__INSERTION_THRESHOLD cells are sorted by insertion sort.
+ * It is not stable.
+ */
+int TSODLULS_sort_radix64_short_view(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A hybrid sort: the first 8 bytes of the keys are packed in short cells pointing to the long cells
+ * (see TSODLULS_sort_radix64_short_view()), that are sorted by TSODLULS_sort_radix8_count_insertion__short()
+ * and moved 16 bytes at a time instead of 32, then the long cells are permuted once,
+ * and only the runs of equal prefixes are sorted by TSODLULS_sort_radix8_count_insertion() from the byte 8.
+ * It is fast when most keys differ within their first 8 bytes.
+ * It is not stable.
+ */
+int TSODLULS_sort_prefix8_hybrid(t_TSODLULS_sort_element* arr_elements, size_t i_number_of_elements);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A sort where the keys are built lazily: the keys contain the TSO-encoding of the first
+ * i_number_of_fields_in_keys fields of the objects, and after a sort, the cells with equal keys
+ * get the next field with p_key_extender->f_add_field() and are sorted again by this field,
+ * until their keys differ or all the fields are in their keys.
+ * With i_number_of_fields_in_keys == 0, the keys are empty (s_key may be NULL) and all the cells get the first field.
+ * Hence the encoding time is only spent on ties, when the first fields almost always decide the order.
+ * The encoding of each field must not be a prefix of another encoding of this field,
+ * like the encodings of TSODLULS_finite_orders.c, so that the order is the order of the full keys.
+ * The errors of TSODLULS_sort() and of f_add_field() are returned.
+ * It is not stable.
+ */
+int TSODLULS_sort_with_lazy_keys(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_fields_in_keys,
+  const t_TSODLULS_key_extender* p_key_extender
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Initialize an order-preserving dictionary with the distinct keys of the cells:
+ * the keys are sorted once and each distinct key gets its rank as an uint64.
+ * The keys are copied in the dictionary, hence the cells can be freed or reused afterwards,
+ * and the dictionary can be used for all the sorts of cells whose keys are in it
+ * (see TSODLULS_sort_with_key_dictionary()). Free it with TSODLULS_key_dictionary_free().
+ */
+int TSODLULS_key_dictionary_init(
+  t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Free the keys and the hash table of a dictionary of keys
+ */
+void TSODLULS_key_dictionary_free(t_TSODLULS_key_dictionary* p_dictionary);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Find the rank of the key of a cell in a dictionary of keys
+ * Returns I_ERROR__KEY_NOT_IN_DICTIONARY if the key was not in the cells of TSODLULS_key_dictionary_init().
+ */
+int TSODLULS_key_dictionary_get_rank(
+  const t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* p_sort_element,
+  uint64_t* p_i_rank
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Rewrite long cells as short cells whose keys are the ranks of the long keys in a dictionary of keys:
+ * arr_elements__short[i] has the object of arr_elements[i] and the short key of its key,
+ * so that the short cells are in the same order as the long cells.
+ * Returns I_ERROR__KEY_NOT_IN_DICTIONARY if a key is not in the dictionary.
+ */
+int TSODLULS_key_dictionary_fill_short_cells(
+  const t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  t_TSODLULS_sort_element__short* arr_elements__short
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Sort long cells with few distinct keys as short cells: the cells are rewritten in arr_elements__short
+ * with the ranks of their keys in the dictionary (see TSODLULS_key_dictionary_fill_short_cells()),
+ * and sorted with TSODLULS_sort__short() on the i_max_length bytes of the ranks.
+ * The objects are sorted in arr_elements__short, arr_elements is not modified.
+ * It is not stable.
+ */
+int TSODLULS_sort_with_key_dictionary(
+  const t_TSODLULS_key_dictionary* p_dictionary,
+  const t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  t_TSODLULS_sort_element__short* arr_elements__short
+);
+
+
+
 /**
  * Sorting functions for long nextified strings
  * A stable sorting algorithm for nextified strings based on radix sort with octets digits
@@ -60,3 +227,96 @@ int TSODLULS_sort_radix8_count_insertion(
 
 
 
+/**
+ * Sorting functions for long nextified strings
+ * Sort independently the segments of the array: the segment i is made of the cells from
+ * arr_segment_offsets[i] included to arr_segment_offsets[i + 1] excluded,
+ * arr_segment_offsets has i_number_of_segments + 1 non-decreasing offsets.
+ * The buffers of the radix sort are allocated once for all the segments,
+ * and small segments are sorted by insertion sort.
+ * It is not stable.
+ */
+int TSODLULS_sort_segmented(
+  t_TSODLULS_sort_element* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Same as TSODLULS_sort_segmented() with the segments spread across i_number_of_threads threads
+ * (including the calling thread), each thread sorting consecutive segments with its own buffers.
+ * If a thread cannot be created, its segments are sorted by the calling thread.
+ */
+int TSODLULS_sort_segmented_parallel(
+  t_TSODLULS_sort_element* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments,
+  size_t i_number_of_threads
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * In-place super scalar samplesort (IPS4o of Axtmann, Witt, Ferizovic and Sanders):
+ * the cells are classified with a search tree of up to 127 splitters chosen in a random sample,
+ * compared with TSODLULS_compare_nextified_keys_in_cells(), and distributed in blocks of I_SAMPLESORT_BLOCK_SIZE cells.
+ * A splitter that is a frequent key gets its own equality bucket, that is not sorted again,
+ * hence skewed and low entropy keys are fast.
+ * The memory used does not depend on the number of elements (about 512 KiB of buffers, the keys are not moved).
+ * The buckets are sorted recursively and the partitions of at most I_SAMPLESORT_BASE_CASE_SIZE cells
+ * are sorted by TSODLULS_pdqsort().
+ * It is not stable.
+ */
+int TSODLULS_sort_samplesort(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * Same as TSODLULS_sort_samplesort() with i_number_of_threads threads (including the calling thread):
+ * the classification and the permutation of the blocks are done by all the threads,
+ * the buckets of more than 1/i_number_of_threads of the cells are sorted with all the threads,
+ * and the other buckets are shared by the threads, each one sorting the next bucket with its own buffers.
+ * If a thread cannot be created, its work is done by the calling thread.
+ */
+int TSODLULS_sort_samplesort_parallel(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_threads
+);
+
+
+
+/**
+ * Sorting functions for long nextified strings
+ * A parallel sort for NUMA machines with i_number_of_threads threads, the calling thread only waits:
+ * the threads are spread round-robin on the NUMA nodes and pinned to the CPUs of their node,
+ * the cells are distributed by the first 2 bytes of their keys in contiguous ranges of buckets,
+ * one per thread, in buffers allocated and first touched by the thread on its node
+ * (and bound to the node with mbind() when the machine has several nodes, or interleaved on all the nodes
+ * when the thread could not be pinned),
+ * then each thread sorts its partition with TSODLULS_sort_radix8_count_insertion() in node-local buffers
+ * and copies it in arr_elements.
+ * The topology is read in /sys/devices/system/node, a machine without it is a single node,
+ * and the threads that cannot be pinned or created still work (the latter by the calling thread).
+ * If p_numa_stats is not NULL, it is filled with the nodes used and the traffic between nodes
+ * (the writes of the threads that could not be pinned are counted as remote).
+ * The partitions are balanced only when the first 2 bytes of the keys are spread.
+ * It is not stable.
+ */
+int TSODLULS_sort_parallel_numa(
+  t_TSODLULS_sort_element* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_threads,
+  t_TSODLULS_numa_stats* p_numa_stats
+);
+
+
+
@@ -18,6 +18,1347 @@ along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "TSODLULS.h"
+#include <time.h>
+#ifdef TSODLULS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+
+
+//------------------------------------------------------------------------------------
+//Internal functions
+//------------------------------------------------------------------------------------
+/**
+ * Sorting functions for short nextified strings
+ * The size of the stack of instances of TSODLULS_sort_radix8_count_insertion__short_with_threshold().
+ * This is depth first in a tree of degree 256 and depth at most i_max_length - 1,
+ * so we will not need more that (i_max_length - 1) * 256.
+ * We also don't need more than i_number_of_elements / (i_threshold + 1) because of the use of insertion sort.
+ */
+static size_t TSODLULS_get_number_of_radix_instances__short(
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  size_t i_threshold
+){
+  size_t i_number_of_instances = ((size_t)(i_max_length - 1)) * 256;
+  if(i_number_of_instances > i_number_of_elements / (i_threshold + 1)){
+    i_number_of_instances = i_number_of_elements / (i_threshold + 1);
+  }
+  return i_number_of_instances;
+}//end function TSODLULS_get_number_of_radix_instances__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Compare-exchange of two short cells without branches (cmov): the smallest key goes in the first cell.
+ */
+static inline void TSODLULS_compare_exchange__short(
+  t_TSODLULS_sort_element__short* p_cell1,
+  t_TSODLULS_sort_element__short* p_cell2
+){
+  uint64_t i_key1 = p_cell1->i_key;
+  uint64_t i_key2 = p_cell2->i_key;
+  void* p_object1 = p_cell1->p_object;
+  void* p_object2 = p_cell2->p_object;
+  int b_swap = i_key2 < i_key1;
+  p_cell1->i_key = b_swap ? i_key2 : i_key1;
+  p_cell1->p_object = b_swap ? p_object2 : p_object1;
+  p_cell2->i_key = b_swap ? i_key1 : i_key2;
+  p_cell2->p_object = b_swap ? p_object1 : p_object2;
+}//end function TSODLULS_compare_exchange__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Sorting networks for 2 to I_SORT_NETWORK_MAX_SIZE__SHORT elements.
+ * The networks for at most 8 elements are the smallest known ones,
+ * the bigger networks are Batcher's odd-even merge sort restricted to the first wires
+ * (after the network for 8 elements on the first 8 wires when it is smaller).
+ * Nothing is done for other numbers of elements.
+ */
+static void TSODLULS_sort_network_in_place__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+){
+#define TSODLULS_compare_exchange_cells__short(i, j) \
+  TSODLULS_compare_exchange__short(&(arr_elements[i]), &(arr_elements[j]))
+
+  switch(i_number_of_elements){
+    case 16:
+      TSODLULS_compare_exchange_cells__short(0, 1); TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(0, 2);
+      TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(4, 5);
+      TSODLULS_compare_exchange_cells__short(6, 7); TSODLULS_compare_exchange_cells__short(4, 6); TSODLULS_compare_exchange_cells__short(5, 7);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(0, 4); TSODLULS_compare_exchange_cells__short(2, 6);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(1, 5); TSODLULS_compare_exchange_cells__short(3, 7);
+      TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(8, 9); TSODLULS_compare_exchange_cells__short(10, 11);
+      TSODLULS_compare_exchange_cells__short(8, 10); TSODLULS_compare_exchange_cells__short(9, 11); TSODLULS_compare_exchange_cells__short(9, 10);
+      TSODLULS_compare_exchange_cells__short(12, 13); TSODLULS_compare_exchange_cells__short(14, 15); TSODLULS_compare_exchange_cells__short(12, 14);
+      TSODLULS_compare_exchange_cells__short(13, 15); TSODLULS_compare_exchange_cells__short(13, 14); TSODLULS_compare_exchange_cells__short(8, 12);
+      TSODLULS_compare_exchange_cells__short(10, 14); TSODLULS_compare_exchange_cells__short(10, 12); TSODLULS_compare_exchange_cells__short(9, 13);
+      TSODLULS_compare_exchange_cells__short(11, 15); TSODLULS_compare_exchange_cells__short(11, 13); TSODLULS_compare_exchange_cells__short(9, 10);
+      TSODLULS_compare_exchange_cells__short(11, 12); TSODLULS_compare_exchange_cells__short(13, 14); TSODLULS_compare_exchange_cells__short(0, 8);
+      TSODLULS_compare_exchange_cells__short(4, 12); TSODLULS_compare_exchange_cells__short(4, 8); TSODLULS_compare_exchange_cells__short(2, 10);
+      TSODLULS_compare_exchange_cells__short(6, 14); TSODLULS_compare_exchange_cells__short(6, 10); TSODLULS_compare_exchange_cells__short(2, 4);
+      TSODLULS_compare_exchange_cells__short(6, 8); TSODLULS_compare_exchange_cells__short(10, 12); TSODLULS_compare_exchange_cells__short(1, 9);
+      TSODLULS_compare_exchange_cells__short(5, 13); TSODLULS_compare_exchange_cells__short(5, 9); TSODLULS_compare_exchange_cells__short(3, 11);
+      TSODLULS_compare_exchange_cells__short(7, 15); TSODLULS_compare_exchange_cells__short(7, 11); TSODLULS_compare_exchange_cells__short(3, 5);
+      TSODLULS_compare_exchange_cells__short(7, 9); TSODLULS_compare_exchange_cells__short(11, 13); TSODLULS_compare_exchange_cells__short(1, 2);
+      TSODLULS_compare_exchange_cells__short(3, 4); TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(7, 8);
+      TSODLULS_compare_exchange_cells__short(9, 10); TSODLULS_compare_exchange_cells__short(11, 12); TSODLULS_compare_exchange_cells__short(13, 14);
+    break;
+    case 15:
+      TSODLULS_compare_exchange_cells__short(0, 1); TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(0, 2);
+      TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(4, 5);
+      TSODLULS_compare_exchange_cells__short(6, 7); TSODLULS_compare_exchange_cells__short(4, 6); TSODLULS_compare_exchange_cells__short(5, 7);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(0, 4); TSODLULS_compare_exchange_cells__short(2, 6);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(1, 5); TSODLULS_compare_exchange_cells__short(3, 7);
+      TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(8, 9); TSODLULS_compare_exchange_cells__short(10, 11);
+      TSODLULS_compare_exchange_cells__short(8, 10); TSODLULS_compare_exchange_cells__short(9, 11); TSODLULS_compare_exchange_cells__short(9, 10);
+      TSODLULS_compare_exchange_cells__short(12, 13); TSODLULS_compare_exchange_cells__short(12, 14); TSODLULS_compare_exchange_cells__short(13, 14);
+      TSODLULS_compare_exchange_cells__short(8, 12); TSODLULS_compare_exchange_cells__short(10, 14); TSODLULS_compare_exchange_cells__short(10, 12);
+      TSODLULS_compare_exchange_cells__short(9, 13); TSODLULS_compare_exchange_cells__short(11, 13); TSODLULS_compare_exchange_cells__short(9, 10);
+      TSODLULS_compare_exchange_cells__short(11, 12); TSODLULS_compare_exchange_cells__short(13, 14); TSODLULS_compare_exchange_cells__short(0, 8);
+      TSODLULS_compare_exchange_cells__short(4, 12); TSODLULS_compare_exchange_cells__short(4, 8); TSODLULS_compare_exchange_cells__short(2, 10);
+      TSODLULS_compare_exchange_cells__short(6, 14); TSODLULS_compare_exchange_cells__short(6, 10); TSODLULS_compare_exchange_cells__short(2, 4);
+      TSODLULS_compare_exchange_cells__short(6, 8); TSODLULS_compare_exchange_cells__short(10, 12); TSODLULS_compare_exchange_cells__short(1, 9);
+      TSODLULS_compare_exchange_cells__short(5, 13); TSODLULS_compare_exchange_cells__short(5, 9); TSODLULS_compare_exchange_cells__short(3, 11);
+      TSODLULS_compare_exchange_cells__short(7, 11); TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(7, 9);
+      TSODLULS_compare_exchange_cells__short(11, 13); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(7, 8); TSODLULS_compare_exchange_cells__short(9, 10);
+      TSODLULS_compare_exchange_cells__short(11, 12); TSODLULS_compare_exchange_cells__short(13, 14);
+    break;
+    case 14:
+      TSODLULS_compare_exchange_cells__short(0, 1); TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(0, 2);
+      TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(4, 5);
+      TSODLULS_compare_exchange_cells__short(6, 7); TSODLULS_compare_exchange_cells__short(4, 6); TSODLULS_compare_exchange_cells__short(5, 7);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(0, 4); TSODLULS_compare_exchange_cells__short(2, 6);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(1, 5); TSODLULS_compare_exchange_cells__short(3, 7);
+      TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(8, 9); TSODLULS_compare_exchange_cells__short(10, 11);
+      TSODLULS_compare_exchange_cells__short(8, 10); TSODLULS_compare_exchange_cells__short(9, 11); TSODLULS_compare_exchange_cells__short(9, 10);
+      TSODLULS_compare_exchange_cells__short(12, 13); TSODLULS_compare_exchange_cells__short(8, 12); TSODLULS_compare_exchange_cells__short(10, 12);
+      TSODLULS_compare_exchange_cells__short(9, 13); TSODLULS_compare_exchange_cells__short(11, 13); TSODLULS_compare_exchange_cells__short(9, 10);
+      TSODLULS_compare_exchange_cells__short(11, 12); TSODLULS_compare_exchange_cells__short(0, 8); TSODLULS_compare_exchange_cells__short(4, 12);
+      TSODLULS_compare_exchange_cells__short(4, 8); TSODLULS_compare_exchange_cells__short(2, 10); TSODLULS_compare_exchange_cells__short(6, 10);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(6, 8); TSODLULS_compare_exchange_cells__short(10, 12);
+      TSODLULS_compare_exchange_cells__short(1, 9); TSODLULS_compare_exchange_cells__short(5, 13); TSODLULS_compare_exchange_cells__short(5, 9);
+      TSODLULS_compare_exchange_cells__short(3, 11); TSODLULS_compare_exchange_cells__short(7, 11); TSODLULS_compare_exchange_cells__short(3, 5);
+      TSODLULS_compare_exchange_cells__short(7, 9); TSODLULS_compare_exchange_cells__short(11, 13); TSODLULS_compare_exchange_cells__short(1, 2);
+      TSODLULS_compare_exchange_cells__short(3, 4); TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(7, 8);
+      TSODLULS_compare_exchange_cells__short(9, 10); TSODLULS_compare_exchange_cells__short(11, 12);
+    break;
+    case 13:
+      TSODLULS_compare_exchange_cells__short(0, 1); TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(0, 2);
+      TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(4, 5);
+      TSODLULS_compare_exchange_cells__short(6, 7); TSODLULS_compare_exchange_cells__short(4, 6); TSODLULS_compare_exchange_cells__short(5, 7);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(0, 4); TSODLULS_compare_exchange_cells__short(2, 6);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(1, 5); TSODLULS_compare_exchange_cells__short(3, 7);
+      TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(8, 9); TSODLULS_compare_exchange_cells__short(10, 11);
+      TSODLULS_compare_exchange_cells__short(8, 10); TSODLULS_compare_exchange_cells__short(9, 11); TSODLULS_compare_exchange_cells__short(9, 10);
+      TSODLULS_compare_exchange_cells__short(8, 12); TSODLULS_compare_exchange_cells__short(10, 12); TSODLULS_compare_exchange_cells__short(9, 10);
+      TSODLULS_compare_exchange_cells__short(11, 12); TSODLULS_compare_exchange_cells__short(0, 8); TSODLULS_compare_exchange_cells__short(4, 12);
+      TSODLULS_compare_exchange_cells__short(4, 8); TSODLULS_compare_exchange_cells__short(2, 10); TSODLULS_compare_exchange_cells__short(6, 10);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(6, 8); TSODLULS_compare_exchange_cells__short(10, 12);
+      TSODLULS_compare_exchange_cells__short(1, 9); TSODLULS_compare_exchange_cells__short(5, 9); TSODLULS_compare_exchange_cells__short(3, 11);
+      TSODLULS_compare_exchange_cells__short(7, 11); TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(7, 9);
+      TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4); TSODLULS_compare_exchange_cells__short(5, 6);
+      TSODLULS_compare_exchange_cells__short(7, 8); TSODLULS_compare_exchange_cells__short(9, 10); TSODLULS_compare_exchange_cells__short(11, 12);
+    break;
+    case 12:
+      TSODLULS_compare_exchange_cells__short(0, 2); TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(4, 6);
+      TSODLULS_compare_exchange_cells__short(5, 7); TSODLULS_compare_exchange_cells__short(0, 4); TSODLULS_compare_exchange_cells__short(1, 5);
+      TSODLULS_compare_exchange_cells__short(2, 6); TSODLULS_compare_exchange_cells__short(3, 7); TSODLULS_compare_exchange_cells__short(0, 1);
+      TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(4, 5); TSODLULS_compare_exchange_cells__short(6, 7);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(1, 4);
+      TSODLULS_compare_exchange_cells__short(3, 6); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(8, 10); TSODLULS_compare_exchange_cells__short(9, 11);
+      TSODLULS_compare_exchange_cells__short(8, 9); TSODLULS_compare_exchange_cells__short(10, 11); TSODLULS_compare_exchange_cells__short(9, 10);
+      TSODLULS_compare_exchange_cells__short(0, 8); TSODLULS_compare_exchange_cells__short(4, 8); TSODLULS_compare_exchange_cells__short(2, 10);
+      TSODLULS_compare_exchange_cells__short(6, 10); TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(6, 8);
+      TSODLULS_compare_exchange_cells__short(1, 9); TSODLULS_compare_exchange_cells__short(5, 9); TSODLULS_compare_exchange_cells__short(3, 11);
+      TSODLULS_compare_exchange_cells__short(7, 11); TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(7, 9);
+      TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4); TSODLULS_compare_exchange_cells__short(5, 6);
+      TSODLULS_compare_exchange_cells__short(7, 8); TSODLULS_compare_exchange_cells__short(9, 10);
+    break;
+    case 11:
+      TSODLULS_compare_exchange_cells__short(0, 2); TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(4, 6);
+      TSODLULS_compare_exchange_cells__short(5, 7); TSODLULS_compare_exchange_cells__short(0, 4); TSODLULS_compare_exchange_cells__short(1, 5);
+      TSODLULS_compare_exchange_cells__short(2, 6); TSODLULS_compare_exchange_cells__short(3, 7); TSODLULS_compare_exchange_cells__short(0, 1);
+      TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(4, 5); TSODLULS_compare_exchange_cells__short(6, 7);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(1, 4);
+      TSODLULS_compare_exchange_cells__short(3, 6); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(8, 10); TSODLULS_compare_exchange_cells__short(8, 9);
+      TSODLULS_compare_exchange_cells__short(9, 10); TSODLULS_compare_exchange_cells__short(0, 8); TSODLULS_compare_exchange_cells__short(4, 8);
+      TSODLULS_compare_exchange_cells__short(2, 10); TSODLULS_compare_exchange_cells__short(6, 10); TSODLULS_compare_exchange_cells__short(2, 4);
+      TSODLULS_compare_exchange_cells__short(6, 8); TSODLULS_compare_exchange_cells__short(1, 9); TSODLULS_compare_exchange_cells__short(5, 9);
+      TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(7, 9); TSODLULS_compare_exchange_cells__short(1, 2);
+      TSODLULS_compare_exchange_cells__short(3, 4); TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(7, 8);
+      TSODLULS_compare_exchange_cells__short(9, 10);
+    break;
+    case 10:
+      TSODLULS_compare_exchange_cells__short(0, 1); TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(0, 2);
+      TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(4, 5);
+      TSODLULS_compare_exchange_cells__short(6, 7); TSODLULS_compare_exchange_cells__short(4, 6); TSODLULS_compare_exchange_cells__short(5, 7);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(0, 4); TSODLULS_compare_exchange_cells__short(2, 6);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(1, 5); TSODLULS_compare_exchange_cells__short(3, 7);
+      TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(8, 9); TSODLULS_compare_exchange_cells__short(0, 8);
+      TSODLULS_compare_exchange_cells__short(4, 8); TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(6, 8);
+      TSODLULS_compare_exchange_cells__short(1, 9); TSODLULS_compare_exchange_cells__short(5, 9); TSODLULS_compare_exchange_cells__short(3, 5);
+      TSODLULS_compare_exchange_cells__short(7, 9); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(7, 8);
+    break;
+    case 9:
+      TSODLULS_compare_exchange_cells__short(0, 1); TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(0, 2);
+      TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(4, 5);
+      TSODLULS_compare_exchange_cells__short(6, 7); TSODLULS_compare_exchange_cells__short(4, 6); TSODLULS_compare_exchange_cells__short(5, 7);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(0, 4); TSODLULS_compare_exchange_cells__short(2, 6);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(1, 5); TSODLULS_compare_exchange_cells__short(3, 7);
+      TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6); TSODLULS_compare_exchange_cells__short(0, 8); TSODLULS_compare_exchange_cells__short(4, 8);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(6, 8); TSODLULS_compare_exchange_cells__short(3, 5);
+      TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4); TSODLULS_compare_exchange_cells__short(5, 6);
+      TSODLULS_compare_exchange_cells__short(7, 8);
+    break;
+    case 8:
+      TSODLULS_compare_exchange_cells__short(0, 2); TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(4, 6);
+      TSODLULS_compare_exchange_cells__short(5, 7); TSODLULS_compare_exchange_cells__short(0, 4); TSODLULS_compare_exchange_cells__short(1, 5);
+      TSODLULS_compare_exchange_cells__short(2, 6); TSODLULS_compare_exchange_cells__short(3, 7); TSODLULS_compare_exchange_cells__short(0, 1);
+      TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(4, 5); TSODLULS_compare_exchange_cells__short(6, 7);
+      TSODLULS_compare_exchange_cells__short(2, 4); TSODLULS_compare_exchange_cells__short(3, 5); TSODLULS_compare_exchange_cells__short(1, 4);
+      TSODLULS_compare_exchange_cells__short(3, 6); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6);
+    break;
+    case 7:
+      TSODLULS_compare_exchange_cells__short(0, 6); TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(4, 5);
+      TSODLULS_compare_exchange_cells__short(0, 2); TSODLULS_compare_exchange_cells__short(1, 4); TSODLULS_compare_exchange_cells__short(3, 6);
+      TSODLULS_compare_exchange_cells__short(0, 1); TSODLULS_compare_exchange_cells__short(2, 5); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(4, 6); TSODLULS_compare_exchange_cells__short(2, 3);
+      TSODLULS_compare_exchange_cells__short(4, 5); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+      TSODLULS_compare_exchange_cells__short(5, 6);
+    break;
+    case 6:
+      TSODLULS_compare_exchange_cells__short(0, 5); TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(2, 4);
+      TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4); TSODLULS_compare_exchange_cells__short(0, 3);
+      TSODLULS_compare_exchange_cells__short(2, 5); TSODLULS_compare_exchange_cells__short(0, 1); TSODLULS_compare_exchange_cells__short(2, 3);
+      TSODLULS_compare_exchange_cells__short(4, 5); TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4);
+    break;
+    case 5:
+      TSODLULS_compare_exchange_cells__short(0, 3); TSODLULS_compare_exchange_cells__short(1, 4); TSODLULS_compare_exchange_cells__short(0, 2);
+      TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(0, 1); TSODLULS_compare_exchange_cells__short(2, 4);
+      TSODLULS_compare_exchange_cells__short(1, 2); TSODLULS_compare_exchange_cells__short(3, 4); TSODLULS_compare_exchange_cells__short(2, 3);
+    break;
+    case 4:
+      TSODLULS_compare_exchange_cells__short(0, 2); TSODLULS_compare_exchange_cells__short(1, 3); TSODLULS_compare_exchange_cells__short(0, 1);
+      TSODLULS_compare_exchange_cells__short(2, 3); TSODLULS_compare_exchange_cells__short(1, 2);
+    break;
+    case 3:
+      TSODLULS_compare_exchange_cells__short(0, 2); TSODLULS_compare_exchange_cells__short(0, 1); TSODLULS_compare_exchange_cells__short(1, 2);
+    break;
+    case 2:
+      TSODLULS_compare_exchange_cells__short(0, 1);
+    break;
+  }
+
+#undef TSODLULS_compare_exchange_cells__short
+}//end function TSODLULS_sort_network_in_place__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * The median of 3 keys.
+ */
+static inline uint64_t TSODLULS_median_of_3__short(uint64_t i_key1, uint64_t i_key2, uint64_t i_key3){
+  uint64_t i_min = i_key1 < i_key2 ? i_key1 : i_key2;
+  uint64_t i_max = i_key1 < i_key2 ? i_key2 : i_key1;
+  i_max = i_max < i_key3 ? i_max : i_key3;
+  return i_min < i_max ? i_max : i_min;
+}//end function TSODLULS_median_of_3__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Offsets in a block of I_PARTITION_BLOCK_SIZE__SHORT cells of the cells that are on the wrong side of a partition:
+ * the cells with a key smaller than i_bound if b_greater is 0, the others if b_greater is 1.
+ * Branchless, one cell at a time. Returns the number of offsets.
+ */
+static size_t TSODLULS_get_partition_offsets__short(
+  const t_TSODLULS_sort_element__short* arr_block,
+  uint64_t i_bound,
+  size_t b_greater,
+  uint32_t* arr_offsets
+){
+  size_t i_number_of_offsets = 0;
+  for(uint32_t i = 0; i < I_PARTITION_BLOCK_SIZE__SHORT; ++i){
+    arr_offsets[i_number_of_offsets] = i;
+    i_number_of_offsets += (arr_block[i].i_key < i_bound) ^ b_greater;
+  }
+  return i_number_of_offsets;
+}//end function TSODLULS_get_partition_offsets__short()
+
+
+
+#ifdef TSODLULS_X86_SIMD
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_get_partition_offsets__short() with AVX2, 2 cells at a time.
+ * The keys are compared as signed integers after flipping their highest bit,
+ * the 2 offsets of the mask of the 2 cells are written at once with a table.
+ * arr_offsets needs room for 1 more offset.
+ */
+__attribute__((target("avx2")))
+static size_t TSODLULS_get_partition_offsets_avx2__short(
+  const t_TSODLULS_sort_element__short* arr_block,
+  uint64_t i_bound,
+  size_t b_greater,
+  uint32_t* arr_offsets
+){
+  static const uint64_t arr_offsets_of_masks[4] = {0, 0, 1, ((uint64_t)1) << 32};
+  const __m256i sign_bits = _mm256_set1_epi64x(INT64_MIN);
+  const __m256i bounds = _mm256_xor_si256(_mm256_set1_epi64x((int64_t)i_bound), sign_bits);
+  const int i_inversion = b_greater ? 3 : 0;
+  size_t i_number_of_offsets = 0;
+  uint64_t i_two_offsets = 0;
+  int i_mask = 0;
+  for(uint32_t i = 0; i < I_PARTITION_BLOCK_SIZE__SHORT; i += 2){
+    i_mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(
+      bounds,
+      _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(arr_block + i)), sign_bits)
+    )));
+    i_mask = (((i_mask >> 1) & 1) | ((i_mask >> 2) & 2)) ^ i_inversion;//the keys are in the lanes 1 and 3
+    i_two_offsets = arr_offsets_of_masks[i_mask] + i * UINT64_C(0x100000001);
+    memcpy(arr_offsets + i_number_of_offsets, &i_two_offsets, sizeof(uint64_t));
+    i_number_of_offsets += (i_mask & 1) + (i_mask >> 1);
+  }
+  return i_number_of_offsets;
+}//end function TSODLULS_get_partition_offsets_avx2__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_get_partition_offsets__short() with AVX-512F, 16 cells at a time.
+ * The keys of 8 cells are gathered in one vector to be compared,
+ * the offsets are compressed with the mask of the 16 cells.
+ * arr_offsets needs room for 15 more offsets.
+ */
+__attribute__((target("avx512f")))
+static size_t TSODLULS_get_partition_offsets_avx512__short(
+  const t_TSODLULS_sort_element__short* arr_block,
+  uint64_t i_bound,
+  size_t b_greater,
+  uint32_t* arr_offsets
+){
+  const __m512i bounds = _mm512_set1_epi64((int64_t)i_bound);
+  const __m512i keys_indexes = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);//the keys are in the odd lanes
+  const __m512i increments = _mm512_set1_epi32(16);
+  const __mmask16 i_inversion = b_greater ? 0xFFFF : 0;
+  __m512i offsets = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  size_t i_number_of_offsets = 0;
+  __mmask16 i_mask = 0;
+  for(uint32_t i = 0; i < I_PARTITION_BLOCK_SIZE__SHORT; i += 16){
+    __mmask8 i_mask_low = _mm512_cmplt_epu64_mask(
+      _mm512_permutex2var_epi64(
+        _mm512_loadu_si512((const void*)(arr_block + i)),
+        keys_indexes,
+        _mm512_loadu_si512((const void*)(arr_block + i + 4))
+      ),
+      bounds
+    );
+    __mmask8 i_mask_high = _mm512_cmplt_epu64_mask(
+      _mm512_permutex2var_epi64(
+        _mm512_loadu_si512((const void*)(arr_block + i + 8)),
+        keys_indexes,
+        _mm512_loadu_si512((const void*)(arr_block + i + 12))
+      ),
+      bounds
+    );
+    i_mask = (((__mmask16)i_mask_high << 8) | i_mask_low) ^ i_inversion;
+    _mm512_storeu_si512((void*)(arr_offsets + i_number_of_offsets), _mm512_maskz_compress_epi32(i_mask, offsets));
+    i_number_of_offsets += __builtin_popcount(i_mask);
+    offsets = _mm512_add_epi32(offsets, increments);
+  }
+  return i_number_of_offsets;
+}//end function TSODLULS_get_partition_offsets_avx512__short()
+#endif
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Branchless partition of the cells: the cells with a key smaller than i_bound are moved at the beginning,
+ * the others at the end, and their number is returned.
+ * This is the block partition of BlockQuicksort (Edelkamp and Weiss):
+ * the offsets of the cells on the wrong side are computed for a block at each end, without branches
+ * and with the given instruction set, then these cells are swapped by pairs,
+ * from the beginning of the left block and from the end of the right block
+ * (hence a reverse sorted array is sorted by the first partition).
+ * The last cells in the middle are partitioned by a branchless Lomuto partition.
+ */
+static size_t TSODLULS_partition__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint64_t i_bound,
+  int i_instruction_set
+){
+  uint32_t arr_offsets_left[I_PARTITION_BLOCK_SIZE__SHORT + 16];//room for the SIMD writes
+  uint32_t arr_offsets_right[I_PARTITION_BLOCK_SIZE__SHORT + 16];
+  t_TSODLULS_sort_element__short* left_block = arr_elements;
+  t_TSODLULS_sort_element__short* right_block = arr_elements + i_number_of_elements;//end of the cells to partition
+  t_TSODLULS_sort_element__short* left_cell;
+  t_TSODLULS_sort_element__short* right_cell;
+  size_t i_number_left = 0;
+  size_t i_number_right = 0;
+  size_t i_start_left = 0;
+  size_t i_number_of_swaps = 0;
+  t_TSODLULS_sort_element__short tmp_cell;
+
+#ifdef TSODLULS_X86_SIMD
+#define TSODLULS_get_partition_offsets_with_instruction_set__short(arr_block, b_greater, arr_offsets) \
+  (\
+    i_instruction_set == I_INSTRUCTION_SET__AVX512 ?\
+      TSODLULS_get_partition_offsets_avx512__short((arr_block), i_bound, (b_greater), (arr_offsets))\
+    : i_instruction_set == I_INSTRUCTION_SET__AVX2 ?\
+      TSODLULS_get_partition_offsets_avx2__short((arr_block), i_bound, (b_greater), (arr_offsets))\
+    : TSODLULS_get_partition_offsets__short((arr_block), i_bound, (b_greater), (arr_offsets))\
+  )
+#else
+#define TSODLULS_get_partition_offsets_with_instruction_set__short(arr_block, b_greater, arr_offsets) \
+  TSODLULS_get_partition_offsets__short((arr_block), i_bound, (b_greater), (arr_offsets))
+#endif
+
+  //the cells before left_block are smaller than i_bound, the cells after right_block are not
+  if(i_number_of_elements >= 2 * I_PARTITION_BLOCK_SIZE__SHORT){
+    right_block -= I_PARTITION_BLOCK_SIZE__SHORT;
+    while(left_block + I_PARTITION_BLOCK_SIZE__SHORT <= right_block){
+      if(i_number_left == 0){
+        i_start_left = 0;
+        i_number_left = TSODLULS_get_partition_offsets_with_instruction_set__short(left_block, 1, arr_offsets_left);
+      }
+      if(i_number_right == 0){
+        i_number_right = TSODLULS_get_partition_offsets_with_instruction_set__short(right_block, 0, arr_offsets_right);
+      }
+      i_number_of_swaps = i_number_left < i_number_right ? i_number_left : i_number_right;
+      for(size_t i = 0; i < i_number_of_swaps; ++i){
+        left_cell = left_block + arr_offsets_left[i_start_left + i];
+        right_cell = right_block + arr_offsets_right[i_number_right - 1 - i];
+        tmp_cell = *left_cell; *left_cell = *right_cell; *right_cell = tmp_cell;//swapping
+      }
+      i_number_left -= i_number_of_swaps;
+      i_number_right -= i_number_of_swaps;
+      i_start_left += i_number_of_swaps;
+      if(i_number_left == 0){
+        left_block += I_PARTITION_BLOCK_SIZE__SHORT;
+      }
+      if(i_number_right == 0){
+        right_block -= I_PARTITION_BLOCK_SIZE__SHORT;
+      }
+    }
+    right_block += I_PARTITION_BLOCK_SIZE__SHORT;
+  }
+
+#undef TSODLULS_get_partition_offsets_with_instruction_set__short
+
+  //branchless Lomuto partition of the cells in the middle (the unfinished blocks are in the middle)
+  right_cell = left_block;
+  for(left_cell = left_block; left_cell < right_block; ++left_cell){
+    tmp_cell = *left_cell;
+    *left_cell = *right_cell;
+    *right_cell = tmp_cell;
+    right_cell += tmp_cell.i_key < i_bound;
+  }
+
+  return (size_t)(right_cell - arr_elements);
+}//end function TSODLULS_partition__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * TSODLULS_sort_radix8_count_insertion__short_with_threshold() in buffers given by the caller,
+ * so that they can be shared by many sorts: arr_elements_copy has room for i_number_of_elements cells
+ * and arr_instances for TSODLULS_get_number_of_radix_instances__short() instances.
+ * The buffers are not used when there is at most i_threshold elements.
+ * With b_networks, the buckets of at most i_threshold elements (at most I_SORT_NETWORK_MAX_SIZE__SHORT)
+ * are sorted by sorting networks as soon as they are found, instead of the final insertion sort.
+ */
+static int TSODLULS_sort_radix8_count_insertion__short_in_buffers(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  size_t i_threshold,
+  t_TSODLULS_sort_element__short* arr_elements_copy,
+  t_TSODLULS_radix_instance* arr_instances,
+  unsigned int b_networks
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Allocates the buffers of TSODLULS_sort_radix8_count_insertion__short_in_buffers(),
+ * if they are needed, sorts and frees them.
+ */
+static int TSODLULS_sort_radix8_count_insertion__short_with_buffers(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  size_t i_threshold,
+  unsigned int b_networks
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * The function of the threads of TSODLULS_sort_segmented_parallel__short()
+ */
+static void* TSODLULS_sort_segmented_task__short(void* p_task){
+  t_TSODLULS_segmented_sort_task* p_segmented_sort_task = (t_TSODLULS_segmented_sort_task*) p_task;
+  p_segmented_sort_task->i_result = TSODLULS_sort_segmented__short(
+      (t_TSODLULS_sort_element__short*) p_segmented_sort_task->arr_elements,
+      p_segmented_sort_task->arr_segment_offsets,
+      p_segmented_sort_task->i_number_of_segments,
+      p_segmented_sort_task->i_max_length
+  );
+  return NULL;
+}//end function TSODLULS_sort_segmented_task__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Free the buffers of a samplesort (see TSODLULS_samplesort_init__short())
+ */
+static void TSODLULS_samplesort_free__short(t_TSODLULS_samplesort* p_samplesort){
+  if(p_samplesort->arr_threads != NULL){
+    for(size_t i = 0; i < p_samplesort->i_number_of_threads; ++i){
+      TSODLULS_free(p_samplesort->arr_threads[i].arr_buffers);
+      TSODLULS_free(p_samplesort->arr_threads[i].arr_buffer_counts);
+      TSODLULS_free(p_samplesort->arr_threads[i].arr_bucket_sizes);
+      TSODLULS_free(p_samplesort->arr_threads[i].arr_swap_buffers);
+    }
+  }
+  if(p_samplesort->arr_mutexes != NULL){
+    for(size_t i = 0; i < I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS; ++i){
+      pthread_mutex_destroy(&(p_samplesort->arr_mutexes[i]));
+    }
+    pthread_mutex_destroy(&(p_samplesort->next_bucket_mutex));
+  }
+  TSODLULS_free(p_samplesort->arr_threads);
+  TSODLULS_free(p_samplesort->arr_mutexes);
+  TSODLULS_free(p_samplesort->arr_tree);
+  TSODLULS_free(p_samplesort->arr_splitters);
+  TSODLULS_free(p_samplesort->arr_overflow);
+  TSODLULS_free(p_samplesort->arr_bucket_starts);
+  TSODLULS_free(p_samplesort->arr_bucket_writes);
+  TSODLULS_free(p_samplesort->arr_bucket_reads);
+  TSODLULS_free(p_samplesort->arr_pending_reads);
+}//end function TSODLULS_samplesort_free__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Allocate the buffers of a samplesort with i_number_of_threads threads,
+ * they do not depend on the number of elements to sort.
+ */
+static int TSODLULS_samplesort_init__short(t_TSODLULS_samplesort* p_samplesort, size_t i_number_of_threads){
+  pthread_mutex_t* arr_mutexes = NULL;
+  unsigned int b_allocated = 1;
+
+  memset(p_samplesort, 0, sizeof(t_TSODLULS_samplesort));
+  p_samplesort->i_number_of_threads = i_number_of_threads;
+  p_samplesort->i_random = 0x9E3779B97F4A7C15ull;
+  p_samplesort->arr_tree = calloc(I_SAMPLESORT_MAX_NUMBER_OF_LEAVES, sizeof(uint64_t));
+  p_samplesort->arr_splitters = calloc(I_SAMPLESORT_MAX_NUMBER_OF_LEAVES, sizeof(uint64_t));
+  p_samplesort->arr_overflow = calloc(I_SAMPLESORT_BLOCK_SIZE__SHORT, sizeof(t_TSODLULS_sort_element__short));
+  p_samplesort->arr_bucket_starts = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS + 1, sizeof(size_t));
+  p_samplesort->arr_bucket_writes = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(size_t));
+  p_samplesort->arr_bucket_reads = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(size_t));
+  p_samplesort->arr_pending_reads = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(size_t));
+  p_samplesort->arr_threads = calloc(i_number_of_threads, sizeof(t_TSODLULS_samplesort_thread));
+  if(
+    p_samplesort->arr_tree == NULL
+    || p_samplesort->arr_splitters == NULL
+    || p_samplesort->arr_overflow == NULL
+    || p_samplesort->arr_bucket_starts == NULL
+    || p_samplesort->arr_bucket_writes == NULL
+    || p_samplesort->arr_bucket_reads == NULL
+    || p_samplesort->arr_pending_reads == NULL
+    || p_samplesort->arr_threads == NULL
+  ){
+    TSODLULS_samplesort_free__short(p_samplesort);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+
+  for(size_t i = 0; i < i_number_of_threads; ++i){
+    t_TSODLULS_samplesort_thread* p_thread = &(p_samplesort->arr_threads[i]);
+    p_thread->p_samplesort = p_samplesort;
+    p_thread->i_thread = i;
+    p_thread->arr_buffers = calloc(
+        I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS * I_SAMPLESORT_BLOCK_SIZE__SHORT,
+        sizeof(t_TSODLULS_sort_element__short)
+    );
+    p_thread->arr_buffer_counts = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(size_t));
+    p_thread->arr_bucket_sizes = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(size_t));
+    p_thread->arr_swap_buffers = calloc(2 * I_SAMPLESORT_BLOCK_SIZE__SHORT, sizeof(t_TSODLULS_sort_element__short));
+    if(
+      p_thread->arr_buffers == NULL
+      || p_thread->arr_buffer_counts == NULL
+      || p_thread->arr_bucket_sizes == NULL
+      || p_thread->arr_swap_buffers == NULL
+    ){
+      b_allocated = 0;
+    }
+  }
+
+  //the mutexes are destroyed by TSODLULS_samplesort_free__short() only if they were all initialized
+  arr_mutexes = calloc(I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS, sizeof(pthread_mutex_t));
+  if(!b_allocated || arr_mutexes == NULL){
+    TSODLULS_free(arr_mutexes);
+    TSODLULS_samplesort_free__short(p_samplesort);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  for(size_t i = 0; i < I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS; ++i){
+    pthread_mutex_init(&(arr_mutexes[i]), NULL);
+  }
+  pthread_mutex_init(&(p_samplesort->next_bucket_mutex), NULL);
+  p_samplesort->arr_mutexes = arr_mutexes;
+
+  return 0;
+}//end function TSODLULS_samplesort_init__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Xorshift generator of the samples of the samplesort
+ */
+static inline uint64_t TSODLULS_samplesort_random__short(t_TSODLULS_samplesort* p_samplesort){
+  p_samplesort->i_random ^= p_samplesort->i_random << 13;
+  p_samplesort->i_random ^= p_samplesort->i_random >> 7;
+  p_samplesort->i_random ^= p_samplesort->i_random << 17;
+  return p_samplesort->i_random;
+}//end function TSODLULS_samplesort_random__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Choose the splitters of the samplesort in a random sample moved at the beginning of the array,
+ * without duplicates, and build the search tree.
+ * The number of leaves is the smallest power of two above the number of splitters,
+ * the last splitter is repeated to fill the tree.
+ */
+static void TSODLULS_samplesort_build_tree__short(
+  t_TSODLULS_samplesort* p_samplesort,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+){
+  uint64_t* arr_tree = (uint64_t*) p_samplesort->arr_tree;
+  uint64_t* arr_splitters = (uint64_t*) p_samplesort->arr_splitters;
+  t_TSODLULS_sort_element__short tmp_cell;
+  size_t i_log2 = 0;
+  size_t i_sample_size = 0;
+  size_t i_number_of_splitters = 0;
+  size_t i_log2_number_of_leaves = 1;
+  size_t i_number_of_leaves = 0;
+  size_t j = 0;
+
+  //oversampling factor of 0.2 * log2(n) as in IPS4o
+  for(size_t i = i_number_of_elements; i > 1; i >>= 1){
+    ++i_log2;
+  }
+  i_sample_size = (i_log2 < 10 ? 1 : i_log2 / 5) * I_SAMPLESORT_MAX_NUMBER_OF_LEAVES;
+  if(i_sample_size > i_number_of_elements){
+    i_sample_size = i_number_of_elements;
+  }
+  for(size_t i = 0; i < i_sample_size; ++i){
+    j = i + TSODLULS_samplesort_random__short(p_samplesort) % (i_number_of_elements - i);
+    tmp_cell = arr_elements[i]; arr_elements[i] = arr_elements[j]; arr_elements[j] = tmp_cell;//swapping
+  }
+  TSODLULS_qsort_vectorized__short(arr_elements, i_sample_size);
+
+  for(size_t i = 1; i < I_SAMPLESORT_MAX_NUMBER_OF_LEAVES; ++i){
+    j = i * i_sample_size / I_SAMPLESORT_MAX_NUMBER_OF_LEAVES;
+    if(j == 0){
+      continue;
+    }
+    if(i_number_of_splitters == 0 || arr_elements[j - 1].i_key != arr_splitters[i_number_of_splitters]){
+      arr_splitters[++i_number_of_splitters] = arr_elements[j - 1].i_key;
+    }
+  }
+  if(i_number_of_splitters == 0){
+    arr_splitters[++i_number_of_splitters] = arr_elements[0].i_key;
+  }
+  while(((size_t)1 << i_log2_number_of_leaves) <= i_number_of_splitters){
+    ++i_log2_number_of_leaves;
+  }
+  i_number_of_leaves = (size_t)1 << i_log2_number_of_leaves;
+  for(size_t i = i_number_of_splitters + 1; i < i_number_of_leaves; ++i){
+    arr_splitters[i] = arr_splitters[i_number_of_splitters];
+  }
+
+  for(size_t i_level = 0; i_level < i_log2_number_of_leaves; ++i_level){
+    for(size_t i = (size_t)1 << i_level; i < (size_t)2 << i_level; ++i){
+      arr_tree[i] = arr_splitters[((2 * (i - ((size_t)1 << i_level)) + 1) * i_number_of_leaves) >> (i_level + 1)];
+    }
+  }
+  p_samplesort->i_log2_number_of_leaves = i_log2_number_of_leaves;
+  p_samplesort->i_number_of_buckets = 2 * i_number_of_leaves - 1;
+}//end function TSODLULS_samplesort_build_tree__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Bucket of a key in the search tree of the samplesort, without branches.
+ * After the descent in the tree, j is the number of splitters smaller than or equal to the key.
+ */
+static inline size_t TSODLULS_samplesort_classify__short(const t_TSODLULS_samplesort* p_samplesort, uint64_t i_key){
+  const uint64_t* arr_tree = (const uint64_t*) p_samplesort->arr_tree;
+  const uint64_t* arr_splitters = (const uint64_t*) p_samplesort->arr_splitters;
+  size_t i_node = 1;
+  size_t j = 0;
+  for(size_t i_level = 0; i_level < p_samplesort->i_log2_number_of_leaves; ++i_level){
+    i_node = 2 * i_node + (arr_tree[i_node] <= i_key);
+  }
+  j = i_node - ((size_t)1 << p_samplesort->i_log2_number_of_leaves);
+  return 2 * j - ((j != 0) & (arr_splitters[j] == i_key));
+}//end function TSODLULS_samplesort_classify__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * The function of the threads for the classification of the samplesort:
+ * the cells of the stripe of the thread are classified in the buffers of the buckets,
+ * and each full buffer is written back as a block at the beginning of the stripe.
+ * The cells are classified eight at a time to interleave the descents in the search tree.
+ */
+static void* TSODLULS_samplesort_classify_task__short(void* p_task){
+  t_TSODLULS_samplesort_thread* p_thread = (t_TSODLULS_samplesort_thread*) p_task;
+  const t_TSODLULS_samplesort* p_samplesort = p_thread->p_samplesort;
+  t_TSODLULS_sort_element__short* arr_elements = (t_TSODLULS_sort_element__short*) p_samplesort->arr_elements;
+  t_TSODLULS_sort_element__short* arr_buffers = (t_TSODLULS_sort_element__short*) p_thread->arr_buffers;
+  size_t* arr_buffer_counts = p_thread->arr_buffer_counts;
+  size_t* arr_bucket_sizes = p_thread->arr_bucket_sizes;
+  const uint64_t* arr_tree = (const uint64_t*) p_samplesort->arr_tree;
+  const uint64_t* arr_splitters = (const uint64_t*) p_samplesort->arr_splitters;
+  size_t i_log2_number_of_leaves = p_samplesort->i_log2_number_of_leaves;
+  size_t i_number_of_leaves = (size_t)1 << i_log2_number_of_leaves;
+  size_t i_write = p_thread->i_stripe_first;
+  size_t i = p_thread->i_stripe_first;
+  size_t arr_nodes[8];
+  size_t i_bucket = 0;
+
+  memset(arr_buffer_counts, 0, p_samplesort->i_number_of_buckets * sizeof(size_t));
+  memset(arr_bucket_sizes, 0, p_samplesort->i_number_of_buckets * sizeof(size_t));
+
+  //at most one block per bucket is buffered, hence the blocks written never overlap the unread cells
+#define TSODLULS_samplesort_distribute__short(i_cell, i_node) \
+  i_bucket = (i_node) - i_number_of_leaves;\
+  i_bucket = 2 * i_bucket - ((i_bucket != 0) & (arr_splitters[i_bucket] == arr_elements[i_cell].i_key));\
+  arr_buffers[i_bucket * I_SAMPLESORT_BLOCK_SIZE__SHORT + arr_buffer_counts[i_bucket]] = arr_elements[i_cell];\
+  if(++arr_buffer_counts[i_bucket] == I_SAMPLESORT_BLOCK_SIZE__SHORT){\
+    memcpy(\
+        &(arr_elements[i_write]),\
+        &(arr_buffers[i_bucket * I_SAMPLESORT_BLOCK_SIZE__SHORT]),\
+        I_SAMPLESORT_BLOCK_SIZE__SHORT * sizeof(t_TSODLULS_sort_element__short)\
+    );\
+    i_write += I_SAMPLESORT_BLOCK_SIZE__SHORT;\
+    arr_buffer_counts[i_bucket] = 0;\
+    arr_bucket_sizes[i_bucket] += I_SAMPLESORT_BLOCK_SIZE__SHORT;\
+  }
+
+  for(; i + 8 <= p_thread->i_stripe_end; i += 8){
+    for(size_t u = 0; u < 8; ++u){
+      arr_nodes[u] = 1;
+    }
+    for(size_t i_level = 0; i_level < i_log2_number_of_leaves; ++i_level){
+      for(size_t u = 0; u < 8; ++u){
+        arr_nodes[u] = 2 * arr_nodes[u] + (arr_tree[arr_nodes[u]] <= arr_elements[i + u].i_key);
+      }
+    }
+    for(size_t u = 0; u < 8; ++u){
+      TSODLULS_samplesort_distribute__short(i + u, arr_nodes[u])
+    }
+  }
+  for(; i < p_thread->i_stripe_end; ++i){
+    arr_nodes[0] = 1;
+    for(size_t i_level = 0; i_level < i_log2_number_of_leaves; ++i_level){
+      arr_nodes[0] = 2 * arr_nodes[0] + (arr_tree[arr_nodes[0]] <= arr_elements[i].i_key);
+    }
+    TSODLULS_samplesort_distribute__short(i, arr_nodes[0])
+  }
+
+#undef TSODLULS_samplesort_distribute__short
+
+  for(size_t b = 0; b < p_samplesort->i_number_of_buckets; ++b){
+    arr_bucket_sizes[b] += arr_buffer_counts[b];
+  }
+  p_thread->i_number_of_full_blocks = (i_write - p_thread->i_stripe_first) / I_SAMPLESORT_BLOCK_SIZE__SHORT;
+  return NULL;
+}//end function TSODLULS_samplesort_classify_task__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * The function of the threads for the permutation of the blocks of the samplesort.
+ * Each bucket has a write pointer and a read pointer on block boundaries:
+ * the blocks before the write pointer are in place, the blocks between the write pointer
+ * and the read pointer are not processed yet, and the blocks after are empty.
+ * A thread reads the last unprocessed block of a bucket and writes it at the write pointer of its bucket,
+ * if an unprocessed block was there, it is swapped and its own bucket is processed the same way.
+ * A block is only written at an empty place once the pending reads of its bucket are done.
+ */
+static void* TSODLULS_samplesort_permute_task__short(void* p_task){
+  t_TSODLULS_samplesort_thread* p_thread = (t_TSODLULS_samplesort_thread*) p_task;
+  t_TSODLULS_samplesort* p_samplesort = p_thread->p_samplesort;
+  t_TSODLULS_sort_element__short* arr_elements = (t_TSODLULS_sort_element__short*) p_samplesort->arr_elements;
+  t_TSODLULS_sort_element__short* p_block = (t_TSODLULS_sort_element__short*) p_thread->arr_swap_buffers;
+  t_TSODLULS_sort_element__short* p_other_block = p_block + I_SAMPLESORT_BLOCK_SIZE__SHORT;
+  t_TSODLULS_sort_element__short* p_tmp_block = NULL;
+  size_t i_number_of_buckets = p_samplesort->i_number_of_buckets;
+  size_t i_bucket = p_thread->i_thread * i_number_of_buckets / p_samplesort->i_number_of_threads;
+  size_t i_target = 0;
+  size_t i_read = 0;
+  size_t i_write = 0;
+  size_t i_read_end = 0;
+  size_t i_pending_reads = 0;
+
+  for(size_t i = 0; i < i_number_of_buckets; ++i){
+    while(1){
+      pthread_mutex_lock(&(p_samplesort->arr_mutexes[i_bucket]));
+      if(p_samplesort->arr_bucket_reads[i_bucket] <= p_samplesort->arr_bucket_writes[i_bucket]){
+        pthread_mutex_unlock(&(p_samplesort->arr_mutexes[i_bucket]));
+        break;
+      }
+      p_samplesort->arr_bucket_reads[i_bucket] -= I_SAMPLESORT_BLOCK_SIZE__SHORT;
+      i_read = p_samplesort->arr_bucket_reads[i_bucket];
+      ++p_samplesort->arr_pending_reads[i_bucket];
+      pthread_mutex_unlock(&(p_samplesort->arr_mutexes[i_bucket]));
+      memcpy(p_block, &(arr_elements[i_read]), I_SAMPLESORT_BLOCK_SIZE__SHORT * sizeof(t_TSODLULS_sort_element__short));
+      pthread_mutex_lock(&(p_samplesort->arr_mutexes[i_bucket]));
+      --p_samplesort->arr_pending_reads[i_bucket];
+      pthread_mutex_unlock(&(p_samplesort->arr_mutexes[i_bucket]));
+
+      while(1){
+        i_target = TSODLULS_samplesort_classify__short(p_samplesort, p_block[0].i_key);
+        pthread_mutex_lock(&(p_samplesort->arr_mutexes[i_target]));
+        i_write = p_samplesort->arr_bucket_writes[i_target];
+        p_samplesort->arr_bucket_writes[i_target] += I_SAMPLESORT_BLOCK_SIZE__SHORT;
+        i_read_end = p_samplesort->arr_bucket_reads[i_target];
+        pthread_mutex_unlock(&(p_samplesort->arr_mutexes[i_target]));
+        if(i_write < i_read_end){
+          //an unprocessed block is swapped
+          memcpy(
+              p_other_block,
+              &(arr_elements[i_write]),
+              I_SAMPLESORT_BLOCK_SIZE__SHORT * sizeof(t_TSODLULS_sort_element__short)
+          );
+          memcpy(&(arr_elements[i_write]), p_block, I_SAMPLESORT_BLOCK_SIZE__SHORT * sizeof(t_TSODLULS_sort_element__short));
+          p_tmp_block = p_block; p_block = p_other_block; p_other_block = p_tmp_block;
+          continue;
+        }
+        do{
+          pthread_mutex_lock(&(p_samplesort->arr_mutexes[i_target]));
+          i_pending_reads = p_samplesort->arr_pending_reads[i_target];
+          pthread_mutex_unlock(&(p_samplesort->arr_mutexes[i_target]));
+          if(i_pending_reads > 0){
+            sched_yield();
+          }
+        }
+        while(i_pending_reads > 0);
+        if(i_write + I_SAMPLESORT_BLOCK_SIZE__SHORT > p_samplesort->i_number_of_elements){
+          memcpy(
+              p_samplesort->arr_overflow,
+              p_block,
+              I_SAMPLESORT_BLOCK_SIZE__SHORT * sizeof(t_TSODLULS_sort_element__short)
+          );
+        }
+        else{
+          memcpy(&(arr_elements[i_write]), p_block, I_SAMPLESORT_BLOCK_SIZE__SHORT * sizeof(t_TSODLULS_sort_element__short));
+        }
+        break;
+      }
+    }
+    if(++i_bucket == i_number_of_buckets){
+      i_bucket = 0;
+    }
+  }
+  return NULL;
+}//end function TSODLULS_samplesort_permute_task__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Run a function on all the threads of the samplesort (including the calling thread).
+ * If a thread cannot be created, its function is run by the calling thread.
+ */
+static void TSODLULS_samplesort_run_threads__short(t_TSODLULS_samplesort* p_samplesort, void* (*f_task)(void*)){
+  for(size_t i = 1; i < p_samplesort->i_number_of_threads; ++i){
+    p_samplesort->arr_threads[i].b_started = pthread_create(
+        &(p_samplesort->arr_threads[i].thread),
+        NULL,
+        f_task,
+        &(p_samplesort->arr_threads[i])
+    ) == 0;
+  }
+  f_task(&(p_samplesort->arr_threads[0]));
+  for(size_t i = 1; i < p_samplesort->i_number_of_threads; ++i){
+    if(p_samplesort->arr_threads[i].b_started){
+      pthread_join(p_samplesort->arr_threads[i].thread, NULL);
+    }
+    else{
+      f_task(&(p_samplesort->arr_threads[i]));
+    }
+  }
+}//end function TSODLULS_samplesort_run_threads__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * One partition step of the samplesort, the bucket starts are in p_samplesort->arr_bucket_starts afterwards:
+ * - the splitters are chosen,
+ * - the threads classify the cells of their stripes,
+ * - the full blocks are moved at the beginning of the array,
+ * - the threads move the blocks in their buckets,
+ * - the partial blocks of the buffers and the overflowing cells of the last block of each bucket
+ *   are written at the beginning and the end of the bucket.
+ */
+static void TSODLULS_samplesort_partition__short(
+  t_TSODLULS_samplesort* p_samplesort,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+){
+  t_TSODLULS_samplesort_thread* arr_threads = p_samplesort->arr_threads;
+  size_t* arr_bucket_starts = p_samplesort->arr_bucket_starts;
+  size_t i_number_of_threads = p_samplesort->i_number_of_threads;
+  size_t i_number_of_buckets = 0;
+  size_t i_stripe_size = 0;
+  size_t i_full_blocks_end = 0;
+  size_t i_full_thread = 0;
+  size_t i_full_block = 0;
+  size_t i_empty_end = 0;
+  size_t i_bucket_start = 0;
+  size_t i_bucket_end = 0;
+  size_t i_aligned_start = 0;
+  size_t i_aligned_end = 0;
+  size_t i_write = 0;
+  size_t i_destination = 0;
+  size_t i_destination_end = 0;
+  size_t i_copy = 0;
+  size_t i_count = 0;
+  t_TSODLULS_sort_element__short* p_source = NULL;
+
+#define TSODLULS_samplesort_align__short(i_offset) \
+  (((i_offset) + I_SAMPLESORT_BLOCK_SIZE__SHORT - 1) / I_SAMPLESORT_BLOCK_SIZE__SHORT * I_SAMPLESORT_BLOCK_SIZE__SHORT)
+
+  p_samplesort->arr_elements = arr_elements;
+  p_samplesort->i_number_of_elements = i_number_of_elements;
+  TSODLULS_samplesort_build_tree__short(p_samplesort, arr_elements, i_number_of_elements);
+  i_number_of_buckets = p_samplesort->i_number_of_buckets;
+
+  //classification in stripes of whole blocks
+  i_stripe_size = TSODLULS_samplesort_align__short((i_number_of_elements + i_number_of_threads - 1) / i_number_of_threads);
+  for(size_t t = 0; t < i_number_of_threads; ++t){
+    arr_threads[t].i_stripe_first = t * i_stripe_size < i_number_of_elements ? t * i_stripe_size : i_number_of_elements;
+    arr_threads[t].i_stripe_end = arr_threads[t].i_stripe_first + i_stripe_size < i_number_of_elements ?
+      arr_threads[t].i_stripe_first + i_stripe_size : i_number_of_elements;
+  }
+  TSODLULS_samplesort_run_threads__short(p_samplesort, TSODLULS_samplesort_classify_task__short);
+
+  arr_bucket_starts[0] = 0;
+  for(size_t b = 0; b < i_number_of_buckets; ++b){
+    arr_bucket_starts[b + 1] = arr_bucket_starts[b];
+    for(size_t t = 0; t < i_number_of_threads; ++t){
+      arr_bucket_starts[b + 1] += arr_threads[t].arr_bucket_sizes[b];
+    }
+  }
+  for(size_t t = 0; t < i_number_of_threads; ++t){
+    i_full_blocks_end += arr_threads[t].i_number_of_full_blocks * I_SAMPLESORT_BLOCK_SIZE__SHORT;
+  }
+
+  //the empty blocks before i_full_blocks_end receive the full blocks after it, from the last stripe
+  i_full_thread = i_number_of_threads - 1;
+  i_full_block = arr_threads[i_full_thread].i_stripe_first
+               + arr_threads[i_full_thread].i_number_of_full_blocks * I_SAMPLESORT_BLOCK_SIZE__SHORT;
+  for(size_t t = 0; t < i_number_of_threads; ++t){
+    i_empty_end = arr_threads[t].i_stripe_end < i_full_blocks_end ? arr_threads[t].i_stripe_end : i_full_blocks_end;
+    for(
+      size_t i_empty = arr_threads[t].i_stripe_first + arr_threads[t].i_number_of_full_blocks * I_SAMPLESORT_BLOCK_SIZE__SHORT;
+      i_empty < i_empty_end;
+      i_empty += I_SAMPLESORT_BLOCK_SIZE__SHORT
+    ){
+      while(
+        i_full_block <= arr_threads[i_full_thread].i_stripe_first
+        || i_full_block <= i_full_blocks_end
+      ){
+        --i_full_thread;
+        i_full_block = arr_threads[i_full_thread].i_stripe_first
+                     + arr_threads[i_full_thread].i_number_of_full_blocks * I_SAMPLESORT_BLOCK_SIZE__SHORT;
+      }
+      i_full_block -= I_SAMPLESORT_BLOCK_SIZE__SHORT;
+      memcpy(
+          &(arr_elements[i_empty]),
+          &(arr_elements[i_full_block]),
+          I_SAMPLESORT_BLOCK_SIZE__SHORT * sizeof(t_TSODLULS_sort_element__short)
+      );
+    }
+  }
+
+  //permutation of the blocks
+  for(size_t b = 0; b < i_number_of_buckets; ++b){
+    i_aligned_start = TSODLULS_samplesort_align__short(arr_bucket_starts[b]);
+    i_aligned_end = TSODLULS_samplesort_align__short(arr_bucket_starts[b + 1]);
+    if(i_aligned_end > i_full_blocks_end){
+      i_aligned_end = i_full_blocks_end;
+    }
+    p_samplesort->arr_bucket_writes[b] = i_aligned_start;
+    p_samplesort->arr_bucket_reads[b] = i_aligned_end > i_aligned_start ? i_aligned_end : i_aligned_start;
+    p_samplesort->arr_pending_reads[b] = 0;
+  }
+  TSODLULS_samplesort_run_threads__short(p_samplesort, TSODLULS_samplesort_permute_task__short);
+
+  //cleanup: the cells of the bucket that are not in its aligned blocks fill its head and its tail
+#define TSODLULS_samplesort_fill_bucket__short(p_cells, i_number_of_cells) \
+  p_source = (p_cells);\
+  i_count = (i_number_of_cells);\
+  while(i_count > 0){\
+    if(i_destination == i_destination_end){\
+      i_destination = i_write;\
+      i_destination_end = i_bucket_end;\
+    }\
+    i_copy = i_destination_end - i_destination < i_count ? i_destination_end - i_destination : i_count;\
+    memcpy(&(arr_elements[i_destination]), p_source, i_copy * sizeof(t_TSODLULS_sort_element__short));\
+    i_destination += i_copy;\
+    p_source += i_copy;\
+    i_count -= i_copy;\
+  }
+
+  for(size_t b = 0; b < i_number_of_buckets; ++b){
+    i_bucket_start = arr_bucket_starts[b];
+    i_bucket_end = arr_bucket_starts[b + 1];
+    i_aligned_start = TSODLULS_samplesort_align__short(i_bucket_start);
+    i_write = p_samplesort->arr_bucket_writes[b];
+    i_destination = i_bucket_start;
+    i_destination_end = i_aligned_start < i_bucket_end ? i_aligned_start : i_bucket_end;
+    if(i_write > i_aligned_start && i_write > i_bucket_end){
+      //the last block overflows in the head of the next bucket or after the array
+      if(i_write > i_number_of_elements){
+        i_copy = i_bucket_end - (i_write - I_SAMPLESORT_BLOCK_SIZE__SHORT);
+        memcpy(
+            &(arr_elements[i_write - I_SAMPLESORT_BLOCK_SIZE__SHORT]),
+            p_samplesort->arr_overflow,
+            i_copy * sizeof(t_TSODLULS_sort_element__short)
+        );
+        TSODLULS_samplesort_fill_bucket__short(
+            ((t_TSODLULS_sort_element__short*) p_samplesort->arr_overflow) + i_copy,
+            i_write - i_bucket_end
+        )
+      }
+      else{
+        TSODLULS_samplesort_fill_bucket__short(&(arr_elements[i_bucket_end]), i_write - i_bucket_end)
+      }
+    }
+    for(size_t t = 0; t < i_number_of_threads; ++t){
+      TSODLULS_samplesort_fill_bucket__short(
+          ((t_TSODLULS_sort_element__short*) arr_threads[t].arr_buffers) + b * I_SAMPLESORT_BLOCK_SIZE__SHORT,
+          arr_threads[t].arr_buffer_counts[b]
+      )
+    }
+  }
+
+#undef TSODLULS_samplesort_fill_bucket__short
+#undef TSODLULS_samplesort_align__short
+}//end function TSODLULS_samplesort_partition__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Samplesort with one thread, the buckets are sorted recursively
+ */
+static int TSODLULS_samplesort_sequential__short(
+  t_TSODLULS_samplesort* p_samplesort,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_depth
+){
+  int i_result = 0;
+  size_t arr_bucket_starts[I_SAMPLESORT_MAX_NUMBER_OF_BUCKETS + 1];
+  size_t i_number_of_buckets = 0;
+  size_t i_bucket_size = 0;
+
+  if(i_number_of_elements <= I_SAMPLESORT_BASE_CASE_SIZE || i_depth >= I_SAMPLESORT_MAX_DEPTH){
+    return TSODLULS_qsort_vectorized__short(arr_elements, i_number_of_elements);
+  }
+
+  TSODLULS_samplesort_partition__short(p_samplesort, arr_elements, i_number_of_elements);
+  i_number_of_buckets = p_samplesort->i_number_of_buckets;
+  memcpy(arr_bucket_starts, p_samplesort->arr_bucket_starts, (i_number_of_buckets + 1) * sizeof(size_t));
+
+  //the odd buckets contain equal keys
+  for(size_t b = 0; b < i_number_of_buckets && i_result == 0; b += 2){
+    i_bucket_size = arr_bucket_starts[b + 1] - arr_bucket_starts[b];
+    if(i_bucket_size > 1){
+      i_result = TSODLULS_samplesort_sequential__short(
+          p_samplesort,
+          &(arr_elements[arr_bucket_starts[b]]),
+          i_bucket_size,
+          i_depth + 1
+      );
+    }
+  }
+
+  return i_result;
+}//end function TSODLULS_samplesort_sequential__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * The function of the threads sorting the buckets of TSODLULS_sort_samplesort_parallel__short()
+ * that are not big, each thread takes the next bucket and sorts it with its own buffers.
+ */
+static void* TSODLULS_samplesort_buckets_task__short(void* p_task){
+  t_TSODLULS_samplesort_thread* p_thread = (t_TSODLULS_samplesort_thread*) p_task;
+  t_TSODLULS_samplesort* p_samplesort = p_thread->p_samplesort;
+  t_TSODLULS_sort_element__short* arr_elements = (t_TSODLULS_sort_element__short*) p_samplesort->arr_elements;
+  t_TSODLULS_samplesort samplesort;
+  size_t i_bucket = 0;
+  size_t i_bucket_size = 0;
+
+  p_thread->i_result = TSODLULS_samplesort_init__short(&samplesort, 1);
+  if(p_thread->i_result != 0){
+    return NULL;//the other threads sort the buckets
+  }
+  while(p_thread->i_result == 0){
+    pthread_mutex_lock(&(p_samplesort->next_bucket_mutex));
+    i_bucket = p_samplesort->i_next_bucket;
+    p_samplesort->i_next_bucket += 2;
+    pthread_mutex_unlock(&(p_samplesort->next_bucket_mutex));
+    if(i_bucket >= p_samplesort->i_number_of_buckets){
+      break;
+    }
+    i_bucket_size = p_samplesort->arr_bucket_starts[i_bucket + 1] - p_samplesort->arr_bucket_starts[i_bucket];
+    if(
+      i_bucket_size > 1
+      && (
+        i_bucket_size <= p_samplesort->i_number_of_elements / p_samplesort->i_number_of_threads
+        || i_bucket_size == p_samplesort->i_number_of_elements
+      )
+    ){
+      p_thread->i_result = TSODLULS_samplesort_sequential__short(
+          &samplesort,
+          &(arr_elements[p_samplesort->arr_bucket_starts[i_bucket]]),
+          i_bucket_size,
+          1
+      );
+    }
+  }
+  TSODLULS_samplesort_free__short(&samplesort);
+  return NULL;
+}//end function TSODLULS_samplesort_buckets_task__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * The next instance of a time-sliced sort, from the stack
+ */
+static void TSODLULS_sort_step_pop__short(t_TSODLULS_sort_step_context__short* p_context){
+  if(p_context->i_number_of_instances == 0){
+    p_context->i_step = I_SORT_STEP__FINISHED;
+    return;
+  }
+  p_context->current_instance = p_context->arr_instances[--(p_context->i_number_of_instances)];
+  p_context->i_next = p_context->current_instance.i_offset_first;
+  if(p_context->current_instance.i_depth >= p_context->i_max_length){
+    p_context->i_step = I_SORT_STEP__COPY_BACK;
+    return;
+  }
+  p_context->i_step = I_SORT_STEP__COUNT;
+  memset(p_context->arr_counts, 0, sizeof(p_context->arr_counts));
+}//end function TSODLULS_sort_step_pop__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Push an instance of a time-sliced sort on the stack
+ */
+static void TSODLULS_sort_step_push__short(
+  t_TSODLULS_sort_step_context__short* p_context,
+  size_t i_offset_first,
+  size_t i_offset_last,
+  size_t i_depth,
+  unsigned int b_copy
+){
+  t_TSODLULS_radix_instance* p_instance = &(p_context->arr_instances[(p_context->i_number_of_instances)++]);
+  p_instance->i_offset_first = i_offset_first;
+  p_instance->i_offset_last = i_offset_last;
+  p_instance->i_depth = i_depth;
+  p_instance->b_copy = b_copy;
+  TSODLULS_SORT_STATS_ADD(i_instances_pushed, 1);
+  TSODLULS_SORT_STATS_MAX(i_max_instance_stack_depth, p_context->i_number_of_instances);
+}//end function TSODLULS_sort_step_push__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Do the work of a time-sliced sort on at most about i_size cells and return the number of cells processed.
+ * This is the loop of TSODLULS_sort_radix8_count_insertion__short_in_buffers() cut in pieces:
+ * the counting and the scattering of an instance stop after i_size cells and resume at p_context->i_next,
+ * the buckets that are small or fully sorted are finished as soon as they are found,
+ * and the big fully sorted buckets left in the buffer are pushed as instances of depth i_max_length
+ * to be copied back in pieces.
+ */
+static size_t TSODLULS_sort_step_chunk__short(t_TSODLULS_sort_step_context__short* p_context, size_t i_size){
+  t_TSODLULS_radix_instance* p_current_instance = &(p_context->current_instance);
+  t_TSODLULS_sort_element__short* arr_source = p_context->arr_elements;
+  t_TSODLULS_sort_element__short* arr_destination = p_context->arr_elements_copy;
+  size_t i_end = 0;
+  size_t i_shift = (7 - p_current_instance->i_depth) * 8;
+  size_t i_processed = 0;
+  size_t i_bucket_first = 0;
+  int i_number_of_distinct_bytes = 0;
+  uint8_t i_current_octet = 0;
+
+  if(p_current_instance->b_copy){
+    arr_source = p_context->arr_elements_copy;
+    arr_destination = p_context->arr_elements;
+  }
+  i_end = p_current_instance->i_offset_last + 1;
+  if(p_context->i_step != I_SORT_STEP__BUCKETS && i_end - p_context->i_next > i_size){
+    i_end = p_context->i_next + i_size;
+  }
+
+  switch(p_context->i_step){
+    case I_SORT_STEP__COUNT:
+      for(size_t i = p_context->i_next; i < i_end; ++i){
+        ++(p_context->arr_counts[(uint8_t)(arr_source[i].i_key >> i_shift)]);
+      }
+      i_processed = i_end - p_context->i_next;
+      p_context->i_next = i_end;
+      if(i_end <= p_current_instance->i_offset_last){
+        break;
+      }
+      TSODLULS_SORT_STATS_ADD(i_histogram_passes, 1);
+      p_context->arr_offsets[0] = p_current_instance->i_offset_first;
+      for(int i = 0; i < 255; ++i){
+        p_context->arr_offsets[i + 1] = p_context->arr_offsets[i] + p_context->arr_counts[i];
+        i_number_of_distinct_bytes += p_context->arr_counts[i] > 0;
+      }
+      i_number_of_distinct_bytes += p_context->arr_counts[255] > 0;
+      p_context->i_next = p_current_instance->i_offset_first;
+      if(i_number_of_distinct_bytes > 1){
+        p_context->i_step = I_SORT_STEP__SCATTER;
+        break;
+      }
+      TSODLULS_SORT_STATS_ADD(i_single_byte_skips, 1);
+      ++(p_current_instance->i_depth);
+      if(p_current_instance->i_depth < p_context->i_max_length){
+        memset(p_context->arr_counts, 0, sizeof(p_context->arr_counts));
+      }
+      else if(p_current_instance->b_copy){
+        p_context->i_step = I_SORT_STEP__COPY_BACK;
+      }
+      else{
+        TSODLULS_sort_step_pop__short(p_context);
+      }
+      break;
+
+    case I_SORT_STEP__SCATTER:
+      for(size_t i = p_context->i_next; i < i_end; ++i){
+        i_current_octet = (uint8_t)(arr_source[i].i_key >> i_shift);
+        arr_destination[(p_context->arr_offsets[i_current_octet])++] = arr_source[i];
+      }
+      TSODLULS_SORT_STATS_ADD(i_bytes_scattered, (i_end - p_context->i_next) * sizeof(t_TSODLULS_sort_element__short));
+      i_processed = i_end - p_context->i_next;
+      p_context->i_next = i_end;
+      if(i_end > p_current_instance->i_offset_last){
+        p_context->i_step = I_SORT_STEP__BUCKETS;
+        p_context->i_next = 0;
+      }
+      break;
+
+    case I_SORT_STEP__BUCKETS:
+      //the cells are in arr_destination now, arr_offsets[i] is the end of the bucket i
+      for(; p_context->i_next < 256 && i_processed < i_size; ++(p_context->i_next)){
+        size_t i_count = p_context->arr_counts[p_context->i_next];
+        if(i_count == 0){
+          continue;
+        }
+        i_bucket_first = p_context->arr_offsets[p_context->i_next] - i_count;
+        if(i_count > I_RADIX_INSERTION_THRESHOLD__SHORT && p_context->i_max_length > p_current_instance->i_depth + 1){
+          TSODLULS_sort_step_push__short(
+              p_context,
+              i_bucket_first,
+              i_bucket_first + i_count - 1,
+              p_current_instance->i_depth + 1,
+              !p_current_instance->b_copy
+          );
+          continue;
+        }
+        if(!p_current_instance->b_copy){
+          if(i_count > I_RADIX_INSERTION_THRESHOLD__SHORT){
+            TSODLULS_sort_step_push__short(
+                p_context,
+                i_bucket_first,
+                i_bucket_first + i_count - 1,
+                p_context->i_max_length,
+                1
+            );
+            continue;
+          }
+          memcpy(
+            &(p_context->arr_elements[i_bucket_first]),
+            &(p_context->arr_elements_copy[i_bucket_first]),
+            i_count * sizeof(t_TSODLULS_sort_element__short)
+          );
+          TSODLULS_SORT_STATS_ADD(i_bytes_memcpy, i_count * sizeof(t_TSODLULS_sort_element__short));
+        }
+        if(i_count > 1 && p_context->i_max_length > p_current_instance->i_depth + 1){
+          TSODLULS_sort_insertion__short(&(p_context->arr_elements[i_bucket_first]), i_count);
+        }
+        i_processed += i_count;
+      }
+      if(p_context->i_next == 256){
+        TSODLULS_sort_step_pop__short(p_context);
+      }
+      break;
+
+    case I_SORT_STEP__COPY_BACK:
+      memcpy(
+        &(p_context->arr_elements[p_context->i_next]),
+        &(p_context->arr_elements_copy[p_context->i_next]),
+        (i_end - p_context->i_next) * sizeof(t_TSODLULS_sort_element__short)
+      );
+      TSODLULS_SORT_STATS_ADD(i_bytes_memcpy, (i_end - p_context->i_next) * sizeof(t_TSODLULS_sort_element__short));
+      i_processed = i_end - p_context->i_next;
+      p_context->i_next = i_end;
+      if(i_end > p_current_instance->i_offset_last){
+        TSODLULS_sort_step_pop__short(p_context);
+      }
+      break;
+  }
+
+  return i_processed;
+}//end function TSODLULS_sort_step_chunk__short()
 
 
 
@@ -34,7 +1375,9 @@ int TSODLULS_sort__short(
   size_t i_number_of_elements,
   uint8_t i_max_length
 ){
-  return TSODLULS_sort_radix8_count_insertion__short(arr_elements, i_number_of_elements, i_max_length);
+  t_TSODLULS_sort_model model;
+  TSODLULS_sort_model_init(&model);
+  return TSODLULS_sort_with_model__short(&model, arr_elements, i_number_of_elements, i_max_length);
 }//end function TSODLULS_sort()
 
 
@@ -49,11 +1392,145 @@ int TSODLULS_sort_stable__short(
   size_t i_number_of_elements,
   uint8_t i_max_length
 ){
-  return TSODLULS_sort_radix8_count_insertion__short(arr_elements, i_number_of_elements, i_max_length);
+  if(i_number_of_elements <= I_SORT_MODEL__INSERTION_THRESHOLD__SHORT){
+    return TSODLULS_sort_insertion__short(arr_elements, i_number_of_elements);
+  }
+  return TSODLULS_sort_radix8_count__short(arr_elements, i_number_of_elements, i_max_length);
 }//end function TSODLULS_sort_stable()
 
 
 
+/**
+ * Sorting functions for short nextified strings
+ * Choose the algorithm with the lowest cost for these elements according to the cost model
+ * (see t_TSODLULS_sort_model).
+ * Returns I_SORT_ALGORITHM__INSERTION, I_SORT_ALGORITHM__COMPARISON or I_SORT_ALGORITHM__RADIX.
+ */
+int TSODLULS_choose_sort_algorithm__short(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+){
+  size_t i_sample_size = 0;
+  size_t i_step = 0;
+  size_t i_prefix = 0;
+  size_t i_levels = 0;
+  size_t i_buckets = 1;
+  size_t i_instances = 0;
+  size_t i_max_instances = 0;
+  size_t i_log2 = 0;
+  uint64_t i_differences = 0;
+  double f_comparison_cost = 0.0;
+  double f_radix_cost = 0.0;
+
+  if(i_number_of_elements <= p_model->i_insertion_threshold__short){
+    return I_SORT_ALGORITHM__INSERTION;
+  }
+  if(i_max_length > 8){
+    i_max_length = 8;
+  }
+
+  //common prefix of a sample of the keys
+  i_sample_size = p_model->i_sample_size;
+  if(i_sample_size > i_number_of_elements){
+    i_sample_size = i_number_of_elements;
+  }
+  if(i_sample_size == 0){
+    i_sample_size = 1;
+  }
+  i_step = i_number_of_elements / i_sample_size;
+  for(size_t i = 1; i < i_sample_size; ++i){
+    i_differences |= arr_elements[i * i_step].i_key ^ arr_elements[0].i_key;
+  }
+  while(i_prefix < i_max_length && ((i_differences >> (56 - 8 * i_prefix)) & 255) == 0){
+    ++i_prefix;
+  }
+
+  //levels before the buckets are left to sorting networks by the radix engine
+  while(
+    i_prefix + i_levels < i_max_length
+    && i_number_of_elements / i_buckets > I_RADIX_NETWORK_THRESHOLD__SHORT
+  ){
+    if(i_levels > 0){
+      i_max_instances = i_number_of_elements / (2 * (I_RADIX_NETWORK_THRESHOLD__SHORT + 1));
+      i_instances += i_buckets < i_max_instances ? i_buckets : i_max_instances;
+    }
+    ++i_levels;
+    i_buckets *= 256;
+  }
+  for(size_t i = i_number_of_elements; i > 1; i >>= 1){
+    ++i_log2;
+  }
+
+  f_comparison_cost = ((double)i_number_of_elements) * i_log2 * p_model->f_comparison_cost__short;
+  f_radix_cost = p_model->f_radix_setup_cost__short
+    + i_prefix * (p_model->f_radix_level_cost__short + i_number_of_elements * p_model->f_radix_count_cost__short)
+    + ((double)i_levels) * i_number_of_elements * p_model->f_radix_pass_cost__short
+    + i_instances * p_model->f_radix_instance_cost__short;
+  if(f_comparison_cost < f_radix_cost){
+    return I_SORT_ALGORITHM__COMPARISON;
+  }
+  return I_SORT_ALGORITHM__RADIX;
+}//end function TSODLULS_choose_sort_algorithm__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Sort with the algorithm chosen by TSODLULS_choose_sort_algorithm__short().
+ * It is not stable since the comparison model uses quicksort.
+ */
+int TSODLULS_sort_with_model__short(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+){
+  if(i_number_of_elements < 2){
+    return 0;//nothing to sort
+  }
+  if(i_max_length <= 0){
+    return I_ERROR__MAX_LENGTH_SHOULD_BE_POSITIVE;
+  }
+  if(i_max_length > 8){
+    return I_ERROR__MAX_LENGTH_SHOULD_BE_AT_MOST_8;
+  }
+  switch(TSODLULS_choose_sort_algorithm__short(p_model, arr_elements, i_number_of_elements, i_max_length)){
+    case I_SORT_ALGORITHM__INSERTION:
+      return TSODLULS_sort_insertion__short(arr_elements, i_number_of_elements);
+    case I_SORT_ALGORITHM__COMPARISON:
+      return TSODLULS_qsort_vectorized__short(arr_elements, i_number_of_elements);
+    default:
+      return TSODLULS_sort_radix8_count_network__short(arr_elements, i_number_of_elements, i_max_length);
+  }
+}//end function TSODLULS_sort_with_model__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * A stable insertion sort for a small number of elements
+ */
+int TSODLULS_sort_insertion__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+){
+  t_TSODLULS_sort_element__short tmp_cell;
+  size_t j = 0;
+
+  for(size_t i = 1; i < i_number_of_elements; ++i){
+    tmp_cell = arr_elements[i];
+    for(j = i; j > 0 && tmp_cell.i_key < arr_elements[j - 1].i_key; --j){
+      arr_elements[j] = arr_elements[j - 1];
+    }
+    arr_elements[j] = tmp_cell;
+  }
+  return 0;
+}//end function TSODLULS_sort_insertion__short()
+
+
+
 /**
  * Sorting functions for short nextified strings
  * A stable sorting algorithm for nextified strings based on radix sort with octets digits
@@ -131,6 +1608,7 @@ int TSODLULS_sort_radix8_count__short(
         ++arr_counts[i_current_octet];
       }
     }
+    TSODLULS_SORT_STATS_ADD(i_histogram_passes, 1);
     //we deduce the offsets
     i_number_of_distinct_bytes = 0;
     for(int i = 0; i < 255; ++i){
@@ -144,6 +1622,7 @@ int TSODLULS_sort_radix8_count__short(
     }
 
     if(i_number_of_distinct_bytes == 1){
+      TSODLULS_SORT_STATS_ADD(i_single_byte_skips, 1);
       ++current_instance.i_depth;
       //if we are done sorting this instance and all deeper subinstances
       if(i_max_length <= current_instance.i_depth){
@@ -153,6 +1632,10 @@ int TSODLULS_sort_radix8_count__short(
             &(arr_elements_copy[current_instance.i_offset_first]),
             (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element__short)
           );
+          TSODLULS_SORT_STATS_ADD(
+            i_bytes_memcpy,
+            (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element__short)
+          );
         }
         if(i_current_instance == 0){
           break;
@@ -171,6 +1654,10 @@ int TSODLULS_sort_radix8_count__short(
         arr_elements[current_instance.i_offset_first + arr_offsets[i_current_octet]] = arr_elements_copy[i];
         ++arr_offsets[i_current_octet];
       }
+      TSODLULS_SORT_STATS_ADD(
+        i_bytes_scattered,
+        (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element__short)
+      );
       //instances creation
       for(int i = 0; i < 256; ++i){
         if(arr_counts[i] > 1//nothing to do for one element, result is in original array
@@ -194,6 +1681,7 @@ int TSODLULS_sort_radix8_count__short(
             }
             arr_instances = (t_TSODLULS_radix_instance*)p_for_realloc;
             i_max_number_of_instances *= 2;
+            TSODLULS_SORT_STATS_ADD(i_instances_reallocs, 1);
           }
           arr_instances[i_current_instance].i_offset_first = current_instance.i_offset_first
                                                            + arr_offsets[i] - arr_counts[i];
@@ -202,6 +1690,8 @@ int TSODLULS_sort_radix8_count__short(
           arr_instances[i_current_instance].i_depth = current_instance.i_depth + 1;
           arr_instances[i_current_instance].b_copy = 0;
           ++i_current_instance;
+          TSODLULS_SORT_STATS_ADD(i_instances_pushed, 1);
+          TSODLULS_SORT_STATS_MAX(i_max_instance_stack_depth, i_current_instance);
         }
       }//end for(int i = 0; i < 256; ++i)
     }
@@ -214,6 +1704,10 @@ int TSODLULS_sort_radix8_count__short(
         arr_elements_copy[current_instance.i_offset_first + arr_offsets[i_current_octet]] = arr_elements[i];
         ++arr_offsets[i_current_octet];
       }
+      TSODLULS_SORT_STATS_ADD(
+        i_bytes_scattered,
+        (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element__short)
+      );
       //instances creation
       for(int i = 0; i < 256; ++i){
         if(arr_counts[i] > 1
@@ -237,6 +1731,7 @@ int TSODLULS_sort_radix8_count__short(
             }
             arr_instances = (t_TSODLULS_radix_instance*)p_for_realloc;
             i_max_number_of_instances *= 2;
+            TSODLULS_SORT_STATS_ADD(i_instances_reallocs, 1);
           }
           arr_instances[i_current_instance].i_offset_first = current_instance.i_offset_first
                                                            + arr_offsets[i] - arr_counts[i];
@@ -245,6 +1740,8 @@ int TSODLULS_sort_radix8_count__short(
           arr_instances[i_current_instance].i_depth = current_instance.i_depth + 1;
           arr_instances[i_current_instance].b_copy = 1;
           ++i_current_instance;
+          TSODLULS_SORT_STATS_ADD(i_instances_pushed, 1);
+          TSODLULS_SORT_STATS_MAX(i_max_instance_stack_depth, i_current_instance);
         }
         else if(arr_counts[i] > 0){//we still need to copy data in original array
           memcpy(
@@ -252,6 +1749,7 @@ int TSODLULS_sort_radix8_count__short(
             &(arr_elements_copy[current_instance.i_offset_first + arr_offsets[i] - arr_counts[i]]),
             arr_counts[i] * sizeof(t_TSODLULS_sort_element__short)
           );
+          TSODLULS_SORT_STATS_ADD(i_bytes_memcpy, arr_counts[i] * sizeof(t_TSODLULS_sort_element__short));
         }
       }//end for(int i = 0; i < 256; ++i)
     }
@@ -283,6 +1781,26 @@ int TSODLULS_sort_radix8_count__short(
 int TSODLULS_qsort_inlined__short(
   t_TSODLULS_sort_element__short* arr_elements,
   size_t i_number_of_elements
+){
+  return TSODLULS_qsort_inlined__short_with_threshold(
+    arr_elements,
+    i_number_of_elements,
+    I_QSORT_INSERTION_THRESHOLD__SHORT
+  );
+}//end function TSODLULS_qsort_inlined__short
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Qsort from glibc inlined with short cells.
+ * Partitions of at most i_threshold + 1 elements are left to the final insertion sort
+ * (MAX_THRESH in glibc, see I_QSORT_INSERTION_THRESHOLD__SHORT).
+ */
+int TSODLULS_qsort_inlined__short_with_threshold(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_threshold
 ){
   t_TSODLULS_sort_element__short* base_ptr = arr_elements;
   t_TSODLULS_sort_element__short tmp_cell;//for swapping
@@ -292,6 +1810,10 @@ int TSODLULS_qsort_inlined__short(
     return 0;
   }
 
+  if(i_threshold < 1){
+    i_threshold = 1;
+  }
+
   if(i_number_of_elements == 2){
     if(arr_elements[1].i_key < arr_elements[0].i_key){
       tmp_cell = arr_elements[1]; arr_elements[1] = arr_elements[0]; arr_elements[0] = tmp_cell;
@@ -299,7 +1821,7 @@ int TSODLULS_qsort_inlined__short(
     return 0;
   }
 
-  if(i_number_of_elements > 4){
+  if(i_number_of_elements > i_threshold){
     t_TSODLULS_sort_element__short* lo = base_ptr;
     t_TSODLULS_sort_element__short* hi = &lo[(i_number_of_elements - 1)];
     t_TSODLULS_qsort_stack_node__short stack[STACK_SIZE];
@@ -368,8 +1890,8 @@ int TSODLULS_qsort_inlined__short(
          ignore one or both.  Otherwise, push the larger partition's
          bounds on the stack and continue sorting the smaller one. */
 
-      if((size_t)(right_ptr - lo) <= 4){
-        if ((size_t) (hi - left_ptr) <= 4){
+      if((size_t)(right_ptr - lo) <= i_threshold){
+        if ((size_t) (hi - left_ptr) <= i_threshold){
           /* Ignore both small partitions. */
           POP (lo, hi);
         }
@@ -378,7 +1900,7 @@ int TSODLULS_qsort_inlined__short(
           lo = left_ptr;
         }
       }
-      else if ((size_t) (hi - left_ptr) <= 4){
+      else if ((size_t) (hi - left_ptr) <= i_threshold){
         /* Ignore small right partition. */
         hi = right_ptr;
       }
@@ -393,7 +1915,7 @@ int TSODLULS_qsort_inlined__short(
         hi = right_ptr;
       }
     }//end while(STACK_NOT_EMPTY)
-  }//end if(i_number_of_elements > 4)
+  }//end if(i_number_of_elements > i_threshold)
 
   /* Once the BASE_PTR array is partially sorted by quicksort the rest
      is completely sorted using insertion sort, since this is efficient
@@ -406,7 +1928,7 @@ int TSODLULS_qsort_inlined__short(
   {
     t_TSODLULS_sort_element__short* const end_ptr = &base_ptr[(i_number_of_elements - 1)];
     t_TSODLULS_sort_element__short* tmp_ptr = base_ptr;
-    t_TSODLULS_sort_element__short* thresh = min(end_ptr, base_ptr + 4);
+    t_TSODLULS_sort_element__short* thresh = min(end_ptr, base_ptr + i_threshold);
     t_TSODLULS_sort_element__short* run_ptr;
 
     /* Find smallest element in first threshold and place it at the
@@ -448,7 +1970,141 @@ int TSODLULS_qsort_inlined__short(
     }
   }
   return 0;
-}//end function TSODLULS_qsort_inlined__short
+}//end function TSODLULS_qsort_inlined__short_with_threshold
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * The best instruction set for the partitions of TSODLULS_qsort_vectorized__short()
+ * that is both compiled in the library and supported by the CPU.
+ */
+int TSODLULS_get_best_instruction_set(){
+#ifdef TSODLULS_X86_SIMD
+  if(__builtin_cpu_supports("avx512f")){
+    return I_INSTRUCTION_SET__AVX512;
+  }
+  if(__builtin_cpu_supports("avx2")){
+    return I_INSTRUCTION_SET__AVX2;
+  }
+#endif
+  return I_INSTRUCTION_SET__SCALAR;
+}//end function TSODLULS_get_best_instruction_set()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Quicksort with branchless partitions, vectorized with the best instruction set of the CPU
+ * (see TSODLULS_get_best_instruction_set()).
+ * Partitions of at most I_SORT_NETWORK_MAX_SIZE__SHORT elements are sorted by sorting networks.
+ * It is not stable.
+ */
+int TSODLULS_qsort_vectorized__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+){
+  return TSODLULS_qsort_vectorized__short_with_instruction_set(
+    arr_elements,
+    i_number_of_elements,
+    TSODLULS_get_best_instruction_set()
+  );
+}//end function TSODLULS_qsort_vectorized__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_qsort_vectorized__short() with the given instruction set,
+ * it is lowered to TSODLULS_get_best_instruction_set() when the CPU does not support it.
+ * The pivot is the median of 3 keys (of 3 medians of 3 keys for more than 128 elements).
+ * The cells with a key smaller than the pivot go left. When there is none, the pivot is the smallest key
+ * and the cells with a key equal to the pivot are moved left by a second partition, they are then sorted.
+ */
+int TSODLULS_qsort_vectorized__short_with_instruction_set(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  int i_instruction_set
+){
+  t_TSODLULS_sort_element__short* lo = arr_elements;
+  t_TSODLULS_sort_element__short* hi = arr_elements + i_number_of_elements - 1;
+  t_TSODLULS_qsort_stack_node__short stack[STACK_SIZE];
+  t_TSODLULS_qsort_stack_node__short* top = stack;
+  size_t i_number_of_cells = 0;
+  size_t i_step = 0;
+  size_t i_number_left = 0;
+  uint64_t i_pivot = 0;
+  int i_best_instruction_set = TSODLULS_get_best_instruction_set();
+
+  if(i_number_of_elements < 2){
+    return 0;//nothing to sort
+  }
+
+  if(i_instruction_set > i_best_instruction_set){
+    i_instruction_set = i_best_instruction_set;
+  }
+
+#define TSODLULS_partition_cells__short(i_bound) \
+  i_number_left = TSODLULS_partition__short(lo, i_number_of_cells, (i_bound), i_instruction_set)
+
+  PUSH(NULL, NULL);
+
+  while(STACK_NOT_EMPTY){
+    i_number_of_cells = (size_t)(hi - lo) + 1;
+    if(i_number_of_cells <= I_SORT_NETWORK_MAX_SIZE__SHORT){
+      TSODLULS_sort_network_in_place__short(lo, i_number_of_cells);
+      POP(lo, hi);
+      continue;
+    }
+
+    if(i_number_of_cells > 128){
+      i_step = i_number_of_cells / 8;
+      i_pivot = TSODLULS_median_of_3__short(
+        TSODLULS_median_of_3__short(lo[0].i_key, lo[i_step].i_key, lo[2 * i_step].i_key),
+        TSODLULS_median_of_3__short(lo[3 * i_step].i_key, lo[4 * i_step].i_key, lo[5 * i_step].i_key),
+        TSODLULS_median_of_3__short(lo[6 * i_step].i_key, lo[7 * i_step].i_key, lo[i_number_of_cells - 1].i_key)
+      );
+    }
+    else{
+      i_pivot = TSODLULS_median_of_3__short(
+        lo[0].i_key,
+        lo[i_number_of_cells / 2].i_key,
+        lo[i_number_of_cells - 1].i_key
+      );
+    }
+
+    TSODLULS_partition_cells__short(i_pivot);
+
+    if(i_number_left == 0){//the pivot is the smallest key
+      if(i_pivot == UINT64_MAX){
+        POP(lo, hi);//all keys are equal
+        continue;
+      }
+      TSODLULS_partition_cells__short(i_pivot + 1);
+      if(i_number_left == i_number_of_cells){
+        POP(lo, hi);//all keys are equal
+      }
+      else{
+        lo += i_number_left;//the keys equal to the pivot are sorted
+      }
+      continue;
+    }
+
+    //push the larger partition and continue with the smaller one
+    if(i_number_left > i_number_of_cells - i_number_left){
+      PUSH(lo, lo + i_number_left - 1);
+      lo += i_number_left;
+    }
+    else{
+      PUSH(lo + i_number_left, hi);
+      hi = lo + i_number_left - 1;
+    }
+  }//end while(STACK_NOT_EMPTY)
+
+#undef TSODLULS_partition_cells__short
+
+  return 0;
+}//end function TSODLULS_qsort_vectorized__short_with_instruction_set()
 
 
 
@@ -460,20 +2116,47 @@ int TSODLULS_qsort_inlined__short(
  * A variant with single memory allocation adapted to the max-depth.
  * No insertion sort if there is more than 5 elements and it is 8 bits datatype.
  * This is the current best algorithm and it is a stable one :)
+ * (5 is the default value of I_RADIX_INSERTION_THRESHOLD__SHORT.)
+ */
+int TSODLULS_sort_radix8_count_insertion__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+){
+  return TSODLULS_sort_radix8_count_insertion__short_with_threshold(
+    arr_elements,
+    i_number_of_elements,
+    i_max_length,
+    I_RADIX_INSERTION_THRESHOLD__SHORT
+  );
+}//end function TSODLULS_sort_radix8_count_insertion__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * TSODLULS_sort_radix8_count_insertion__short_with_threshold() in buffers given by the caller,
+ * so that they can be shared by many sorts: arr_elements_copy has room for i_number_of_elements cells
+ * and arr_instances for TSODLULS_get_number_of_radix_instances__short() instances.
+ * The buffers are not used when there is at most i_threshold elements.
+ * With b_networks, the buckets of at most i_threshold elements (at most I_SORT_NETWORK_MAX_SIZE__SHORT)
+ * are sorted by sorting networks as soon as they are found, instead of the final insertion sort.
  */
-int TSODLULS_sort_radix8_count_insertion__short(
+static int TSODLULS_sort_radix8_count_insertion__short_in_buffers(
   t_TSODLULS_sort_element__short* arr_elements,
   size_t i_number_of_elements,
-  uint8_t i_max_length
+  uint8_t i_max_length,
+  size_t i_threshold,
+  t_TSODLULS_sort_element__short* arr_elements_copy,
+  t_TSODLULS_radix_instance* arr_instances,
+  unsigned int b_networks
 ){
   int i_number_of_distinct_bytes = 0;
   size_t arr_counts[256];
   size_t arr_offsets[256];
   uint8_t i_current_octet = 0;
   uint64_t i_current_key = 0;
-  t_TSODLULS_sort_element__short* arr_elements_copy = NULL;
   t_TSODLULS_radix_instance current_instance;
-  t_TSODLULS_radix_instance* arr_instances = NULL;
   size_t i_current_instance = 0;
   t_TSODLULS_sort_element__short tmp_cell;
 
@@ -481,7 +2164,15 @@ int TSODLULS_sort_radix8_count_insertion__short(
     return 0;//nothing to sort
   }
 
-  if(i_number_of_elements <= 5){
+  if(i_threshold < 1){
+    i_threshold = 1;
+  }
+
+  if(i_number_of_elements <= i_threshold){
+    if(b_networks){
+      TSODLULS_sort_network_in_place__short(arr_elements, i_number_of_elements);
+      return 0;
+    }
     goto label_insertion_sort;
   }
 
@@ -498,27 +2189,8 @@ int TSODLULS_sort_radix8_count_insertion__short(
   current_instance.i_depth = 0;
   current_instance.b_copy = 0;
 
-  arr_elements_copy = calloc(i_number_of_elements, sizeof(t_TSODLULS_sort_element__short));
-  if(arr_elements_copy == NULL){
-    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
-  }
-
 #define min(x, y) ((x) < (y) ? (x) : (y))
 
-  //This is depth first in a tree of degree 256 and depth at most i_max_length - 1,
-  //so we will not need more that (i_max_length - 1) * 256
-  //We also doesn't need more than i_number_of_elements / 6 because of the use of insertion sort
-  if(i_max_length - 1 > 0){
-    arr_instances = calloc(
-        min((i_max_length - 1) * 256, i_number_of_elements / 6),
-        sizeof(t_TSODLULS_radix_instance)
-    );
-    if(arr_instances == NULL){
-      TSODLULS_free(arr_elements_copy);
-      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
-    }
-  }
-
   while(1){
     //we initialize the counters
     for(int i = 0; i < 256; ++i){
@@ -544,6 +2216,7 @@ int TSODLULS_sort_radix8_count_insertion__short(
         ++arr_counts[i_current_octet];
       }
     }
+    TSODLULS_SORT_STATS_ADD(i_histogram_passes, 1);
     //we deduce the offsets
     i_number_of_distinct_bytes = 0;
     for(int i = 0; i < 255; ++i){
@@ -557,6 +2230,7 @@ int TSODLULS_sort_radix8_count_insertion__short(
     }
 
     if(i_number_of_distinct_bytes == 1){
+      TSODLULS_SORT_STATS_ADD(i_single_byte_skips, 1);
       ++current_instance.i_depth;
       //if we are done sorting this instance and all deeper subinstances
       if(i_max_length <= current_instance.i_depth){
@@ -566,6 +2240,10 @@ int TSODLULS_sort_radix8_count_insertion__short(
             &(arr_elements_copy[current_instance.i_offset_first]),
             (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element__short)
           );
+          TSODLULS_SORT_STATS_ADD(
+            i_bytes_memcpy,
+            (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element__short)
+          );
         }
         if(i_current_instance == 0){
           break;
@@ -584,9 +2262,13 @@ int TSODLULS_sort_radix8_count_insertion__short(
         arr_elements[current_instance.i_offset_first + arr_offsets[i_current_octet]] = arr_elements_copy[i];
         ++arr_offsets[i_current_octet];
       }
+      TSODLULS_SORT_STATS_ADD(
+        i_bytes_scattered,
+        (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element__short)
+      );
       //instances creation
       for(int i = 0; i < 256; ++i){
-        if(arr_counts[i] > 5//nothing to do for at most 5 elements, result is in original array
+        if(arr_counts[i] > i_threshold//nothing to do for at most i_threshold elements, result is in original array
           //for nextified strings this test can be done on only one element
           && i_max_length > current_instance.i_depth + 1
         ){
@@ -597,6 +2279,14 @@ int TSODLULS_sort_radix8_count_insertion__short(
           arr_instances[i_current_instance].i_depth = current_instance.i_depth + 1;
           arr_instances[i_current_instance].b_copy = 0;
           ++i_current_instance;
+          TSODLULS_SORT_STATS_ADD(i_instances_pushed, 1);
+          TSODLULS_SORT_STATS_MAX(i_max_instance_stack_depth, i_current_instance);
+        }
+        else if(b_networks && arr_counts[i] > 1 && i_max_length > current_instance.i_depth + 1){
+          TSODLULS_sort_network_in_place__short(
+            &(arr_elements[current_instance.i_offset_first + arr_offsets[i] - arr_counts[i]]),
+            arr_counts[i]
+          );
         }
       }//end for(int i = 0; i < 256; ++i)
     }
@@ -609,9 +2299,13 @@ int TSODLULS_sort_radix8_count_insertion__short(
         arr_elements_copy[current_instance.i_offset_first + arr_offsets[i_current_octet]] = arr_elements[i];
         ++arr_offsets[i_current_octet];
       }
+      TSODLULS_SORT_STATS_ADD(
+        i_bytes_scattered,
+        (current_instance.i_offset_last - current_instance.i_offset_first + 1) * sizeof(t_TSODLULS_sort_element__short)
+      );
       //instances creation
       for(int i = 0; i < 256; ++i){
-        if(arr_counts[i] > 5
+        if(arr_counts[i] > i_threshold
           //for nextified strings this test can be done on only one element
           && i_max_length > current_instance.i_depth + 1
         ){
@@ -622,6 +2316,8 @@ int TSODLULS_sort_radix8_count_insertion__short(
           arr_instances[i_current_instance].i_depth = current_instance.i_depth + 1;
           arr_instances[i_current_instance].b_copy = 1;
           ++i_current_instance;
+          TSODLULS_SORT_STATS_ADD(i_instances_pushed, 1);
+          TSODLULS_SORT_STATS_MAX(i_max_instance_stack_depth, i_current_instance);
         }
         else if(arr_counts[i] > 0){//we still need to copy data in original array
           memcpy(
@@ -629,6 +2325,13 @@ int TSODLULS_sort_radix8_count_insertion__short(
             &(arr_elements_copy[current_instance.i_offset_first + arr_offsets[i] - arr_counts[i]]),
             arr_counts[i] * sizeof(t_TSODLULS_sort_element__short)
           );
+          TSODLULS_SORT_STATS_ADD(i_bytes_memcpy, arr_counts[i] * sizeof(t_TSODLULS_sort_element__short));
+          if(b_networks && arr_counts[i] > 1 && i_max_length > current_instance.i_depth + 1){
+            TSODLULS_sort_network_in_place__short(
+              &(arr_elements[current_instance.i_offset_first + arr_offsets[i] - arr_counts[i]]),
+              arr_counts[i]
+            );
+          }
         }
       }//end for(int i = 0; i < 256; ++i)
     }
@@ -640,10 +2343,7 @@ int TSODLULS_sort_radix8_count_insertion__short(
     current_instance = arr_instances[--i_current_instance];
   }//end while(true)
 
-  TSODLULS_free(arr_elements_copy);
-  TSODLULS_free(arr_instances);
-
-  if(i_max_length == 1){
+  if(i_max_length == 1 || b_networks){
     return 0;
   }
 
@@ -654,10 +2354,11 @@ int TSODLULS_sort_radix8_count_insertion__short(
      the array (*not* one beyond it!). */
 
   label_insertion_sort:
+  TSODLULS_SORT_STATS_ADD(i_insertion_sorts, 1);
   {
     t_TSODLULS_sort_element__short* const end_ptr = &arr_elements[(i_number_of_elements - 1)];
     t_TSODLULS_sort_element__short* tmp_ptr = arr_elements;
-    t_TSODLULS_sort_element__short* thresh = min(end_ptr, arr_elements + 5);
+    t_TSODLULS_sort_element__short* thresh = min(end_ptr, arr_elements + i_threshold);
     t_TSODLULS_sort_element__short* run_ptr;
 
     /* Find smallest element in first threshold and place it at the
@@ -700,7 +2401,570 @@ int TSODLULS_sort_radix8_count_insertion__short(
   }
 
   return 0;
-}//end function TSODLULS_sort_radix8_count_insertion__short()
+}//end function TSODLULS_sort_radix8_count_insertion__short_in_buffers()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Allocates the buffers of TSODLULS_sort_radix8_count_insertion__short_in_buffers(),
+ * if they are needed, sorts and frees them.
+ */
+static int TSODLULS_sort_radix8_count_insertion__short_with_buffers(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  size_t i_threshold,
+  unsigned int b_networks
+){
+  int i_result = 0;
+  t_TSODLULS_sort_element__short* arr_elements_copy = NULL;
+  t_TSODLULS_radix_instance* arr_instances = NULL;
+  size_t i_number_of_instances = 0;
+
+  if(i_threshold < 1){
+    i_threshold = 1;
+  }
+
+  if(i_number_of_elements > i_threshold && i_max_length > 0 && i_max_length <= 8){
+    arr_elements_copy = calloc(i_number_of_elements, sizeof(t_TSODLULS_sort_element__short));
+    if(arr_elements_copy == NULL){
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    i_number_of_instances = TSODLULS_get_number_of_radix_instances__short(
+        i_number_of_elements,
+        i_max_length,
+        i_threshold
+    );
+    if(i_number_of_instances > 0){
+      arr_instances = calloc(i_number_of_instances, sizeof(t_TSODLULS_radix_instance));
+      if(arr_instances == NULL){
+        TSODLULS_free(arr_elements_copy);
+        return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      }
+    }
+  }
+
+  i_result = TSODLULS_sort_radix8_count_insertion__short_in_buffers(
+      arr_elements,
+      i_number_of_elements,
+      i_max_length,
+      i_threshold,
+      arr_elements_copy,
+      arr_instances,
+      b_networks
+  );
+
+  TSODLULS_free(arr_elements_copy);
+  TSODLULS_free(arr_instances);
+
+  return i_result;
+}//end function TSODLULS_sort_radix8_count_insertion__short_with_buffers()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_radix8_count_insertion__short() but the buckets of at most
+ * i_threshold elements are left to the final insertion sort.
+ */
+int TSODLULS_sort_radix8_count_insertion__short_with_threshold(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  size_t i_threshold
+){
+  return TSODLULS_sort_radix8_count_insertion__short_with_buffers(
+    arr_elements,
+    i_number_of_elements,
+    i_max_length,
+    i_threshold,
+    0
+  );
+}//end function TSODLULS_sort_radix8_count_insertion__short_with_threshold()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Branchless sorting network (compare-exchanges with conditional moves)
+ * for at most I_SORT_NETWORK_MAX_SIZE__SHORT elements.
+ * It is not stable.
+ */
+int TSODLULS_sort_network__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+){
+  if(i_number_of_elements > I_SORT_NETWORK_MAX_SIZE__SHORT){
+    return I_ERROR__TOO_MANY_ELEMENTS_FOR_SORTING_NETWORK;
+  }
+  TSODLULS_sort_network_in_place__short(arr_elements, i_number_of_elements);
+  return 0;
+}//end function TSODLULS_sort_network__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_radix8_count_insertion__short() but the buckets of at most
+ * I_RADIX_NETWORK_THRESHOLD__SHORT elements are sorted by sorting networks
+ * as soon as they are found, there is no final insertion sort.
+ * It is not stable.
+ */
+int TSODLULS_sort_radix8_count_network__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+){
+  return TSODLULS_sort_radix8_count_network__short_with_threshold(
+    arr_elements,
+    i_number_of_elements,
+    i_max_length,
+    I_RADIX_NETWORK_THRESHOLD__SHORT
+  );
+}//end function TSODLULS_sort_radix8_count_network__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_radix8_count_network__short() with the given threshold,
+ * it is clamped to I_SORT_NETWORK_MAX_SIZE__SHORT.
+ */
+int TSODLULS_sort_radix8_count_network__short_with_threshold(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  size_t i_threshold
+){
+  if(i_threshold > I_SORT_NETWORK_MAX_SIZE__SHORT){
+    i_threshold = I_SORT_NETWORK_MAX_SIZE__SHORT;
+  }
+  return TSODLULS_sort_radix8_count_insertion__short_with_buffers(
+    arr_elements,
+    i_number_of_elements,
+    i_max_length,
+    i_threshold,
+    1
+  );
+}//end function TSODLULS_sort_radix8_count_network__short_with_threshold()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Sort independently the segments of the array: the segment i is made of the cells from
+ * arr_segment_offsets[i] included to arr_segment_offsets[i + 1] excluded,
+ * arr_segment_offsets has i_number_of_segments + 1 non-decreasing offsets.
+ * The buffers of the radix sort are allocated once for all the segments,
+ * the segments of at most I_SORT_NETWORK_MAX_SIZE__SHORT elements and the small buckets
+ * are sorted by sorting networks.
+ * It is not stable.
+ */
+int TSODLULS_sort_segmented__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments,
+  uint8_t i_max_length
+){
+  int i_result = 0;
+  size_t i_number_of_elements = 0;
+  size_t i_max_number_of_elements = 0;
+  size_t i_number_of_instances = 0;
+  t_TSODLULS_sort_element__short* arr_elements_copy = NULL;
+  t_TSODLULS_radix_instance* arr_instances = NULL;
+
+  if(i_max_length <= 0){
+    return I_ERROR__MAX_LENGTH_SHOULD_BE_POSITIVE;
+  }
+  if(i_max_length > 8){
+    return I_ERROR__MAX_LENGTH_SHOULD_BE_AT_MOST_8;
+  }
+
+  //the buffers are sized for the biggest segment
+  for(size_t i = 0; i < i_number_of_segments; ++i){
+    if(arr_segment_offsets[i + 1] < arr_segment_offsets[i]){
+      return I_ERROR__SEGMENT_OFFSETS_SHOULD_BE_NON_DECREASING;
+    }
+    i_number_of_elements = arr_segment_offsets[i + 1] - arr_segment_offsets[i];
+    if(i_number_of_elements > i_max_number_of_elements){
+      i_max_number_of_elements = i_number_of_elements;
+    }
+  }
+
+  if(i_max_number_of_elements > I_SORT_NETWORK_MAX_SIZE__SHORT
+    && i_max_number_of_elements > I_SORT_MODEL__INSERTION_THRESHOLD__SHORT
+  ){
+    arr_elements_copy = calloc(i_max_number_of_elements, sizeof(t_TSODLULS_sort_element__short));
+    if(arr_elements_copy == NULL){
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    i_number_of_instances = TSODLULS_get_number_of_radix_instances__short(
+        i_max_number_of_elements,
+        i_max_length,
+        I_RADIX_NETWORK_THRESHOLD__SHORT
+    );
+    if(i_number_of_instances > 0){
+      arr_instances = calloc(i_number_of_instances, sizeof(t_TSODLULS_radix_instance));
+      if(arr_instances == NULL){
+        TSODLULS_free(arr_elements_copy);
+        return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      }
+    }
+  }
+
+  for(size_t i = 0; i < i_number_of_segments && i_result == 0; ++i){
+    i_number_of_elements = arr_segment_offsets[i + 1] - arr_segment_offsets[i];
+    if(i_number_of_elements < 2){
+      continue;
+    }
+    if(i_number_of_elements <= I_SORT_NETWORK_MAX_SIZE__SHORT){
+      i_result = TSODLULS_sort_network__short(&(arr_elements[arr_segment_offsets[i]]), i_number_of_elements);
+    }
+    else if(i_number_of_elements <= I_SORT_MODEL__INSERTION_THRESHOLD__SHORT){
+      i_result = TSODLULS_sort_insertion__short(&(arr_elements[arr_segment_offsets[i]]), i_number_of_elements);
+    }
+    else{
+      i_result = TSODLULS_sort_radix8_count_insertion__short_in_buffers(
+          &(arr_elements[arr_segment_offsets[i]]),
+          i_number_of_elements,
+          i_max_length,
+          I_RADIX_NETWORK_THRESHOLD__SHORT,
+          arr_elements_copy,
+          arr_instances,
+          1
+      );
+    }
+  }
+
+  TSODLULS_free(arr_elements_copy);
+  TSODLULS_free(arr_instances);
+
+  return i_result;
+}//end function TSODLULS_sort_segmented__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_segmented__short() with the segments spread across i_number_of_threads threads
+ * (including the calling thread), each thread sorting consecutive segments with its own buffers.
+ * If a thread cannot be created, its segments are sorted by the calling thread.
+ */
+int TSODLULS_sort_segmented_parallel__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments,
+  uint8_t i_max_length,
+  size_t i_number_of_threads
+){
+  int i_result = 0;
+  size_t i_number_of_tasks = 0;
+  size_t i_first_segment = 0;
+  size_t i_last_segment = 0;
+  size_t i_number_of_elements = 0;
+  size_t i_number_of_elements_per_task = 0;
+  t_TSODLULS_segmented_sort_task* arr_tasks = NULL;
+  pthread_t* arr_threads = NULL;
+  unsigned int* arr_b_started = NULL;
+
+  if(i_number_of_segments == 0){
+    return 0;
+  }
+  for(size_t i = 0; i < i_number_of_segments; ++i){
+    if(arr_segment_offsets[i + 1] < arr_segment_offsets[i]){
+      return I_ERROR__SEGMENT_OFFSETS_SHOULD_BE_NON_DECREASING;
+    }
+  }
+  if(i_number_of_threads > i_number_of_segments){
+    i_number_of_threads = i_number_of_segments;
+  }
+  if(i_number_of_threads <= 1){
+    return TSODLULS_sort_segmented__short(arr_elements, arr_segment_offsets, i_number_of_segments, i_max_length);
+  }
+
+  arr_tasks = calloc(i_number_of_threads, sizeof(t_TSODLULS_segmented_sort_task));
+  arr_threads = calloc(i_number_of_threads, sizeof(pthread_t));
+  arr_b_started = calloc(i_number_of_threads, sizeof(unsigned int));
+  if(arr_tasks == NULL || arr_threads == NULL || arr_b_started == NULL){
+    TSODLULS_free(arr_tasks);
+    TSODLULS_free(arr_threads);
+    TSODLULS_free(arr_b_started);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+
+  //each task gets consecutive segments with about the same number of elements
+  i_number_of_elements = arr_segment_offsets[i_number_of_segments] - arr_segment_offsets[0];
+  i_number_of_elements_per_task = i_number_of_elements / i_number_of_threads + 1;
+  while(i_first_segment < i_number_of_segments){
+    i_last_segment = i_first_segment + 1;
+    if(i_number_of_tasks == i_number_of_threads - 1){
+      i_last_segment = i_number_of_segments;
+    }
+    while(
+      i_last_segment < i_number_of_segments
+      && arr_segment_offsets[i_last_segment] - arr_segment_offsets[i_first_segment] < i_number_of_elements_per_task
+    ){
+      ++i_last_segment;
+    }
+    arr_tasks[i_number_of_tasks].arr_elements = arr_elements;
+    arr_tasks[i_number_of_tasks].arr_segment_offsets = &(arr_segment_offsets[i_first_segment]);
+    arr_tasks[i_number_of_tasks].i_number_of_segments = i_last_segment - i_first_segment;
+    arr_tasks[i_number_of_tasks].i_max_length = i_max_length;
+    ++i_number_of_tasks;
+    i_first_segment = i_last_segment;
+  }
+
+  //the calling thread does the first task
+  for(size_t i = 1; i < i_number_of_tasks; ++i){
+    arr_b_started[i] = pthread_create(
+        &(arr_threads[i]),
+        NULL,
+        TSODLULS_sort_segmented_task__short,
+        &(arr_tasks[i])
+    ) == 0;
+  }
+  TSODLULS_sort_segmented_task__short(&(arr_tasks[0]));
+  for(size_t i = 1; i < i_number_of_tasks; ++i){
+    if(arr_b_started[i]){
+      pthread_join(arr_threads[i], NULL);
+    }
+    else{
+      TSODLULS_sort_segmented_task__short(&(arr_tasks[i]));
+    }
+  }
+  for(size_t i = 0; i < i_number_of_tasks; ++i){
+    if(arr_tasks[i].i_result != 0){
+      i_result = arr_tasks[i].i_result;
+      break;
+    }
+  }
+
+  TSODLULS_free(arr_tasks);
+  TSODLULS_free(arr_threads);
+  TSODLULS_free(arr_b_started);
+
+  return i_result;
+}//end function TSODLULS_sort_segmented_parallel__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * In-place super scalar samplesort (IPS4o of Axtmann, Witt, Ferizovic and Sanders):
+ * the cells are classified with a branchless search tree of up to 127 splitters
+ * chosen in a random sample, and distributed in blocks of I_SAMPLESORT_BLOCK_SIZE__SHORT cells.
+ * A splitter that is a frequent key gets its own equality bucket, that is not sorted again,
+ * hence skewed and low entropy keys are fast.
+ * The memory used does not depend on the number of elements (about 512 KiB of buffers).
+ * The buckets are sorted recursively and the partitions of at most I_SAMPLESORT_BASE_CASE_SIZE cells
+ * are sorted by TSODLULS_qsort_vectorized__short().
+ * It is not stable.
+ */
+int TSODLULS_sort_samplesort__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+){
+  return TSODLULS_sort_samplesort_parallel__short(arr_elements, i_number_of_elements, 1);
+}//end function TSODLULS_sort_samplesort__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_samplesort__short() with i_number_of_threads threads (including the calling thread):
+ * the classification and the permutation of the blocks are done by all the threads,
+ * the buckets of more than 1/i_number_of_threads of the cells are sorted with all the threads,
+ * and the other buckets are shared by the threads, each one sorting the next bucket with its own buffers.
+ * If a thread cannot be created, its work is done by the calling thread.
+ */
+int TSODLULS_sort_samplesort_parallel__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_threads
+){
+  int i_result = 0;
+  t_TSODLULS_samplesort samplesort;
+  size_t i_bucket_size = 0;
+
+  if(i_number_of_elements <= I_SAMPLESORT_BASE_CASE_SIZE){
+    return TSODLULS_qsort_vectorized__short(arr_elements, i_number_of_elements);
+  }
+  //each thread gets at least a base case
+  if(i_number_of_threads > i_number_of_elements / I_SAMPLESORT_BASE_CASE_SIZE){
+    i_number_of_threads = i_number_of_elements / I_SAMPLESORT_BASE_CASE_SIZE;
+  }
+  if(i_number_of_threads == 0){
+    i_number_of_threads = 1;
+  }
+
+  i_result = TSODLULS_samplesort_init__short(&samplesort, i_number_of_threads);
+  if(i_result != 0){
+    return i_result;
+  }
+  if(i_number_of_threads == 1){
+    i_result = TSODLULS_samplesort_sequential__short(&samplesort, arr_elements, i_number_of_elements, 0);
+    TSODLULS_samplesort_free__short(&samplesort);
+    return i_result;
+  }
+
+  TSODLULS_samplesort_partition__short(&samplesort, arr_elements, i_number_of_elements);
+
+  //the big buckets are sorted one after the other with all the threads, the odd buckets contain equal keys
+  for(size_t b = 0; b < samplesort.i_number_of_buckets && i_result == 0; b += 2){
+    i_bucket_size = samplesort.arr_bucket_starts[b + 1] - samplesort.arr_bucket_starts[b];
+    if(i_bucket_size > i_number_of_elements / i_number_of_threads && i_bucket_size < i_number_of_elements){
+      i_result = TSODLULS_sort_samplesort_parallel__short(
+          &(arr_elements[samplesort.arr_bucket_starts[b]]),
+          i_bucket_size,
+          i_number_of_threads
+      );
+    }
+  }
+
+  //the other buckets are shared by the threads
+  if(i_result == 0){
+    samplesort.i_next_bucket = 0;
+    TSODLULS_samplesort_run_threads__short(&samplesort, TSODLULS_samplesort_buckets_task__short);
+    for(size_t t = 0; t < i_number_of_threads; ++t){
+      if(samplesort.arr_threads[t].i_result != 0){
+        i_result = samplesort.arr_threads[t].i_result;
+        break;
+      }
+    }
+  }
+
+  TSODLULS_samplesort_free__short(&samplesort);
+
+  return i_result;
+}//end function TSODLULS_sort_samplesort_parallel__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Begin a time-sliced sort of the cells, that is done by the following calls of TSODLULS_sort_step__short()
+ * with bounded pause times, and without threads, so that a big sort can be interleaved with other work.
+ * It is stable on its own terms: its counting passes keep the order of the cells
+ * and its small buckets are sorted by the stable TSODLULS_sort_insertion__short().
+ * The cells must not be modified until the sort is finished,
+ * and TSODLULS_sort_step_free__short() must be called at the end or to abandon the sort.
+ */
+int TSODLULS_sort_step_begin__short(
+  t_TSODLULS_sort_step_context__short* p_context,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+){
+  size_t i_max_number_of_instances = 0;
+
+  memset(p_context, 0, sizeof(t_TSODLULS_sort_step_context__short));
+  p_context->arr_elements = arr_elements;
+  p_context->i_number_of_elements = i_number_of_elements;
+  p_context->i_max_length = i_max_length;
+  p_context->i_step = I_SORT_STEP__FINISHED;
+
+  if(i_number_of_elements <= I_RADIX_INSERTION_THRESHOLD__SHORT){
+    return TSODLULS_sort_insertion__short(arr_elements, i_number_of_elements);
+  }
+
+  if(i_max_length <= 0){
+    return I_ERROR__MAX_LENGTH_SHOULD_BE_POSITIVE;
+  }
+
+  if(i_max_length > 8){
+    return I_ERROR__MAX_LENGTH_SHOULD_BE_AT_MOST_8;
+  }
+
+  //at most 256 instances per level, the last level has the big buckets to copy back,
+  //and the instances have more than I_RADIX_INSERTION_THRESHOLD__SHORT cells
+  i_max_number_of_instances = ((size_t)i_max_length) * 256;
+  if(i_max_number_of_instances > i_number_of_elements / (I_RADIX_INSERTION_THRESHOLD__SHORT + 1)){
+    i_max_number_of_instances = i_number_of_elements / (I_RADIX_INSERTION_THRESHOLD__SHORT + 1);
+  }
+  p_context->arr_elements_copy = calloc(i_number_of_elements, sizeof(t_TSODLULS_sort_element__short));
+  p_context->arr_instances = calloc(i_max_number_of_instances, sizeof(t_TSODLULS_radix_instance));
+  if(p_context->arr_elements_copy == NULL || p_context->arr_instances == NULL){
+    TSODLULS_sort_step_free__short(p_context);
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+
+  p_context->current_instance.i_offset_first = 0;
+  p_context->current_instance.i_offset_last = i_number_of_elements - 1;
+  p_context->current_instance.i_depth = 0;
+  p_context->current_instance.b_copy = 0;
+  p_context->i_next = 0;
+  p_context->i_step = I_SORT_STEP__COUNT;
+
+  return 0;
+}//end function TSODLULS_sort_step_begin__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Continue a time-sliced sort begun by TSODLULS_sort_step_begin__short() for about i_max_elements cells
+ * processed (counted, moved or copied) or i_max_microseconds, the first reached, 0 meaning no limit.
+ * The budget is checked every I_SORT_STEP_CHUNK_SIZE__SHORT cells, and each call makes some progress.
+ * *p_b_finished is set to 1 when the cells are sorted, the buffers are freed then.
+ */
+int TSODLULS_sort_step__short(
+  t_TSODLULS_sort_step_context__short* p_context,
+  size_t i_max_elements,
+  uint64_t i_max_microseconds,
+  unsigned int* p_b_finished
+){
+  size_t i_processed = 0;
+  size_t i_chunk_size = 0;
+  struct timespec start_time;
+  struct timespec current_time;
+
+  if(i_max_microseconds > 0){
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+  }
+
+  while(p_context->i_step != I_SORT_STEP__FINISHED){
+    i_chunk_size = I_SORT_STEP_CHUNK_SIZE__SHORT;
+    if(i_max_elements > 0){
+      if(i_processed >= i_max_elements){
+        break;
+      }
+      if(i_chunk_size > i_max_elements - i_processed){
+        i_chunk_size = i_max_elements - i_processed;
+      }
+    }
+    i_processed += TSODLULS_sort_step_chunk__short(p_context, i_chunk_size);
+    if(i_max_microseconds > 0){
+      clock_gettime(CLOCK_MONOTONIC, &current_time);
+      if(
+        (uint64_t)(current_time.tv_sec - start_time.tv_sec) * 1000000
+        + (uint64_t)(current_time.tv_nsec / 1000) - (uint64_t)(start_time.tv_nsec / 1000)
+        >= i_max_microseconds
+      ){
+        break;
+      }
+    }
+  }
+
+  *p_b_finished = p_context->i_step == I_SORT_STEP__FINISHED;
+  if(*p_b_finished){
+    TSODLULS_sort_step_free__short(p_context);
+  }
+
+  return 0;
+}//end function TSODLULS_sort_step__short()
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Free the buffers of a time-sliced sort, finished or not.
+ */
+void TSODLULS_sort_step_free__short(t_TSODLULS_sort_step_context__short* p_context){
+  TSODLULS_free(p_context->arr_elements_copy);
+  TSODLULS_free(p_context->arr_instances);
+  p_context->i_step = I_SORT_STEP__FINISHED;
+}//end function TSODLULS_sort_step_free__short()
 
 
 
@@ -46,6 +46,46 @@ int TSODLULS_sort_stable__short(
 
 
 
+/**
+ * Sorting functions for short nextified strings
+ * Choose the algorithm with the lowest cost for these elements according to the cost model
+ * (see t_TSODLULS_sort_model).
+ * Returns I_SORT_ALGORITHM__INSERTION, I_SORT_ALGORITHM__COMPARISON or I_SORT_ALGORITHM__RADIX.
+ */
+int TSODLULS_choose_sort_algorithm__short(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Sort with the algorithm chosen by TSODLULS_choose_sort_algorithm__short().
+ * It is not stable since the comparison model uses quicksort.
+ */
+int TSODLULS_sort_with_model__short(
+  const t_TSODLULS_sort_model* p_model,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * A stable insertion sort for a small number of elements
+ */
+int TSODLULS_sort_insertion__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
 /**
  * Sorting functions for short nextified strings
  * A stable sorting algorithm for nextified strings based on radix sort with octets digits
@@ -70,6 +110,58 @@ int TSODLULS_qsort_inlined__short(
 
 
 
+/**
+ * Sorting functions for short nextified strings
+ * Qsort from glibc inlined with short cells.
+ * Partitions of at most i_threshold + 1 elements are left to the final insertion sort
+ * (MAX_THRESH in glibc, see I_QSORT_INSERTION_THRESHOLD__SHORT).
+ */
+int TSODLULS_qsort_inlined__short_with_threshold(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_threshold
+);
+
+
+/**
+ * Sorting functions for short nextified strings
+ * The best instruction set for the partitions of TSODLULS_qsort_vectorized__short()
+ * that is both compiled in the library and supported by the CPU.
+ */
+int TSODLULS_get_best_instruction_set();
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Quicksort with branchless partitions, vectorized with the best instruction set of the CPU
+ * (see TSODLULS_get_best_instruction_set()).
+ * Partitions of at most I_SORT_NETWORK_MAX_SIZE__SHORT elements are sorted by sorting networks.
+ * It is not stable.
+ */
+int TSODLULS_qsort_vectorized__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_qsort_vectorized__short() with the given instruction set,
+ * it is lowered to TSODLULS_get_best_instruction_set() when the CPU does not support it.
+ * The pivot is the median of 3 keys (of 3 medians of 3 keys for more than 128 elements).
+ * The cells with a key smaller than the pivot go left. When there is none, the pivot is the smallest key
+ * and the cells with a key equal to the pivot are moved left by a second partition, they are then sorted.
+ */
+int TSODLULS_qsort_vectorized__short_with_instruction_set(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  int i_instruction_set
+);
+
+
+
 /**
  * Sorting functions for short nextified strings
  * A stable sorting algorithm for nextified strings based on radix sort with octets digits
@@ -78,6 +170,7 @@ int TSODLULS_qsort_inlined__short(
  * A variant with single memory allocation adapted to the max-depth.
  * No insertion sort if there is more than 5 elements and it is 8 bits datatype.
  * This is the current best algorithm and it is a stable one :)
+ * (5 is the default value of I_RADIX_INSERTION_THRESHOLD__SHORT.)
  */
 int TSODLULS_sort_radix8_count_insertion__short(
   t_TSODLULS_sort_element__short* arr_elements,
@@ -87,3 +180,170 @@ int TSODLULS_sort_radix8_count_insertion__short(
 
 
 
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_radix8_count_insertion__short() but the buckets of at most
+ * i_threshold elements are left to the final insertion sort.
+ */
+int TSODLULS_sort_radix8_count_insertion__short_with_threshold(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  size_t i_threshold
+);
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Branchless sorting network (compare-exchanges with conditional moves)
+ * for at most I_SORT_NETWORK_MAX_SIZE__SHORT elements.
+ * It is not stable.
+ */
+int TSODLULS_sort_network__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_radix8_count_insertion__short() but the buckets of at most
+ * I_RADIX_NETWORK_THRESHOLD__SHORT elements are sorted by sorting networks
+ * as soon as they are found, there is no final insertion sort.
+ * It is not stable.
+ */
+int TSODLULS_sort_radix8_count_network__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_radix8_count_network__short() with the given threshold,
+ * it is clamped to I_SORT_NETWORK_MAX_SIZE__SHORT.
+ */
+int TSODLULS_sort_radix8_count_network__short_with_threshold(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  size_t i_threshold
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Sort independently the segments of the array: the segment i is made of the cells from
+ * arr_segment_offsets[i] included to arr_segment_offsets[i + 1] excluded,
+ * arr_segment_offsets has i_number_of_segments + 1 non-decreasing offsets.
+ * The buffers of the radix sort are allocated once for all the segments,
+ * the segments of at most I_SORT_NETWORK_MAX_SIZE__SHORT elements and the small buckets
+ * are sorted by sorting networks.
+ * It is not stable.
+ */
+int TSODLULS_sort_segmented__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_segmented__short() with the segments spread across i_number_of_threads threads
+ * (including the calling thread), each thread sorting consecutive segments with its own buffers.
+ * If a thread cannot be created, its segments are sorted by the calling thread.
+ */
+int TSODLULS_sort_segmented_parallel__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  const size_t* arr_segment_offsets,
+  size_t i_number_of_segments,
+  uint8_t i_max_length,
+  size_t i_number_of_threads
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * In-place super scalar samplesort (IPS4o of Axtmann, Witt, Ferizovic and Sanders):
+ * the cells are classified with a branchless search tree of up to 127 splitters
+ * chosen in a random sample, and distributed in blocks of I_SAMPLESORT_BLOCK_SIZE__SHORT cells.
+ * A splitter that is a frequent key gets its own equality bucket, that is not sorted again,
+ * hence skewed and low entropy keys are fast.
+ * The memory used does not depend on the number of elements (about 512 KiB of buffers).
+ * The buckets are sorted recursively and the partitions of at most I_SAMPLESORT_BASE_CASE_SIZE cells
+ * are sorted by TSODLULS_qsort_vectorized__short().
+ * It is not stable.
+ */
+int TSODLULS_sort_samplesort__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Same as TSODLULS_sort_samplesort__short() with i_number_of_threads threads (including the calling thread):
+ * the classification and the permutation of the blocks are done by all the threads,
+ * the buckets of more than 1/i_number_of_threads of the cells are sorted with all the threads,
+ * and the other buckets are shared by the threads, each one sorting the next bucket with its own buffers.
+ * If a thread cannot be created, its work is done by the calling thread.
+ */
+int TSODLULS_sort_samplesort_parallel__short(
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  size_t i_number_of_threads
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Begin a time-sliced sort of the cells, that is done by the following calls of TSODLULS_sort_step__short()
+ * with bounded pause times, and without threads, so that a big sort can be interleaved with other work.
+ * It is stable on its own terms: its counting passes keep the order of the cells
+ * and its small buckets are sorted by the stable TSODLULS_sort_insertion__short().
+ * The cells must not be modified until the sort is finished,
+ * and TSODLULS_sort_step_free__short() must be called at the end or to abandon the sort.
+ */
+int TSODLULS_sort_step_begin__short(
+  t_TSODLULS_sort_step_context__short* p_context,
+  t_TSODLULS_sort_element__short* arr_elements,
+  size_t i_number_of_elements,
+  uint8_t i_max_length
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Continue a time-sliced sort begun by TSODLULS_sort_step_begin__short() for about i_max_elements cells
+ * processed (counted, moved or copied) or i_max_microseconds, the first reached, 0 meaning no limit.
+ * The budget is checked every I_SORT_STEP_CHUNK_SIZE__SHORT cells, and each call makes some progress.
+ * *p_b_finished is set to 1 when the cells are sorted, the buffers are freed then.
+ */
+int TSODLULS_sort_step__short(
+  t_TSODLULS_sort_step_context__short* p_context,
+  size_t i_max_elements,
+  uint64_t i_max_microseconds,
+  unsigned int* p_b_finished
+);
+
+
+
+/**
+ * Sorting functions for short nextified strings
+ * Free the buffers of a time-sliced sort, finished or not.
+ */
+void TSODLULS_sort_step_free__short(t_TSODLULS_sort_step_context__short* p_context);
+
+
+
@@ -0,0 +1,1646 @@
+/*
+This file is part of TSODLULS library.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+
+#include "TSODLULS.h"
+#include <ctype.h>
+#include <inttypes.h>
+
+
+
+//------------------------------------------------------------------------------------
+//Internal functions
+//------------------------------------------------------------------------------------
+/**
+ * TSODL functions
+ * Skip blanks and comments
+ */
+static void TSODLULS_tsodl_skip_blanks(const char* s_tsod, size_t* p_i_offset){
+  size_t i = *p_i_offset;
+  while(1){
+    if(isspace((unsigned char)s_tsod[i])){
+      ++i;
+      continue;
+    }
+    if(s_tsod[i] == '/' && s_tsod[i + 1] == '/'){
+      while(s_tsod[i] != '\0' && s_tsod[i] != '\n'){
+        ++i;
+      }
+      continue;
+    }
+    if(s_tsod[i] == '/' && s_tsod[i + 1] == '*'){
+      i += 2;
+      while(s_tsod[i] != '\0' && !(s_tsod[i] == '*' && s_tsod[i + 1] == '/')){
+        ++i;
+      }
+      if(s_tsod[i] != '\0'){
+        i += 2;
+      }
+      continue;
+    }
+    break;
+  }
+  *p_i_offset = i;
+}//end function TSODLULS_tsodl_skip_blanks()
+
+
+
+/**
+ * TSODL functions
+ * Read an identifier (or a keyword) after the blanks, and return its length (0 if there is none)
+ */
+static size_t TSODLULS_tsodl_read_identifier(const char* s_tsod, size_t* p_i_offset, size_t* p_i_start){
+  size_t i;
+  TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+  i = *p_i_offset;
+  *p_i_start = i;
+  if(!(isalpha((unsigned char)s_tsod[i]) || s_tsod[i] == '_')){
+    return 0;
+  }
+  while(isalnum((unsigned char)s_tsod[i]) || s_tsod[i] == '_'){
+    ++i;
+  }
+  *p_i_offset = i;
+  return i - *p_i_start;
+}//end function TSODLULS_tsodl_read_identifier()
+
+
+
+/**
+ * TSODL functions
+ * Tell if the identifier at s_identifier of length i_length is the keyword s_keyword
+ */
+static int TSODLULS_tsodl_is_keyword(const char* s_identifier, size_t i_length, const char* s_keyword){
+  return strlen(s_keyword) == i_length && strncmp(s_identifier, s_keyword, i_length) == 0;
+}//end function TSODLULS_tsodl_is_keyword()
+
+
+
+/**
+ * TSODL functions
+ * Read the character c after the blanks
+ */
+static int TSODLULS_tsodl_expect_character(const char* s_tsod, size_t* p_i_offset, char c){
+  TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+  if(s_tsod[*p_i_offset] != c){
+    return I_ERROR__TSODL_SYNTAX_ERROR;
+  }
+  ++(*p_i_offset);
+  return 0;
+}//end function TSODLULS_tsodl_expect_character()
+
+
+
+/**
+ * TSODL functions
+ * Read a decimal integer (with an optional sign) after the blanks
+ */
+static int TSODLULS_tsodl_read_integer(const char* s_tsod, size_t* p_i_offset, int64_t* p_i_value){
+  char* s_end = NULL;
+  TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+  if(!(isdigit((unsigned char)s_tsod[*p_i_offset])
+    || ((s_tsod[*p_i_offset] == '-' || s_tsod[*p_i_offset] == '+') && isdigit((unsigned char)s_tsod[*p_i_offset + 1]))
+  )){
+    return I_ERROR__TSODL_SYNTAX_ERROR;
+  }
+  errno = 0;
+  *p_i_value = strtoll(s_tsod + *p_i_offset, &s_end, 10);
+  if(errno != 0){
+    return I_ERROR__TSODL_INVALID_RANGE;
+  }
+  *p_i_offset = s_end - s_tsod;
+  return 0;
+}//end function TSODLULS_tsodl_read_integer()
+
+
+
+/**
+ * TSODL functions
+ * Read an expression "[*]CURRENT(.field|->field)*" and store it normalized (without blanks)
+ */
+static int TSODLULS_tsodl_read_expression(const char* s_tsod, size_t* p_i_offset, char** p_s_expression){
+  size_t i_start = 0;
+  size_t i_length = 0;
+  size_t i_number_of_stars = 0;
+  size_t i_expression_length = 0;
+  size_t i_save = 0;
+  char* s_expression = NULL;
+
+  //first pass: validation and length
+  TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+  i_save = *p_i_offset;
+  while(s_tsod[*p_i_offset] == '*'){
+    ++i_number_of_stars;
+    ++(*p_i_offset);
+    TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+  }
+  i_length = TSODLULS_tsodl_read_identifier(s_tsod, p_i_offset, &i_start);
+  if(!TSODLULS_tsodl_is_keyword(s_tsod + i_start, i_length, "CURRENT")){
+    *p_i_offset = i_start;
+    return I_ERROR__TSODL_SYNTAX_ERROR;
+  }
+  i_expression_length = i_number_of_stars + i_length;
+  while(1){
+    TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+    if(s_tsod[*p_i_offset] == '.'){
+      ++(*p_i_offset);
+      i_expression_length += 1;
+    }
+    else if(s_tsod[*p_i_offset] == '-' && s_tsod[*p_i_offset + 1] == '>'){
+      *p_i_offset += 2;
+      i_expression_length += 2;
+    }
+    else{
+      break;
+    }
+    i_length = TSODLULS_tsodl_read_identifier(s_tsod, p_i_offset, &i_start);
+    if(i_length == 0){
+      return I_ERROR__TSODL_SYNTAX_ERROR;
+    }
+    i_expression_length += i_length;
+  }
+
+  //second pass: copy without blanks
+  s_expression = calloc(i_expression_length + 1, sizeof(char));
+  if(s_expression == NULL){
+    return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+  }
+  *p_i_offset = i_save;
+  i_expression_length = 0;
+  while(s_tsod[*p_i_offset] == '*'){
+    s_expression[i_expression_length++] = '*';
+    ++(*p_i_offset);
+    TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+  }
+  i_length = TSODLULS_tsodl_read_identifier(s_tsod, p_i_offset, &i_start);
+  memcpy(s_expression + i_expression_length, s_tsod + i_start, i_length);
+  i_expression_length += i_length;
+  while(1){
+    TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+    if(s_tsod[*p_i_offset] == '.'){
+      ++(*p_i_offset);
+      s_expression[i_expression_length++] = '.';
+    }
+    else if(s_tsod[*p_i_offset] == '-' && s_tsod[*p_i_offset + 1] == '>'){
+      *p_i_offset += 2;
+      s_expression[i_expression_length++] = '-';
+      s_expression[i_expression_length++] = '>';
+    }
+    else{
+      break;
+    }
+    i_length = TSODLULS_tsodl_read_identifier(s_tsod, p_i_offset, &i_start);
+    memcpy(s_expression + i_expression_length, s_tsod + i_start, i_length);
+    i_expression_length += i_length;
+  }
+  *p_s_expression = s_expression;
+  return 0;
+}//end function TSODLULS_tsodl_read_expression()
+
+
+
+/**
+ * TSODL functions
+ * Get the type of a numeric type keyword (0 if it is not a numeric type keyword)
+ */
+static int TSODLULS_tsodl_get_numeric_type(const char* s_identifier, size_t i_length){
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "UINT8")){ return I_TSODL_TYPE__UINT8; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "UINT16")){ return I_TSODL_TYPE__UINT16; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "UINT32")){ return I_TSODL_TYPE__UINT32; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "UINT64")){ return I_TSODL_TYPE__UINT64; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "SIZE_T")){ return I_TSODL_TYPE__UINT64; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "INT8")){ return I_TSODL_TYPE__INT8; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "INT16")){ return I_TSODL_TYPE__INT16; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "INT32")){ return I_TSODL_TYPE__INT32; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "INT")){ return I_TSODL_TYPE__INT32; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "INT64")){ return I_TSODL_TYPE__INT64; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "FLOAT")){ return I_TSODL_TYPE__FLOAT; }
+  if(TSODLULS_tsodl_is_keyword(s_identifier, i_length, "DOUBLE")){ return I_TSODL_TYPE__DOUBLE; }
+  return 0;
+}//end function TSODLULS_tsodl_get_numeric_type()
+
+
+
+/**
+ * TSODL functions
+ * Size in bytes of a numeric type
+ */
+static size_t TSODLULS_tsodl_get_numeric_type_size(int i_type){
+  switch(i_type){
+    case I_TSODL_TYPE__UINT8:
+    case I_TSODL_TYPE__INT8:
+      return 1;
+    case I_TSODL_TYPE__UINT16:
+    case I_TSODL_TYPE__INT16:
+      return 2;
+    case I_TSODL_TYPE__UINT32:
+    case I_TSODL_TYPE__INT32:
+    case I_TSODL_TYPE__FLOAT:
+      return 4;
+    default:
+      return 8;
+  }
+}//end function TSODLULS_tsodl_get_numeric_type_size()
+
+
+
+/**
+ * TSODL functions
+ * Tell if the keyword is an order-operator or an iterator that is not supported yet
+ */
+static int TSODLULS_tsodl_is_unsupported_keyword(const char* s_identifier, size_t i_length){
+  return TSODLULS_tsodl_is_keyword(s_identifier, i_length, "HIERARCHIC")
+    || TSODLULS_tsodl_is_keyword(s_identifier, i_length, "CONTRELEXICOGRAPHIC")
+    || TSODLULS_tsodl_is_keyword(s_identifier, i_length, "CONTREHIERARCHIC")
+    || TSODLULS_tsodl_is_keyword(s_identifier, i_length, "ARRAY_ITERATOR")
+    || TSODLULS_tsodl_is_keyword(s_identifier, i_length, "POINTER_ITERATOR")
+    || TSODLULS_tsodl_is_keyword(s_identifier, i_length, "COLLATION");
+}//end function TSODLULS_tsodl_is_unsupported_keyword()
+
+
+
+/**
+ * TSODL functions
+ * Parse a field "[*]CURRENT(.field|->field)* TYPE [RANGE(min, max)] [ASC|DESC]"
+ */
+static int TSODLULS_tsodl_parse_field(
+  const char* s_tsod,
+  size_t* p_i_offset,
+  t_TSODLULS_tsodl_field* p_field
+){
+  int i_result = 0;
+  size_t i_start = 0;
+  size_t i_length = 0;
+  size_t i_save = 0;
+  int64_t i_value = 0;
+  uint64_t i_range_width = 0;
+
+  i_result = TSODLULS_tsodl_read_expression(s_tsod, p_i_offset, &(p_field->s_expression));
+  if(i_result != 0){
+    return i_result;
+  }
+
+  //type
+  i_length = TSODLULS_tsodl_read_identifier(s_tsod, p_i_offset, &i_start);
+  if(i_length == 0){
+    return I_ERROR__TSODL_SYNTAX_ERROR;
+  }
+  p_field->i_type = TSODLULS_tsodl_get_numeric_type(s_tsod + i_start, i_length);
+  if(p_field->i_type != 0){
+    p_field->i_key_size = TSODLULS_tsodl_get_numeric_type_size(p_field->i_type);
+  }
+  else if(TSODLULS_tsodl_is_keyword(s_tsod + i_start, i_length, "CHAR")){
+    p_field->i_type = I_TSODL_TYPE__CHAR;
+    i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, '(');
+    if(i_result != 0){
+      return i_result;
+    }
+    i_start = *p_i_offset;
+    i_result = TSODLULS_tsodl_read_integer(s_tsod, p_i_offset, &i_value);
+    if(i_result != 0){
+      return i_result;
+    }
+    if(i_value < 1){
+      *p_i_offset = i_start;
+      return I_ERROR__TSODL_INVALID_LENGTH;
+    }
+    p_field->i_char_length = (size_t)i_value;
+    p_field->i_key_size = (size_t)i_value;
+    i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, ')');
+    if(i_result != 0){
+      return i_result;
+    }
+  }
+  else if(TSODLULS_tsodl_is_keyword(s_tsod + i_start, i_length, "VARCHAR")){
+    i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, '(');
+    if(i_result != 0){
+      return i_result;
+    }
+    i_save = *p_i_offset;
+    i_length = TSODLULS_tsodl_read_identifier(s_tsod, p_i_offset, &i_start);
+    if(TSODLULS_tsodl_is_keyword(s_tsod + i_start, i_length, "NULL")){
+      p_field->i_type = I_TSODL_TYPE__VARCHAR_NULL;
+      p_field->i_terminator = 0;
+      TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+      if(s_tsod[*p_i_offset] == '('){
+        ++(*p_i_offset);
+        i_start = *p_i_offset;
+        i_result = TSODLULS_tsodl_read_integer(s_tsod, p_i_offset, &i_value);
+        if(i_result != 0){
+          return i_result;
+        }
+        if(i_value < 0 || i_value > 255){
+          *p_i_offset = i_start;
+          return I_ERROR__TSODL_INVALID_RANGE;
+        }
+        p_field->i_terminator = (uint8_t)i_value;
+        i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, ')');
+        if(i_result != 0){
+          return i_result;
+        }
+      }
+    }
+    else{
+      *p_i_offset = i_save;
+      p_field->i_type = I_TSODL_TYPE__VARCHAR_LENGTH;
+      i_result = TSODLULS_tsodl_read_expression(s_tsod, p_i_offset, &(p_field->s_length_expression));
+      if(i_result != 0){
+        return i_result;
+      }
+      i_length = TSODLULS_tsodl_read_identifier(s_tsod, p_i_offset, &i_start);
+      p_field->i_length_type = TSODLULS_tsodl_get_numeric_type(s_tsod + i_start, i_length);
+      if(p_field->i_length_type == 0
+        || p_field->i_length_type == I_TSODL_TYPE__FLOAT
+        || p_field->i_length_type == I_TSODL_TYPE__DOUBLE
+      ){
+        *p_i_offset = i_start;
+        return I_ERROR__TSODL_UNKNOWN_TYPE;
+      }
+    }
+    i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, ')');
+    if(i_result != 0){
+      return i_result;
+    }
+    p_field->i_key_size = 0;
+  }
+  else{
+    *p_i_offset = i_start;
+    return I_ERROR__TSODL_UNKNOWN_TYPE;
+  }
+
+  //modifiers
+  while(1){
+    i_save = *p_i_offset;
+    i_length = TSODLULS_tsodl_read_identifier(s_tsod, p_i_offset, &i_start);
+    if(i_length == 0){
+      break;
+    }
+    if(TSODLULS_tsodl_is_keyword(s_tsod + i_start, i_length, "ASC")){
+      p_field->b_descending = 0;
+    }
+    else if(TSODLULS_tsodl_is_keyword(s_tsod + i_start, i_length, "DESC")){
+      p_field->b_descending = 1;
+    }
+    else if(TSODLULS_tsodl_is_keyword(s_tsod + i_start, i_length, "RANGE")){
+      if(p_field->i_type > I_TSODL_TYPE__INT64){
+        *p_i_offset = i_start;
+        return I_ERROR__TSODL_INVALID_RANGE;
+      }
+      i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, '(');
+      if(i_result != 0){
+        return i_result;
+      }
+      i_result = TSODLULS_tsodl_read_integer(s_tsod, p_i_offset, &(p_field->i_range_min));
+      if(i_result != 0){
+        return i_result;
+      }
+      i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, ',');
+      if(i_result != 0){
+        return i_result;
+      }
+      i_result = TSODLULS_tsodl_read_integer(s_tsod, p_i_offset, &(p_field->i_range_max));
+      if(i_result != 0){
+        return i_result;
+      }
+      i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, ')');
+      if(i_result != 0){
+        return i_result;
+      }
+      if(p_field->i_range_max < p_field->i_range_min){
+        *p_i_offset = i_start;
+        return I_ERROR__TSODL_INVALID_RANGE;
+      }
+      p_field->b_range = 1;
+      //only the bytes needed for max - min are kept
+      i_range_width = ((uint64_t)p_field->i_range_max) - ((uint64_t)p_field->i_range_min);
+      p_field->i_key_size = 0;
+      while(i_range_width > 0){
+        ++(p_field->i_key_size);
+        i_range_width = i_range_width >> 8;
+      }
+    }
+    else if(TSODLULS_tsodl_is_unsupported_keyword(s_tsod + i_start, i_length)){
+      *p_i_offset = i_start;
+      return I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT;
+    }
+    else{
+      *p_i_offset = i_save;
+      break;
+    }
+  }
+  return 0;
+}//end function TSODLULS_tsodl_parse_field()
+
+
+
+/**
+ * TSODL functions
+ * Parse an order: NEXT(order, order, ...), LEXICOGRAPHIC(string field) or a field
+ */
+static int TSODLULS_tsodl_parse_order(
+  t_TSODLULS_tsodl_order* p_order,
+  const char* s_tsod,
+  size_t* p_i_offset
+){
+  int i_result = 0;
+  size_t i_start = 0;
+  size_t i_length = 0;
+  size_t i_save = 0;
+  unsigned int b_lexicographic = 0;
+  void* p_for_realloc = NULL;
+  t_TSODLULS_tsodl_field* p_field = NULL;
+
+  i_save = *p_i_offset;
+  i_length = TSODLULS_tsodl_read_identifier(s_tsod, p_i_offset, &i_start);
+  if(TSODLULS_tsodl_is_keyword(s_tsod + i_start, i_length, "NEXT")){
+    i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, '(');
+    if(i_result != 0){
+      return i_result;
+    }
+    do{
+      i_result = TSODLULS_tsodl_parse_order(p_order, s_tsod, p_i_offset);
+      if(i_result != 0){
+        return i_result;
+      }
+      TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+      if(s_tsod[*p_i_offset] != ','){
+        break;
+      }
+      ++(*p_i_offset);
+      TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+    }
+    while(s_tsod[*p_i_offset] != ')');//trailing comma
+    return TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, ')');
+  }
+  if(TSODLULS_tsodl_is_keyword(s_tsod + i_start, i_length, "LEXICOGRAPHIC")){
+    i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, '(');
+    if(i_result != 0){
+      return i_result;
+    }
+    //only the characters of a string field are supported as subelements, not the lists of suborders
+    TSODLULS_tsodl_skip_blanks(s_tsod, p_i_offset);
+    if(s_tsod[*p_i_offset] == '['){
+      return I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT;
+    }
+    b_lexicographic = 1;
+    i_save = *p_i_offset;
+  }
+  else if(TSODLULS_tsodl_is_unsupported_keyword(s_tsod + i_start, i_length)){
+    *p_i_offset = i_start;
+    return I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT;
+  }
+
+  *p_i_offset = i_save;
+  if(p_order->i_number_of_fields == p_order->i_allocated_number_of_fields){
+    p_for_realloc = realloc(
+        p_order->arr_fields,
+        2 * (p_order->i_allocated_number_of_fields + 1) * sizeof(t_TSODLULS_tsodl_field)
+    );
+    if(p_for_realloc == NULL){
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    p_order->arr_fields = (t_TSODLULS_tsodl_field*) p_for_realloc;
+    p_order->i_allocated_number_of_fields = 2 * (p_order->i_allocated_number_of_fields + 1);
+  }
+  p_field = &(p_order->arr_fields[p_order->i_number_of_fields++]);
+  memset(p_field, 0, sizeof(t_TSODLULS_tsodl_field));
+  i_result = TSODLULS_tsodl_parse_field(s_tsod, p_i_offset, p_field);
+  if(i_result != 0){
+    return i_result;
+  }
+  if(b_lexicographic){
+    if(p_field->i_type < I_TSODL_TYPE__CHAR){
+      *p_i_offset = i_save;
+      return I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT;
+    }
+    p_field->b_lexicographic = 1;
+    i_result = TSODLULS_tsodl_expect_character(s_tsod, p_i_offset, ')');
+    if(i_result != 0){
+      return i_result;
+    }
+  }
+  if(p_field->i_key_size == 0 && p_field->i_type >= I_TSODL_TYPE__VARCHAR_NULL){
+    p_order->b_variable_key_size = 1;
+  }
+  p_order->i_fixed_key_size += p_field->i_key_size;
+  return 0;
+}//end function TSODLULS_tsodl_parse_order()
+
+
+
+/**
+ * TSODL functions
+ * Write the normalized TSODL text of a field
+ */
+static void TSODLULS_tsodl_write_field(FILE* p_file, const t_TSODLULS_tsodl_field* p_field){
+  const char* arr_s_type_names[] = {
+    "", "UINT8", "UINT16", "UINT32", "UINT64", "INT8", "INT16", "INT32", "INT64", "FLOAT", "DOUBLE"
+  };
+  if(p_field->b_lexicographic){
+    fprintf(p_file, "LEXICOGRAPHIC(");
+  }
+  fprintf(p_file, "%s ", p_field->s_expression);
+  switch(p_field->i_type){
+    case I_TSODL_TYPE__CHAR:
+      fprintf(p_file, "CHAR(%zu)", p_field->i_char_length);
+      break;
+    case I_TSODL_TYPE__VARCHAR_NULL:
+      fprintf(p_file, "VARCHAR(NULL(%u))", (unsigned int)p_field->i_terminator);
+      break;
+    case I_TSODL_TYPE__VARCHAR_LENGTH:
+      fprintf(p_file, "VARCHAR(%s %s)", p_field->s_length_expression, arr_s_type_names[p_field->i_length_type]);
+      break;
+    default:
+      fprintf(p_file, "%s", arr_s_type_names[p_field->i_type]);
+  }
+  if(p_field->b_range){
+    fprintf(p_file, " RANGE(%" PRId64 ", %" PRId64 ")", p_field->i_range_min, p_field->i_range_max);
+  }
+  fprintf(p_file, p_field->b_descending ? " DESC" : " ASC");
+  if(p_field->b_lexicographic){
+    fprintf(p_file, ")");
+  }
+}//end function TSODLULS_tsodl_write_field()
+
+
+
+/**
+ * TSODL functions
+ * Write a TSODL expression as a C expression on p_current
+ */
+static void TSODLULS_tsodl_write_c_expression(FILE* p_file, const char* s_expression){
+  size_t i = 0;
+  while(s_expression[i] == '*'){
+    fputc('*', p_file);
+    ++i;
+  }
+  //the normalized expression has exactly one CURRENT after the stars
+  fprintf(p_file, "(*p_current)%s", s_expression + i + strlen("CURRENT"));
+}//end function TSODLULS_tsodl_write_c_expression()
+
+
+
+/**
+ * TSODL functions
+ * Write the C code computing the numeric value of a field in ui64 (including RANGE and DESC)
+ */
+static void TSODLULS_tsodl_write_numeric_value(FILE* p_file, const t_TSODLULS_tsodl_field* p_field){
+  const char* arr_s_c_types[] = {
+    "", "uint8_t", "uint16_t", "uint32_t", "uint64_t", "int8_t", "int16_t", "int32_t", "int64_t", "float", "double"
+  };
+  fprintf(p_file, "  ui64 = ");
+  if(p_field->b_range){
+    if(p_field->i_type >= I_TSODL_TYPE__INT8){
+      fprintf(p_file, "(uint64_t)(int64_t)(");
+    }
+    else{
+      fprintf(p_file, "(uint64_t)(");
+    }
+    TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+    fprintf(p_file, ") - (uint64_t)INT64_C(%" PRId64 ");\n", p_field->i_range_min);
+  }
+  else{
+    switch(p_field->i_type){
+      case I_TSODL_TYPE__INT8:
+      case I_TSODL_TYPE__INT16:
+      case I_TSODL_TYPE__INT32:
+      case I_TSODL_TYPE__INT64:
+        fprintf(
+            p_file,
+            "TSODLULS_get_uint%zu_from_int%zu((%s)(",
+            8 * p_field->i_key_size,
+            8 * p_field->i_key_size,
+            arr_s_c_types[p_field->i_type]
+        );
+        break;
+      case I_TSODL_TYPE__FLOAT:
+        fprintf(p_file, "TSODLULS_get_uint_from_float((float)(");
+        break;
+      case I_TSODL_TYPE__DOUBLE:
+        fprintf(p_file, "TSODLULS_get_uint_from_double((double)(");
+        break;
+      default:
+        fprintf(p_file, "(%s)((", arr_s_c_types[p_field->i_type]);
+    }
+    TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+    fprintf(p_file, "));\n");
+  }
+  if(p_field->b_descending){
+    fprintf(p_file, "  ui64 = ~ui64;\n");
+  }
+}//end function TSODLULS_tsodl_write_numeric_value()
+
+
+
+/**
+ * TSODL functions
+ * Add an instruction (initialized with zeros) to a compiled TSOD
+ */
+static int TSODLULS_tsodl_add_instruction(
+  t_TSODLULS_tsodl_program* p_program,
+  int i_opcode,
+  t_TSODLULS_tsodl_instruction** p_p_instruction
+){
+  void* p_for_realloc = NULL;
+
+  if(p_program->i_number_of_instructions == p_program->i_allocated_number_of_instructions){
+    p_for_realloc = realloc(
+        p_program->arr_instructions,
+        2 * (p_program->i_allocated_number_of_instructions + 1) * sizeof(t_TSODLULS_tsodl_instruction)
+    );
+    if(p_for_realloc == NULL){
+      return I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+    }
+    p_program->arr_instructions = (t_TSODLULS_tsodl_instruction*) p_for_realloc;
+    p_program->i_allocated_number_of_instructions = 2 * (p_program->i_allocated_number_of_instructions + 1);
+  }
+  *p_p_instruction = &(p_program->arr_instructions[p_program->i_number_of_instructions++]);
+  memset(*p_p_instruction, 0, sizeof(t_TSODLULS_tsodl_instruction));
+  (*p_p_instruction)->i_opcode = i_opcode;
+  return 0;
+}//end function TSODLULS_tsodl_add_instruction()
+
+
+
+/**
+ * TSODL functions
+ * Compile a normalized expression in instructions computing its address
+ * (or the address of the data for a string)
+ */
+static int TSODLULS_tsodl_compile_expression(
+  t_TSODLULS_tsodl_program* p_program,
+  const char* s_expression,
+  const t_TSODLULS_tsodl_member* arr_members,
+  size_t i_number_of_members,
+  unsigned int b_string
+){
+  int i_result = 0;
+  size_t i = 0;
+  size_t i_start = 0;
+  size_t i_number_of_stars = 0;
+  unsigned int b_array = 0;
+  const t_TSODLULS_tsodl_member* p_member = NULL;
+  t_TSODLULS_tsodl_instruction* p_instruction = NULL;
+
+  while(s_expression[i] == '*'){
+    ++i_number_of_stars;
+    ++i;
+  }
+  i += strlen("CURRENT");
+  i_result = TSODLULS_tsodl_add_instruction(p_program, I_TSODL_OPCODE__CURRENT, &p_instruction);
+  if(i_result != 0){
+    return i_result;
+  }
+  while(s_expression[i] != '\0'){
+    if(s_expression[i] == '.'){
+      ++i;
+    }
+    else{//->
+      i += 2;
+      i_result = TSODLULS_tsodl_add_instruction(p_program, I_TSODL_OPCODE__LOAD_POINTER, &p_instruction);
+      if(i_result != 0){
+        return i_result;
+      }
+    }
+    i_start = i;
+    while(isalnum((unsigned char)s_expression[i]) || s_expression[i] == '_'){
+      ++i;
+    }
+    p_member = NULL;
+    for(size_t j = 0; j < i_number_of_members; ++j){
+      if(strlen(arr_members[j].s_name) == i - i_start
+        && memcmp(arr_members[j].s_name, s_expression + i_start, i - i_start) == 0
+      ){
+        p_member = &(arr_members[j]);
+        break;
+      }
+    }
+    if(p_member == NULL){
+      return I_ERROR__TSODL_UNKNOWN_MEMBER;
+    }
+    b_array = p_member->b_array;
+    if(p_member->i_offset == 0){
+      continue;
+    }
+    //consecutive offsets are merged
+    if(p_instruction->i_opcode != I_TSODL_OPCODE__ADD_OFFSET){
+      i_result = TSODLULS_tsodl_add_instruction(p_program, I_TSODL_OPCODE__ADD_OFFSET, &p_instruction);
+      if(i_result != 0){
+        return i_result;
+      }
+    }
+    p_instruction->i_argument += p_member->i_offset;
+  }
+  for(i = 0; i < i_number_of_stars; ++i){
+    i_result = TSODLULS_tsodl_add_instruction(p_program, I_TSODL_OPCODE__LOAD_POINTER, &p_instruction);
+    if(i_result != 0){
+      return i_result;
+    }
+  }
+  //an array member is its data, a pointer must be loaded
+  if(b_string && (i_number_of_stars > 0 || !b_array)){
+    i_result = TSODLULS_tsodl_add_instruction(p_program, I_TSODL_OPCODE__LOAD_POINTER, &p_instruction);
+    if(i_result != 0){
+      return i_result;
+    }
+  }
+  return 0;
+}//end function TSODLULS_tsodl_compile_expression()
+
+
+
+/**
+ * TSODL functions
+ * Compile a field of a parsed TSOD
+ */
+static int TSODLULS_tsodl_compile_field(
+  t_TSODLULS_tsodl_program* p_program,
+  const t_TSODLULS_tsodl_field* p_field,
+  const t_TSODLULS_tsodl_member* arr_members,
+  size_t i_number_of_members,
+  size_t i_key_offset
+){
+  int i_result = 0;
+  t_TSODLULS_tsodl_instruction* p_instruction = NULL;
+
+  if(p_field->i_type == I_TSODL_TYPE__VARCHAR_LENGTH){
+    i_result = TSODLULS_tsodl_compile_expression(
+        p_program, p_field->s_length_expression, arr_members, i_number_of_members, 0
+    );
+    if(i_result != 0){
+      return i_result;
+    }
+    i_result = TSODLULS_tsodl_add_instruction(p_program, I_TSODL_OPCODE__LOAD_LENGTH, &p_instruction);
+    if(i_result != 0){
+      return i_result;
+    }
+    p_instruction->i_type = p_field->i_length_type;
+  }
+  if(p_field->i_type < I_TSODL_TYPE__CHAR && p_field->i_key_size == 0){//RANGE(a, a)
+    return 0;
+  }
+  i_result = TSODLULS_tsodl_compile_expression(
+      p_program,
+      p_field->s_expression,
+      arr_members,
+      i_number_of_members,
+      p_field->i_type >= I_TSODL_TYPE__CHAR
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+  switch(p_field->i_type){
+    case I_TSODL_TYPE__CHAR:
+      i_result = TSODLULS_tsodl_add_instruction(p_program, I_TSODL_OPCODE__CHAR, &p_instruction);
+      if(i_result != 0){
+        return i_result;
+      }
+      p_instruction->i_argument = p_field->i_char_length;
+      break;
+    case I_TSODL_TYPE__VARCHAR_NULL:
+      i_result = TSODLULS_tsodl_add_instruction(p_program, I_TSODL_OPCODE__VARCHAR_NULL, &p_instruction);
+      if(i_result != 0){
+        return i_result;
+      }
+      p_instruction->i_terminator = p_field->i_terminator;
+      break;
+    case I_TSODL_TYPE__VARCHAR_LENGTH:
+      i_result = TSODLULS_tsodl_add_instruction(p_program, I_TSODL_OPCODE__VARCHAR_LENGTH, &p_instruction);
+      if(i_result != 0){
+        return i_result;
+      }
+      break;
+    default:
+      i_result = TSODLULS_tsodl_add_instruction(p_program, I_TSODL_OPCODE__NUMERIC, &p_instruction);
+      if(i_result != 0){
+        return i_result;
+      }
+      p_instruction->i_type = p_field->i_type;
+      p_instruction->i_key_size = (uint8_t)p_field->i_key_size;
+      //the signed values are shifted like in TSODLULS_get_uint64_from_int64() and the following functions
+      if(p_field->b_range){
+        p_instruction->i_subtract = (uint64_t)p_field->i_range_min;
+      }
+      else if(p_field->i_type == I_TSODL_TYPE__INT8){
+        p_instruction->i_subtract = (uint64_t)(int64_t)INT8_MIN;
+      }
+      else if(p_field->i_type == I_TSODL_TYPE__INT16){
+        p_instruction->i_subtract = (uint64_t)(int64_t)INT16_MIN;
+      }
+      else if(p_field->i_type == I_TSODL_TYPE__INT32){
+        p_instruction->i_subtract = (uint64_t)(int64_t)INT32_MIN;
+      }
+      else if(p_field->i_type == I_TSODL_TYPE__INT64){
+        p_instruction->i_subtract = (uint64_t)INT64_MIN;
+      }
+  }
+  p_instruction->b_descending = (uint8_t)p_field->b_descending;
+  p_instruction->b_lexicographic = (uint8_t)p_field->b_lexicographic;
+  p_instruction->i_key_offset = i_key_offset;
+  return 0;
+}//end function TSODLULS_tsodl_compile_field()
+
+
+
+/**
+ * TSODL functions
+ * Load the numeric values at the addresses of a batch
+ */
+static void TSODLULS_tsodl_load_values(t_TSODLULS_tsodl_batch* p_batch, int i_type){
+  size_t i_number_of_objects = p_batch->i_number_of_objects;
+  const uint8_t** arr_addresses = p_batch->arr_addresses;
+  uint64_t* arr_values = p_batch->arr_values;
+
+  switch(i_type){
+    case I_TSODL_TYPE__UINT8:
+      for(size_t i = 0; i < i_number_of_objects; ++i){
+        arr_values[i] = *((const uint8_t*)arr_addresses[i]);
+      }
+      break;
+    case I_TSODL_TYPE__UINT16:
+      for(size_t i = 0; i < i_number_of_objects; ++i){
+        arr_values[i] = *((const uint16_t*)arr_addresses[i]);
+      }
+      break;
+    case I_TSODL_TYPE__UINT32:
+      for(size_t i = 0; i < i_number_of_objects; ++i){
+        arr_values[i] = *((const uint32_t*)arr_addresses[i]);
+      }
+      break;
+    case I_TSODL_TYPE__UINT64:
+      for(size_t i = 0; i < i_number_of_objects; ++i){
+        arr_values[i] = *((const uint64_t*)arr_addresses[i]);
+      }
+      break;
+    case I_TSODL_TYPE__INT8:
+      for(size_t i = 0; i < i_number_of_objects; ++i){
+        arr_values[i] = (uint64_t)(int64_t)*((const int8_t*)arr_addresses[i]);
+      }
+      break;
+    case I_TSODL_TYPE__INT16:
+      for(size_t i = 0; i < i_number_of_objects; ++i){
+        arr_values[i] = (uint64_t)(int64_t)*((const int16_t*)arr_addresses[i]);
+      }
+      break;
+    case I_TSODL_TYPE__INT32:
+      for(size_t i = 0; i < i_number_of_objects; ++i){
+        arr_values[i] = (uint64_t)(int64_t)*((const int32_t*)arr_addresses[i]);
+      }
+      break;
+    case I_TSODL_TYPE__INT64:
+      for(size_t i = 0; i < i_number_of_objects; ++i){
+        arr_values[i] = (uint64_t)*((const int64_t*)arr_addresses[i]);
+      }
+      break;
+    case I_TSODL_TYPE__FLOAT:
+      for(size_t i = 0; i < i_number_of_objects; ++i){
+        arr_values[i] = TSODLULS_get_uint_from_float(*((const float*)arr_addresses[i]));
+      }
+      break;
+    case I_TSODL_TYPE__DOUBLE:
+      for(size_t i = 0; i < i_number_of_objects; ++i){
+        arr_values[i] = TSODLULS_get_uint_from_double(*((const double*)arr_addresses[i]));
+      }
+      break;
+  }
+}//end function TSODLULS_tsodl_load_values()
+
+
+
+/**
+ * TSODL functions
+ * Execute instructions of a compiled TSOD on a batch
+ * Each instruction is executed on all the objects of the batch before the next one,
+ * hence the interpretation cost is paid once per batch and not once per object.
+ */
+static void TSODLULS_tsodl_execute(
+  const t_TSODLULS_tsodl_program* p_program,
+  size_t i_first_instruction,
+  size_t i_last_instruction,
+  int i_mode,
+  t_TSODLULS_tsodl_batch* p_batch
+){
+  const t_TSODLULS_tsodl_instruction* p_instruction = NULL;
+  size_t i_number_of_objects = p_batch->i_number_of_objects;
+  const uint8_t** arr_addresses = p_batch->arr_addresses;
+  uint64_t* arr_values = p_batch->arr_values;
+  size_t* arr_lengths = p_batch->arr_lengths;
+  uint8_t** arr_cursors = p_batch->arr_cursors;
+  uint64_t* arr_keys = p_batch->arr_keys;
+  const uint8_t* s_data = NULL;
+  uint8_t* s_key = NULL;
+  size_t i_length = 0;
+  size_t i_key_size = 0;
+  size_t i_shift = 0;
+  uint64_t i_mask = 0;
+  uint8_t i_xor = 0;
+  uint8_t i_terminator = 0;
+
+  for(size_t i = i_first_instruction; i < i_last_instruction; ++i){
+    p_instruction = &(p_program->arr_instructions[i]);
+    i_xor = p_instruction->b_descending ? 255 : 0;
+    switch(p_instruction->i_opcode){
+      case I_TSODL_OPCODE__CURRENT:
+        for(size_t j = 0; j < i_number_of_objects; ++j){
+          arr_addresses[j] = p_batch->p_first_object + j * p_batch->i_object_size;
+        }
+        break;
+      case I_TSODL_OPCODE__ADD_OFFSET:
+        for(size_t j = 0; j < i_number_of_objects; ++j){
+          arr_addresses[j] += p_instruction->i_argument;
+        }
+        break;
+      case I_TSODL_OPCODE__LOAD_POINTER:
+        for(size_t j = 0; j < i_number_of_objects; ++j){
+          arr_addresses[j] = *((const uint8_t* const*)arr_addresses[j]);
+        }
+        break;
+      case I_TSODL_OPCODE__LOAD_LENGTH:
+        TSODLULS_tsodl_load_values(p_batch, p_instruction->i_type);
+        for(size_t j = 0; j < i_number_of_objects; ++j){
+          arr_lengths[j] = (size_t)arr_values[j];
+        }
+        break;
+      case I_TSODL_OPCODE__NUMERIC:
+        TSODLULS_tsodl_load_values(p_batch, p_instruction->i_type);
+        i_mask = p_instruction->b_descending ? UINT64_MAX : 0;
+        for(size_t j = 0; j < i_number_of_objects; ++j){
+          arr_values[j] = (arr_values[j] - p_instruction->i_subtract) ^ i_mask;
+        }
+        i_key_size = p_instruction->i_key_size;
+        if(i_mode == I_TSODL_MODE__SHORT){
+          i_shift = 64 - 8 * (p_instruction->i_key_offset + i_key_size);
+          i_mask = i_key_size == 8 ? UINT64_MAX : ((((uint64_t)1) << (8 * i_key_size)) - 1);
+          for(size_t j = 0; j < i_number_of_objects; ++j){
+            arr_keys[j] |= (arr_values[j] & i_mask) << i_shift;
+          }
+          break;
+        }
+        for(size_t j = 0; j < i_number_of_objects; ++j){
+          s_key = arr_cursors[j];
+          for(size_t k = 0; k < i_key_size; ++k){
+            s_key[k] = (uint8_t)(arr_values[j] >> (8 * (i_key_size - 1 - k)));
+          }
+          arr_cursors[j] += i_key_size;
+        }
+        break;
+      case I_TSODL_OPCODE__CHAR:
+        i_length = p_instruction->i_argument;
+        if(i_mode == I_TSODL_MODE__SHORT){
+          for(size_t j = 0; j < i_number_of_objects; ++j){
+            for(size_t k = 0; k < i_length; ++k){
+              arr_keys[j] |= ((uint64_t)(uint8_t)(arr_addresses[j][k] ^ i_xor))
+                << (56 - 8 * (p_instruction->i_key_offset + k));
+            }
+          }
+          break;
+        }
+        for(size_t j = 0; j < i_number_of_objects; ++j){
+          if(i_xor == 0){
+            memcpy(arr_cursors[j], arr_addresses[j], i_length);
+          }
+          else{
+            for(size_t k = 0; k < i_length; ++k){
+              arr_cursors[j][k] = arr_addresses[j][k] ^ i_xor;
+            }
+          }
+          arr_cursors[j] += i_length;
+        }
+        break;
+      case I_TSODL_OPCODE__VARCHAR_NULL:
+        i_terminator = p_instruction->i_terminator;
+        for(size_t j = 0; j < i_number_of_objects; ++j){
+          s_data = arr_addresses[j];
+          if(i_mode == I_TSODL_MODE__SIZING){
+            if(i_terminator == 0){
+              i_length = strlen((const char*)s_data);
+            }
+            else{
+              for(i_length = 0; s_data[i_length] != i_terminator; ++i_length){}
+            }
+            //data bytes and one end byte
+            p_batch->arr_sizes[j] += i_length + 1;
+            continue;
+          }
+          s_key = arr_cursors[j];
+          if(i_terminator == 0 && i_xor == 0){
+            //no data byte is 0, the end byte 0 is enough
+            i_length = strlen((const char*)s_data);
+            memcpy(s_key, s_data, i_length);
+          }
+          else if(p_instruction->b_lexicographic && i_xor != 0){
+            //LEXICOGRAPHIC DESC: data bytes are reversed then shifted above the end byte 0
+            for(i_length = 0; s_data[i_length] != i_terminator; ++i_length){
+              s_key[i_length] = (uint8_t)(~s_data[i_length] + (s_data[i_length] > i_terminator));
+            }
+          }
+          else{
+            //data bytes different from the terminator are shifted so that the end byte 0 (255 for DESC) is enough
+            for(i_length = 0; s_data[i_length] != i_terminator; ++i_length){
+              s_key[i_length] = ((uint8_t)(s_data[i_length] + (s_data[i_length] < i_terminator))) ^ i_xor;
+            }
+          }
+          s_key[i_length] = p_instruction->b_lexicographic ? 0 : i_xor;
+          arr_cursors[j] += i_length + 1;
+        }
+        break;
+      case I_TSODL_OPCODE__VARCHAR_LENGTH:
+        if(i_mode == I_TSODL_MODE__SIZING){
+          //one padding byte before each data byte and one end byte
+          for(size_t j = 0; j < i_number_of_objects; ++j){
+            p_batch->arr_sizes[j] += 2 * arr_lengths[j] + 1;
+          }
+          break;
+        }
+        for(size_t j = 0; j < i_number_of_objects; ++j){
+          s_data = arr_addresses[j];
+          s_key = arr_cursors[j];
+          //a lex (contrelex for DESC, except with LEXICOGRAPHIC) padding byte before each data byte
+          for(size_t k = 0; k < arr_lengths[j]; ++k){
+            s_key[2 * k] = p_instruction->b_lexicographic ? 255 : ~i_xor;
+            s_key[2 * k + 1] = s_data[k] ^ i_xor;
+          }
+          s_key[2 * arr_lengths[j]] = p_instruction->b_lexicographic ? 0 : i_xor;
+          arr_cursors[j] += 2 * arr_lengths[j] + 1;
+        }
+        break;
+    }
+  }
+}//end function TSODLULS_tsodl_execute()
+
+
+
+//------------------------------------------------------------------------------------
+//External functions
+//------------------------------------------------------------------------------------
+/**
+ * TSODL functions
+ * Parse a TSOD (Tree Structured Order Definition) written in TSODL for C
+ * Supported subset: NEXT(...) (nested, with optional trailing comma), comments,
+ * fields "[*]CURRENT(.field|->field)* TYPE [RANGE(min, max)] [ASC|DESC]" with TYPE among
+ * UINT8, UINT16, UINT32, UINT64, INT8, INT16, INT32, INT64, INT (32 bits), SIZE_T (64 bits), FLOAT, DOUBLE,
+ * CHAR(n), VARCHAR(NULL), VARCHAR(NULL(k)), VARCHAR(CURRENT->length INTEGER_TYPE),
+ * and LEXICOGRAPHIC(field) on a CHAR or VARCHAR field: the characters are the subelements,
+ * DESC applies to them and a prefix still comes first (with the same padding as the field).
+ * The other infinite arity order-operators, iterators and collations return I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT.
+ * On error, p_order->i_error_offset is the offset of the error in s_tsod.
+ * The order must be freed with TSODLULS_tsodl_free_order(), even on error.
+ */
+int TSODLULS_tsodl_parse(t_TSODLULS_tsodl_order* p_order, const char* s_tsod){
+  int i_result = 0;
+  size_t i_offset = 0;
+
+  p_order->arr_fields = NULL;
+  p_order->i_number_of_fields = 0;
+  p_order->i_allocated_number_of_fields = 0;
+  p_order->i_fixed_key_size = 0;
+  p_order->b_variable_key_size = 0;
+  p_order->i_error_offset = 0;
+
+  i_result = TSODLULS_tsodl_parse_order(p_order, s_tsod, &i_offset);
+  if(i_result == 0){
+    TSODLULS_tsodl_skip_blanks(s_tsod, &i_offset);
+    if(s_tsod[i_offset] != '\0'){
+      i_result = I_ERROR__TSODL_SYNTAX_ERROR;
+    }
+  }
+  if(i_result != 0){
+    p_order->i_error_offset = i_offset;
+  }
+  return i_result;
+}//end function TSODLULS_tsodl_parse()
+
+
+
+/**
+ * TSODL functions
+ * Free a parsed TSOD
+ */
+void TSODLULS_tsodl_free_order(t_TSODLULS_tsodl_order* p_order){
+  for(size_t i = 0; i < p_order->i_number_of_fields; ++i){
+    if(p_order->arr_fields[i].s_expression != NULL){
+      TSODLULS_free(p_order->arr_fields[i].s_expression);
+    }
+    if(p_order->arr_fields[i].s_length_expression != NULL){
+      TSODLULS_free(p_order->arr_fields[i].s_length_expression);
+    }
+  }
+  if(p_order->arr_fields != NULL){
+    TSODLULS_free(p_order->arr_fields);
+  }
+  p_order->i_number_of_fields = 0;
+  p_order->i_allocated_number_of_fields = 0;
+}//end function TSODLULS_tsodl_free_order()
+
+
+
+/**
+ * TSODL functions
+ * Write the C code of the nextification functions of a parsed TSOD
+ * s_current_type is the C type of the items of the array to sort (CURRENT in the TSOD).
+ * The following functions are generated:
+ *  - int s_function_name(t_TSODLULS_sort_element* p_sort_element, s_current_type* p_current);
+ *    appends the key of *p_current to the key of the cell, with one allocation of the exact size,
+ *  - int s_function_name__fill_cells(t_TSODLULS_sort_element* arr_elements, s_current_type* arr_objects, size_t i_number_of_elements);
+ *  - if the key has a fixed size of at most 8 bytes, the same two functions for short cells,
+ *    with the suffix __short, and a constant s_function_name__KEY_SIZE.
+ * The padding is chosen at generation time: fixed size fields need none,
+ * and strings use the cheapest end marker allowed by their type.
+ * The generated code must be compiled after TSODLULS.h and the definition of s_current_type.
+ */
+int TSODLULS_tsodl_generate_c_code(
+  FILE* p_file,
+  const t_TSODLULS_tsodl_order* p_order,
+  const char* s_function_name,
+  const char* s_current_type
+){
+  const t_TSODLULS_tsodl_field* p_field = NULL;
+  unsigned int b_numeric_fields = 0;
+  unsigned int b_short = 0;
+  unsigned int b_loop = 0;
+  size_t i_short_offset = 0;
+
+  for(size_t i = 0; i < p_order->i_number_of_fields; ++i){
+    if(p_order->arr_fields[i].i_type < I_TSODL_TYPE__CHAR){
+      b_numeric_fields = 1;
+    }
+  }
+  b_short = !p_order->b_variable_key_size && p_order->i_fixed_key_size <= 8;
+
+  //documentation
+  fprintf(p_file, "/**\n * Nextification function generated by TSODLULS for the TSOD:\n * NEXT(\n");
+  for(size_t i = 0; i < p_order->i_number_of_fields; ++i){
+    fprintf(p_file, " *   ");
+    TSODLULS_tsodl_write_field(p_file, &(p_order->arr_fields[i]));
+    fprintf(p_file, ",\n");
+  }
+  fprintf(p_file, " * )\n * where CURRENT has type %s.\n", s_current_type);
+  if(p_order->b_variable_key_size){
+    fprintf(p_file, " * The key has at least %zu bytes.\n", p_order->i_fixed_key_size);
+  }
+  else{
+    fprintf(p_file, " * The key has %zu bytes.\n", p_order->i_fixed_key_size);
+  }
+  fprintf(p_file, " * The key is appended to the current key of the cell.\n */\n");
+  if(!p_order->b_variable_key_size){
+    fprintf(p_file, "#define %s__KEY_SIZE %zu\n\n", s_function_name, p_order->i_fixed_key_size);
+  }
+
+  //long cells
+  fprintf(
+      p_file,
+      "int %s(t_TSODLULS_sort_element* p_sort_element, %s* p_current){\n"
+      "  int i_result = 0;\n"
+      "  size_t i_size_needed = %zu;\n"
+      "  uint8_t* s_key = NULL;\n",
+      s_function_name,
+      s_current_type,
+      p_order->i_fixed_key_size
+  );
+  if(b_numeric_fields){
+    fprintf(p_file, "  uint64_t ui64 = 0;\n");
+  }
+  for(size_t i = 0; i < p_order->i_number_of_fields; ++i){
+    if(p_order->arr_fields[i].i_key_size == 0 && p_order->arr_fields[i].i_type >= I_TSODL_TYPE__VARCHAR_NULL){
+      fprintf(p_file, "  size_t i_length_%zu = 0;\n", i);
+    }
+  }
+  for(size_t i = 0; i < p_order->i_number_of_fields; ++i){
+    if(p_order->arr_fields[i].i_type >= I_TSODL_TYPE__VARCHAR_NULL
+      || (p_order->arr_fields[i].i_type == I_TSODL_TYPE__CHAR && p_order->arr_fields[i].b_descending)
+    ){
+      b_loop = 1;
+    }
+  }
+  if(b_loop){
+    fprintf(p_file, "  size_t i;\n");
+  }
+  fprintf(p_file, "\n");
+
+  //sizes of the variable fields
+  for(size_t i = 0; i < p_order->i_number_of_fields; ++i){
+    p_field = &(p_order->arr_fields[i]);
+    if(p_field->i_type == I_TSODL_TYPE__VARCHAR_NULL){
+      if(p_field->i_terminator == 0){
+        fprintf(p_file, "  i_length_%zu = strlen((const char*)(", i);
+        TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+        fprintf(p_file, "));\n");
+      }
+      else{
+        fprintf(p_file, "  while(((const uint8_t*)(");
+        TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+        fprintf(p_file, "))[i_length_%zu] != %u){\n    ++i_length_%zu;\n  }\n", i, (unsigned int)p_field->i_terminator, i);
+      }
+      //data bytes and one end byte
+      fprintf(p_file, "  i_size_needed += i_length_%zu + 1;\n", i);
+    }
+    else if(p_field->i_type == I_TSODL_TYPE__VARCHAR_LENGTH){
+      fprintf(p_file, "  i_length_%zu = (size_t)(", i);
+      TSODLULS_tsodl_write_c_expression(p_file, p_field->s_length_expression);
+      fprintf(p_file, ");\n");
+      //one padding byte before each data byte and one end byte
+      fprintf(p_file, "  i_size_needed += 2 * i_length_%zu + 1;\n", i);
+    }
+  }
+
+  fprintf(
+      p_file,
+      "  i_result = TSODLULS_element_allocate_space_for_key(p_sort_element, i_size_needed);\n"
+      "  if(i_result != 0){\n"
+      "    return i_result;\n"
+      "  }\n"
+      "  s_key = p_sort_element->s_key + p_sort_element->i_key_size;\n"
+  );
+
+  for(size_t i = 0; i < p_order->i_number_of_fields; ++i){
+    p_field = &(p_order->arr_fields[i]);
+    fprintf(p_file, "\n  //");
+    TSODLULS_tsodl_write_field(p_file, p_field);
+    fprintf(p_file, "\n");
+    switch(p_field->i_type){
+      case I_TSODL_TYPE__CHAR:
+        if(p_field->b_descending){
+          fprintf(p_file, "  for(i = 0; i < %zu; ++i){\n    s_key[i] = ~((const uint8_t*)(", p_field->i_char_length);
+          TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+          fprintf(p_file, "))[i];\n  }\n");
+        }
+        else{
+          fprintf(p_file, "  memcpy(s_key, (const void*)(");
+          TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+          fprintf(p_file, "), %zu);\n", p_field->i_char_length);
+        }
+        fprintf(p_file, "  s_key += %zu;\n", p_field->i_char_length);
+        break;
+      case I_TSODL_TYPE__VARCHAR_NULL:
+        if(p_field->i_terminator == 0 && !p_field->b_descending){
+          //no data byte is 0, the end byte 0 is enough
+          fprintf(p_file, "  memcpy(s_key, (const void*)(");
+          TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+          fprintf(p_file, "), i_length_%zu);\n", i);
+        }
+        else if(p_field->b_lexicographic && p_field->b_descending){
+          //LEXICOGRAPHIC DESC: data bytes are reversed then shifted above the end byte 0
+          fprintf(p_file, "  for(i = 0; i < i_length_%zu; ++i){\n    s_key[i] = (uint8_t)(~((const uint8_t*)(", i);
+          TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+          fprintf(p_file, "))[i] + (((const uint8_t*)(");
+          TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+          fprintf(p_file, "))[i] > %u));\n  }\n", (unsigned int)p_field->i_terminator);
+        }
+        else{
+          //data bytes different from the terminator are shifted so that the end byte 0 (255 for DESC) is enough
+          fprintf(p_file, "  for(i = 0; i < i_length_%zu; ++i){\n    s_key[i] = ", i);
+          if(p_field->b_descending){
+            fprintf(p_file, "~");
+          }
+          fprintf(p_file, "(uint8_t)(");
+          if(p_field->i_terminator == 0){
+            fprintf(p_file, "((const uint8_t*)(");
+            TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+            fprintf(p_file, "))[i]");
+          }
+          else{
+            fprintf(p_file, "((const uint8_t*)(");
+            TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+            fprintf(p_file, "))[i] + (((const uint8_t*)(");
+            TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+            fprintf(p_file, "))[i] < %u)", (unsigned int)p_field->i_terminator);
+          }
+          fprintf(p_file, ");\n  }\n");
+        }
+        fprintf(p_file, "  s_key[i_length_%zu] = %u;\n", i, p_field->b_descending && !p_field->b_lexicographic ? 255u : 0u);
+        fprintf(p_file, "  s_key += i_length_%zu + 1;\n", i);
+        break;
+      case I_TSODL_TYPE__VARCHAR_LENGTH:
+        //a lex (contrelex for DESC, except with LEXICOGRAPHIC) padding byte before each data byte
+        fprintf(p_file, "  for(i = 0; i < i_length_%zu; ++i){\n", i);
+        fprintf(p_file, "    s_key[2 * i] = %u;\n", p_field->b_descending && !p_field->b_lexicographic ? 0u : 255u);
+        fprintf(p_file, "    s_key[2 * i + 1] = %s((const uint8_t*)(", p_field->b_descending ? "~" : "");
+        TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+        fprintf(p_file, "))[i];\n  }\n");
+        fprintf(p_file, "  s_key[2 * i_length_%zu] = %u;\n", i, p_field->b_descending && !p_field->b_lexicographic ? 255u : 0u);
+        fprintf(p_file, "  s_key += 2 * i_length_%zu + 1;\n", i);
+        break;
+      default:
+        if(p_field->i_key_size == 0){//RANGE(a, a)
+          break;
+        }
+        TSODLULS_tsodl_write_numeric_value(p_file, p_field);
+        for(size_t j = 0; j < p_field->i_key_size; ++j){
+          if(j + 1 == p_field->i_key_size){
+            fprintf(p_file, "  s_key[%zu] = (uint8_t)(ui64);\n", j);
+          }
+          else{
+            fprintf(p_file, "  s_key[%zu] = (uint8_t)(ui64 >> %zu);\n", j, 8 * (p_field->i_key_size - 1 - j));
+          }
+        }
+        fprintf(p_file, "  s_key += %zu;\n", p_field->i_key_size);
+    }
+  }
+  fprintf(
+      p_file,
+      "\n"
+      "  p_sort_element->i_key_size += i_size_needed;\n"
+      "  return 0;\n"
+      "}//end function %s()\n\n\n\n",
+      s_function_name
+  );
+
+  fprintf(
+      p_file,
+      "/**\n"
+      " * Fill the cells with the objects and their keys (see %s())\n"
+      " */\n"
+      "int %s__fill_cells(\n"
+      "  t_TSODLULS_sort_element* arr_elements,\n"
+      "  %s* arr_objects,\n"
+      "  size_t i_number_of_elements\n"
+      "){\n"
+      "  int i_result = 0;\n"
+      "  for(size_t i = 0; i < i_number_of_elements; ++i){\n"
+      "    arr_elements[i].p_object = &(arr_objects[i]);\n"
+      "    arr_elements[i].i_key_size = 0;\n"
+      "    i_result = %s(&(arr_elements[i]), &(arr_objects[i]));\n"
+      "    if(i_result != 0){\n"
+      "      return i_result;\n"
+      "    }\n"
+      "  }\n"
+      "  return 0;\n"
+      "}//end function %s__fill_cells()\n\n\n\n",
+      s_function_name,
+      s_function_name,
+      s_current_type,
+      s_function_name,
+      s_function_name
+  );
+
+  //short cells
+  if(b_short){
+    fprintf(
+        p_file,
+        "/**\n"
+        " * Same as %s() for short cells (the key is replaced)\n"
+        " */\n"
+        "int %s__short(t_TSODLULS_sort_element__short* p_sort_element, %s* p_current){\n"
+        "  uint64_t i_key = 0;\n",
+        s_function_name,
+        s_function_name,
+        s_current_type
+    );
+    if(b_numeric_fields){
+      fprintf(p_file, "  uint64_t ui64 = 0;\n");
+    }
+    for(size_t i = 0; i < p_order->i_number_of_fields; ++i){
+      p_field = &(p_order->arr_fields[i]);
+      fprintf(p_file, "\n  //");
+      TSODLULS_tsodl_write_field(p_file, p_field);
+      fprintf(p_file, "\n");
+      if(p_field->i_type == I_TSODL_TYPE__CHAR){
+        for(size_t j = 0; j < p_field->i_char_length; ++j){
+          fprintf(p_file, "  i_key |= ((uint64_t)(uint8_t)(%s((const uint8_t*)(", p_field->b_descending ? "~" : "");
+          TSODLULS_tsodl_write_c_expression(p_file, p_field->s_expression);
+          fprintf(p_file, "))[%zu])) << %zu;\n", j, 56 - 8 * (i_short_offset + j));
+        }
+      }
+      else if(p_field->i_key_size > 0){
+        TSODLULS_tsodl_write_numeric_value(p_file, p_field);
+        if(p_field->i_key_size < 8){
+          fprintf(
+              p_file,
+              "  i_key |= (ui64 & UINT64_C(0x%" PRIx64 ")) << %zu;\n",
+              (((uint64_t)1) << (8 * p_field->i_key_size)) - 1,
+              64 - 8 * (i_short_offset + p_field->i_key_size)
+          );
+        }
+        else{
+          fprintf(p_file, "  i_key |= ui64;\n");
+        }
+      }
+      i_short_offset += p_field->i_key_size;
+    }
+    fprintf(
+        p_file,
+        "\n"
+        "  p_sort_element->i_key = i_key;\n"
+        "  return 0;\n"
+        "}//end function %s__short()\n\n\n\n",
+        s_function_name
+    );
+
+    fprintf(
+        p_file,
+        "/**\n"
+        " * Fill the short cells with the objects and their keys (see %s__short())\n"
+        " */\n"
+        "int %s__short__fill_cells(\n"
+        "  t_TSODLULS_sort_element__short* arr_elements,\n"
+        "  %s* arr_objects,\n"
+        "  size_t i_number_of_elements\n"
+        "){\n"
+        "  for(size_t i = 0; i < i_number_of_elements; ++i){\n"
+        "    arr_elements[i].p_object = &(arr_objects[i]);\n"
+        "    %s__short(&(arr_elements[i]), &(arr_objects[i]));\n"
+        "  }\n"
+        "  return 0;\n"
+        "}//end function %s__short__fill_cells()\n\n\n\n",
+        s_function_name,
+        s_function_name,
+        s_current_type,
+        s_function_name,
+        s_function_name
+    );
+  }
+
+  if(ferror(p_file)){
+    return I_ERROR__COULD_NOT_WRITE_CHARACTER;
+  }
+  return 0;
+}//end function TSODLULS_tsodl_generate_c_code()
+
+
+
+
+
+
+/**
+ * TSODL functions
+ * Compile a TSOD (see TSODLULS_tsodl_parse()) for the runtime nextification of arrays of objects
+ * CURRENT is an item of the array, its members are given by arr_members.
+ * Unknown members give I_ERROR__TSODL_UNKNOWN_MEMBER.
+ * The program must be freed with TSODLULS_tsodl_free_program(), even on error.
+ */
+int TSODLULS_tsodl_compile(
+  t_TSODLULS_tsodl_program* p_program,
+  const char* s_tsod,
+  const t_TSODLULS_tsodl_member* arr_members,
+  size_t i_number_of_members
+){
+  int i_result = 0;
+  size_t i_key_offset = 0;
+  t_TSODLULS_tsodl_order order;
+  const t_TSODLULS_tsodl_field* p_field = NULL;
+
+  p_program->arr_instructions = NULL;
+  p_program->i_number_of_instructions = 0;
+  p_program->i_allocated_number_of_instructions = 0;
+  p_program->i_number_of_sizing_instructions = 0;
+  p_program->i_fixed_key_size = 0;
+  p_program->b_variable_key_size = 0;
+  p_program->i_error_offset = 0;
+
+  i_result = TSODLULS_tsodl_parse(&order, s_tsod);
+  if(i_result != 0){
+    p_program->i_error_offset = order.i_error_offset;
+    TSODLULS_tsodl_free_order(&order);
+    return i_result;
+  }
+  p_program->i_fixed_key_size = order.i_fixed_key_size;
+  p_program->b_variable_key_size = order.b_variable_key_size;
+
+  //the sizes of the variable fields are needed before allocating the keys
+  for(size_t i = 0; i < order.i_number_of_fields; ++i){
+    p_field = &(order.arr_fields[i]);
+    if(p_field->i_type >= I_TSODL_TYPE__VARCHAR_NULL){
+      i_result = TSODLULS_tsodl_compile_field(p_program, p_field, arr_members, i_number_of_members, 0);
+      if(i_result != 0){
+        TSODLULS_tsodl_free_order(&order);
+        return i_result;
+      }
+    }
+  }
+  p_program->i_number_of_sizing_instructions = p_program->i_number_of_instructions;
+
+  for(size_t i = 0; i < order.i_number_of_fields; ++i){
+    p_field = &(order.arr_fields[i]);
+    i_result = TSODLULS_tsodl_compile_field(p_program, p_field, arr_members, i_number_of_members, i_key_offset);
+    if(i_result != 0){
+      TSODLULS_tsodl_free_order(&order);
+      return i_result;
+    }
+    i_key_offset += p_field->i_key_size;
+  }
+  TSODLULS_tsodl_free_order(&order);
+  return 0;
+}//end function TSODLULS_tsodl_compile()
+
+
+
+/**
+ * TSODL functions
+ * Free a compiled TSOD
+ */
+void TSODLULS_tsodl_free_program(t_TSODLULS_tsodl_program* p_program){
+  if(p_program->arr_instructions != NULL){
+    TSODLULS_free(p_program->arr_instructions);
+  }
+  p_program->i_number_of_instructions = 0;
+  p_program->i_allocated_number_of_instructions = 0;
+  p_program->i_number_of_sizing_instructions = 0;
+}//end function TSODLULS_tsodl_free_program()
+
+
+
+/**
+ * TSODL functions
+ * Fill the cells with the objects of the array and their keys computed by a compiled TSOD
+ * The keys are the same as with the functions generated by TSODLULS_tsodl_generate_c_code().
+ * The key of each cell is replaced and allocated once with its exact size.
+ */
+int TSODLULS_tsodl_fill_cells(
+  const t_TSODLULS_tsodl_program* p_program,
+  t_TSODLULS_sort_element* arr_elements,
+  void* arr_objects,
+  size_t i_object_size,
+  size_t i_number_of_elements
+){
+  int i_result = 0;
+  t_TSODLULS_tsodl_batch batch;
+  t_TSODLULS_sort_element* p_element = NULL;
+
+  batch.i_object_size = i_object_size;
+  for(size_t i = 0; i < i_number_of_elements; i += I_TSODL_BATCH_SIZE){
+    batch.p_first_object = ((uint8_t*)arr_objects) + i * i_object_size;
+    batch.i_number_of_objects = i_number_of_elements - i;
+    if(batch.i_number_of_objects > I_TSODL_BATCH_SIZE){
+      batch.i_number_of_objects = I_TSODL_BATCH_SIZE;
+    }
+    for(size_t j = 0; j < batch.i_number_of_objects; ++j){
+      batch.arr_sizes[j] = p_program->i_fixed_key_size;
+    }
+    TSODLULS_tsodl_execute(
+        p_program, 0, p_program->i_number_of_sizing_instructions, I_TSODL_MODE__SIZING, &batch
+    );
+    for(size_t j = 0; j < batch.i_number_of_objects; ++j){
+      p_element = &(arr_elements[i + j]);
+      p_element->p_object = batch.p_first_object + j * i_object_size;
+      p_element->i_key_size = 0;
+      i_result = TSODLULS_element_allocate_space_for_key(p_element, batch.arr_sizes[j]);
+      if(i_result != 0){
+        return i_result;
+      }
+      batch.arr_cursors[j] = p_element->s_key;
+    }
+    TSODLULS_tsodl_execute(
+        p_program,
+        p_program->i_number_of_sizing_instructions,
+        p_program->i_number_of_instructions,
+        I_TSODL_MODE__LONG,
+        &batch
+    );
+    for(size_t j = 0; j < batch.i_number_of_objects; ++j){
+      arr_elements[i + j].i_key_size = batch.arr_sizes[j];
+    }
+  }
+  return 0;
+}//end function TSODLULS_tsodl_fill_cells()
+
+
+
+/**
+ * TSODL functions
+ * Same as TSODLULS_tsodl_fill_cells() for short cells
+ * The key must have a fixed size of at most 8 bytes (see p_program->i_fixed_key_size),
+ * otherwise I_ERROR__TSODL_KEY_TOO_LONG_FOR_SHORT_CELLS is returned.
+ */
+int TSODLULS_tsodl_fill_cells__short(
+  const t_TSODLULS_tsodl_program* p_program,
+  t_TSODLULS_sort_element__short* arr_elements,
+  void* arr_objects,
+  size_t i_object_size,
+  size_t i_number_of_elements
+){
+  t_TSODLULS_tsodl_batch batch;
+
+  if(p_program->b_variable_key_size || p_program->i_fixed_key_size > 8){
+    return I_ERROR__TSODL_KEY_TOO_LONG_FOR_SHORT_CELLS;
+  }
+  batch.i_object_size = i_object_size;
+  for(size_t i = 0; i < i_number_of_elements; i += I_TSODL_BATCH_SIZE){
+    batch.p_first_object = ((uint8_t*)arr_objects) + i * i_object_size;
+    batch.i_number_of_objects = i_number_of_elements - i;
+    if(batch.i_number_of_objects > I_TSODL_BATCH_SIZE){
+      batch.i_number_of_objects = I_TSODL_BATCH_SIZE;
+    }
+    memset(batch.arr_keys, 0, batch.i_number_of_objects * sizeof(uint64_t));
+    TSODLULS_tsodl_execute(p_program, 0, p_program->i_number_of_instructions, I_TSODL_MODE__SHORT, &batch);
+    for(size_t j = 0; j < batch.i_number_of_objects; ++j){
+      arr_elements[i + j].p_object = batch.p_first_object + j * i_object_size;
+      arr_elements[i + j].i_key = batch.arr_keys[j];
+    }
+  }
+  return 0;
+}//end function TSODLULS_tsodl_fill_cells__short()
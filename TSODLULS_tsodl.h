@@ -0,0 +1,126 @@
+/*
+This file is part of TSODLULS library.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+
+//------------------------------------------------------------------------------------
+//TSODL parsing, code generation and compilation
+//------------------------------------------------------------------------------------
+/**
+ * TSODL functions
+ * Parse a TSOD (Tree Structured Order Definition) written in TSODL for C
+ * Supported subset: NEXT(...) (nested, with optional trailing comma), comments,
+ * fields "[*]CURRENT(.field|->field)* TYPE [RANGE(min, max)] [ASC|DESC]" with TYPE among
+ * UINT8, UINT16, UINT32, UINT64, INT8, INT16, INT32, INT64, INT (32 bits), SIZE_T (64 bits), FLOAT, DOUBLE,
+ * CHAR(n), VARCHAR(NULL), VARCHAR(NULL(k)), VARCHAR(CURRENT->length INTEGER_TYPE),
+ * and LEXICOGRAPHIC(field) on a CHAR or VARCHAR field: the characters are the subelements,
+ * DESC applies to them and a prefix still comes first (with the same padding as the field).
+ * The other infinite arity order-operators, iterators and collations return I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT.
+ * On error, p_order->i_error_offset is the offset of the error in s_tsod.
+ * The order must be freed with TSODLULS_tsodl_free_order(), even on error.
+ */
+int TSODLULS_tsodl_parse(t_TSODLULS_tsodl_order* p_order, const char* s_tsod);
+
+
+
+/**
+ * TSODL functions
+ * Free a parsed TSOD
+ */
+void TSODLULS_tsodl_free_order(t_TSODLULS_tsodl_order* p_order);
+
+
+
+/**
+ * TSODL functions
+ * Write the C code of the nextification functions of a parsed TSOD
+ * s_current_type is the C type of the items of the array to sort (CURRENT in the TSOD).
+ * The following functions are generated:
+ *  - int s_function_name(t_TSODLULS_sort_element* p_sort_element, s_current_type* p_current);
+ *    appends the key of *p_current to the key of the cell, with one allocation of the exact size,
+ *  - int s_function_name__fill_cells(t_TSODLULS_sort_element* arr_elements, s_current_type* arr_objects, size_t i_number_of_elements);
+ *  - if the key has a fixed size of at most 8 bytes, the same two functions for short cells,
+ *    with the suffix __short, and a constant s_function_name__KEY_SIZE.
+ * The padding is chosen at generation time: fixed size fields need none,
+ * and strings use the cheapest end marker allowed by their type.
+ * The generated code must be compiled after TSODLULS.h and the definition of s_current_type.
+ */
+int TSODLULS_tsodl_generate_c_code(
+  FILE* p_file,
+  const t_TSODLULS_tsodl_order* p_order,
+  const char* s_function_name,
+  const char* s_current_type
+);
+
+
+
+/**
+ * TSODL functions
+ * Compile a TSOD (see TSODLULS_tsodl_parse()) for the runtime nextification of arrays of objects
+ * CURRENT is an item of the array, its members are given by arr_members.
+ * Unknown members give I_ERROR__TSODL_UNKNOWN_MEMBER.
+ * The program must be freed with TSODLULS_tsodl_free_program(), even on error.
+ */
+int TSODLULS_tsodl_compile(
+  t_TSODLULS_tsodl_program* p_program,
+  const char* s_tsod,
+  const t_TSODLULS_tsodl_member* arr_members,
+  size_t i_number_of_members
+);
+
+
+
+/**
+ * TSODL functions
+ * Free a compiled TSOD
+ */
+void TSODLULS_tsodl_free_program(t_TSODLULS_tsodl_program* p_program);
+
+
+
+/**
+ * TSODL functions
+ * Fill the cells with the objects of the array and their keys computed by a compiled TSOD
+ * The keys are the same as with the functions generated by TSODLULS_tsodl_generate_c_code().
+ * The key of each cell is replaced and allocated once with its exact size.
+ */
+int TSODLULS_tsodl_fill_cells(
+  const t_TSODLULS_tsodl_program* p_program,
+  t_TSODLULS_sort_element* arr_elements,
+  void* arr_objects,
+  size_t i_object_size,
+  size_t i_number_of_elements
+);
+
+
+
+/**
+ * TSODL functions
+ * Same as TSODLULS_tsodl_fill_cells() for short cells
+ * The key must have a fixed size of at most 8 bytes (see p_program->i_fixed_key_size),
+ * otherwise I_ERROR__TSODL_KEY_TOO_LONG_FOR_SHORT_CELLS is returned.
+ */
+int TSODLULS_tsodl_fill_cells__short(
+  const t_TSODLULS_tsodl_program* p_program,
+  t_TSODLULS_sort_element__short* arr_elements,
+  void* arr_objects,
+  size_t i_object_size,
+  size_t i_number_of_elements
+);
+
+
+
@@ -0,0 +1,687 @@
+/*
+This file is part of TSODLULS library.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+/*
+Measure the sort engines on this machine and generate the header of the machine-specific constants.
+Usage:
+  autotune.exe [output_file.h]
+The following constants are tuned:
+ - the insertion sort thresholds of the radix engine and of the quicksort for short cells
+   (I_RADIX_INSERTION_THRESHOLD__SHORT and I_QSORT_INSERTION_THRESHOLD__SHORT),
+   by sweeping their values on random keys,
+ - the crossovers between insertion sort and the other algorithms
+   (I_SORT_MODEL__INSERTION_THRESHOLD and I_SORT_MODEL__INSERTION_THRESHOLD__SHORT),
+ - the costs of the model of the sort dispatchers (F_SORT_MODEL__...),
+   by a least squares fit of the estimates of TSODLULS_choose_sort_algorithm() and
+   TSODLULS_choose_sort_algorithm__short() on the measured times.
+The measured crossovers between comparison sort and radix sort are written as comments.
+"make autotune" writes ./TSODLULS_tuning.h and rebuilds the library with it.
+*/
+
+#include <time.h>
+#include <unistd.h>
+#include "../TSODLULS.h"
+
+#define I_AUTOTUNE_ELEMENTS_PER_REPETITION 262144//the small sorts are timed in batches of this size
+#define I_AUTOTUNE_REPETITIONS 5//the minimum time is kept, it is the least sensitive to the noise of the machine
+#define I_AUTOTUNE_MAX_KEY_SIZE 32
+#define I_AUTOTUNE_MAX_COLUMNS 5
+#define I_AUTOTUNE_MAX_ROWS 64
+#define I_AUTOTUNE_MAX_INSERTION_THRESHOLD 64
+
+typedef struct autotune_context {
+  uint64_t i_random_state;
+  t_TSODLULS_sort_element__short* arr_elements__short;
+  t_TSODLULS_sort_element* arr_elements;
+  uint8_t* s_keys;
+} t_autotune_context;
+
+//linear regression of measured times, costs in nanoseconds
+typedef struct autotune_fit {
+  size_t i_number_of_rows;
+  size_t i_number_of_columns;
+  double arr_features[I_AUTOTUNE_MAX_ROWS][I_AUTOTUNE_MAX_COLUMNS];
+  double arr_times[I_AUTOTUNE_MAX_ROWS];
+  double arr_coefficients[I_AUTOTUNE_MAX_COLUMNS];
+} t_autotune_fit;
+
+
+
+//------------------------------------------------------------------------------------
+//Measures
+//------------------------------------------------------------------------------------
+/**
+ * Xorshift64* pseudo-random generator, the sequence is the same on every run
+ */
+static uint64_t autotune_random(t_autotune_context* p_context){
+  p_context->i_random_state ^= p_context->i_random_state >> 12;
+  p_context->i_random_state ^= p_context->i_random_state << 25;
+  p_context->i_random_state ^= p_context->i_random_state >> 27;
+  return p_context->i_random_state * 2685821657736338717ULL;
+}//end function autotune_random()
+
+
+
+static double autotune_now(void){
+  struct timespec time_spec;
+  clock_gettime(CLOCK_MONOTONIC, &time_spec);
+  return ((double)time_spec.tv_sec) * 1e9 + time_spec.tv_nsec;
+}//end function autotune_now()
+
+
+
+/**
+ * Random short keys of i_max_length bytes whose first i_prefix bytes are the same
+ */
+static void autotune_fill__short(
+  t_autotune_context* p_context,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  uint8_t i_prefix
+){
+  uint64_t i_mask = i_max_length >= 8 ? UINT64_MAX : ~(UINT64_MAX >> (8 * i_max_length));
+  uint64_t i_prefix_mask = i_prefix == 0 ? 0 : ~(UINT64_MAX >> (8 * i_prefix));
+  for(size_t i = 0; i < i_number_of_elements; ++i){
+    p_context->arr_elements__short[i].i_key = (
+      (0x5A5A5A5A5A5A5A5AULL & i_prefix_mask) | (autotune_random(p_context) & ~i_prefix_mask)
+    ) & i_mask;
+    p_context->arr_elements__short[i].p_object = NULL;
+  }
+}//end function autotune_fill__short()
+
+
+
+/**
+ * Random long keys of i_key_size bytes whose first i_prefix bytes are the same
+ */
+static void autotune_fill(
+  t_autotune_context* p_context,
+  size_t i_number_of_elements,
+  size_t i_key_size,
+  size_t i_prefix
+){
+  for(size_t i = 0; i < i_number_of_elements; ++i){
+    t_TSODLULS_sort_element* p_cell = &(p_context->arr_elements[i]);
+    p_cell->p_object = NULL;
+    p_cell->i_key_size = i_key_size;
+    p_cell->i_allocated_size = i_key_size;
+    p_cell->s_key = &(p_context->s_keys[i * I_AUTOTUNE_MAX_KEY_SIZE]);
+    for(size_t j = 0; j < i_key_size; ++j){
+      p_cell->s_key[j] = j < i_prefix ? 0x5A : (uint8_t)(autotune_random(p_context) >> 56);
+    }
+  }
+}//end function autotune_fill()
+
+
+
+/**
+ * Minimum time in nanoseconds of one sort of i_number_of_elements short cells
+ */
+static double autotune_time__short(
+  t_autotune_context* p_context,
+  int i_algorithm,
+  size_t i_number_of_elements,
+  uint8_t i_max_length,
+  uint8_t i_prefix,
+  size_t i_threshold
+){
+  double arr_times[I_AUTOTUNE_REPETITIONS];
+  size_t i_number_of_sorts = I_AUTOTUNE_ELEMENTS_PER_REPETITION / i_number_of_elements;
+  int i_result = 0;
+  double f_start = 0.0;
+
+  if(i_number_of_sorts == 0){
+    i_number_of_sorts = 1;
+  }
+  for(int r = 0; r < I_AUTOTUNE_REPETITIONS; ++r){
+    autotune_fill__short(p_context, i_number_of_sorts * i_number_of_elements, i_max_length, i_prefix);
+    f_start = autotune_now();
+    for(size_t i = 0; i < i_number_of_sorts; ++i){
+      t_TSODLULS_sort_element__short* arr_elements = &(p_context->arr_elements__short[i * i_number_of_elements]);
+      switch(i_algorithm){
+        case I_SORT_ALGORITHM__INSERTION:
+          i_result |= TSODLULS_sort_insertion__short(arr_elements, i_number_of_elements);
+        break;
+        case I_SORT_ALGORITHM__COMPARISON:
+          i_result |= TSODLULS_qsort_inlined__short_with_threshold(arr_elements, i_number_of_elements, i_threshold);
+        break;
+        default:
+          i_result |= TSODLULS_sort_radix8_count_insertion__short_with_threshold(
+            arr_elements, i_number_of_elements, i_max_length, i_threshold
+          );
+      }
+    }
+    arr_times[r] = (autotune_now() - f_start) / i_number_of_sorts;
+  }
+  if(i_result != 0){
+    fprintf(stderr, "Sort failed with error %d.\n", i_result);
+    exit(1);
+  }
+  for(int r = 1; r < I_AUTOTUNE_REPETITIONS; ++r){
+    if(arr_times[r] < arr_times[0]){
+      arr_times[0] = arr_times[r];
+    }
+  }
+  return arr_times[0];
+}//end function autotune_time__short()
+
+
+
+/**
+ * Minimum time in nanoseconds of one sort of i_number_of_elements long cells
+ */
+static double autotune_time(
+  t_autotune_context* p_context,
+  int i_algorithm,
+  size_t i_number_of_elements,
+  size_t i_key_size,
+  size_t i_prefix
+){
+  double arr_times[I_AUTOTUNE_REPETITIONS];
+  size_t i_number_of_sorts = I_AUTOTUNE_ELEMENTS_PER_REPETITION / i_number_of_elements;
+  int i_result = 0;
+  double f_start = 0.0;
+
+  if(i_number_of_sorts == 0){
+    i_number_of_sorts = 1;
+  }
+  for(int r = 0; r < I_AUTOTUNE_REPETITIONS; ++r){
+    autotune_fill(p_context, i_number_of_sorts * i_number_of_elements, i_key_size, i_prefix);
+    f_start = autotune_now();
+    for(size_t i = 0; i < i_number_of_sorts; ++i){
+      t_TSODLULS_sort_element* arr_elements = &(p_context->arr_elements[i * i_number_of_elements]);
+      switch(i_algorithm){
+        case I_SORT_ALGORITHM__INSERTION:
+          i_result |= TSODLULS_sort_insertion(arr_elements, i_number_of_elements);
+        break;
+        case I_SORT_ALGORITHM__COMPARISON:
+          i_result |= TSODLULS_pdqsort(arr_elements, i_number_of_elements);
+        break;
+        default:
+          i_result |= TSODLULS_sort_radix8_count_insertion(arr_elements, i_number_of_elements);
+      }
+    }
+    arr_times[r] = (autotune_now() - f_start) / i_number_of_sorts;
+  }
+  if(i_result != 0){
+    fprintf(stderr, "Sort failed with error %d.\n", i_result);
+    exit(1);
+  }
+  for(int r = 1; r < I_AUTOTUNE_REPETITIONS; ++r){
+    if(arr_times[r] < arr_times[0]){
+      arr_times[0] = arr_times[r];
+    }
+  }
+  return arr_times[0];
+}//end function autotune_time()
+
+
+
+//------------------------------------------------------------------------------------
+//Cost model
+//------------------------------------------------------------------------------------
+static size_t autotune_log2(size_t i_number_of_elements){
+  size_t i_log2 = 0;
+  for(size_t i = i_number_of_elements; i > 1; i >>= 1){
+    ++i_log2;
+  }
+  return i_log2;
+}//end function autotune_log2()
+
+
+
+/**
+ * Same estimates as TSODLULS_choose_sort_algorithm__short() for keys with i_prefix common bytes
+ * sorted with the radix threshold i_threshold.
+ * The features are: 1, prefix, prefix * n, levels * n, instances.
+ */
+static void autotune_radix_features__short(
+  double* arr_features,
+  size_t i_number_of_elements,
+  size_t i_max_length,
+  size_t i_prefix,
+  size_t i_threshold
+){
+  size_t i_levels = 0;
+  size_t i_buckets = 1;
+  size_t i_instances = 0;
+  size_t i_max_instances = i_number_of_elements / (2 * (i_threshold + 1));
+  while(i_prefix + i_levels < i_max_length && i_number_of_elements / i_buckets > i_threshold){
+    if(i_levels > 0){
+      i_instances += i_buckets < i_max_instances ? i_buckets : i_max_instances;
+    }
+    ++i_levels;
+    i_buckets *= 256;
+  }
+  arr_features[0] = 1.0;
+  arr_features[1] = i_prefix;
+  arr_features[2] = ((double)i_prefix) * i_number_of_elements;
+  arr_features[3] = ((double)i_levels) * i_number_of_elements;
+  arr_features[4] = i_instances;
+}//end function autotune_radix_features__short()
+
+
+
+/**
+ * Same estimates as TSODLULS_choose_sort_algorithm() for keys with i_prefix common bytes.
+ * The features are: 1, prefix, prefix * n, levels * n, instances.
+ */
+static void autotune_radix_features(
+  double* arr_features,
+  size_t i_number_of_elements,
+  size_t i_key_size,
+  size_t i_prefix
+){
+  size_t i_levels = 0;
+  size_t i_buckets = 1;
+  size_t i_instances = 0;
+  while(i_prefix + i_levels < i_key_size && i_number_of_elements / i_buckets > 2){
+    if(i_levels > 0){
+      i_instances += i_buckets < i_number_of_elements / 4 ? i_buckets : i_number_of_elements / 4;
+    }
+    ++i_levels;
+    i_buckets *= 256;
+  }
+  arr_features[0] = 1.0;
+  arr_features[1] = i_prefix;
+  arr_features[2] = ((double)i_prefix) * i_number_of_elements;
+  arr_features[3] = ((double)i_levels) * i_number_of_elements;
+  arr_features[4] = i_instances;
+}//end function autotune_radix_features()
+
+
+
+static void autotune_add_row(t_autotune_fit* p_fit, const double* arr_features, double f_time){
+  if(p_fit->i_number_of_rows >= I_AUTOTUNE_MAX_ROWS){
+    return;
+  }
+  for(size_t j = 0; j < p_fit->i_number_of_columns; ++j){
+    p_fit->arr_features[p_fit->i_number_of_rows][j] = arr_features[j];
+  }
+  p_fit->arr_times[p_fit->i_number_of_rows] = f_time;
+  ++p_fit->i_number_of_rows;
+}//end function autotune_add_row()
+
+
+
+/**
+ * Least squares fit of the relative errors with non negative coefficients:
+ * the columns with a negative coefficient are removed and the fit is done again.
+ * Returns 0 when the fit succeeded.
+ */
+static int autotune_solve(t_autotune_fit* p_fit){
+  int arr_active[I_AUTOTUNE_MAX_COLUMNS];
+  double arr_matrix[I_AUTOTUNE_MAX_COLUMNS][I_AUTOTUNE_MAX_COLUMNS + 1];
+  size_t arr_columns[I_AUTOTUNE_MAX_COLUMNS];
+  size_t i_size = 0;
+  int b_negative = 0;
+
+  for(size_t j = 0; j < p_fit->i_number_of_columns; ++j){
+    arr_active[j] = 1;
+  }
+  do{
+    //normal equations of the active columns, each row is weighted by 1 / time
+    i_size = 0;
+    for(size_t j = 0; j < p_fit->i_number_of_columns; ++j){
+      p_fit->arr_coefficients[j] = 0.0;
+      if(arr_active[j]){
+        arr_columns[i_size++] = j;
+      }
+    }
+    if(i_size == 0){
+      return 1;
+    }
+    for(size_t a = 0; a < i_size; ++a){
+      for(size_t b = 0; b <= i_size; ++b){
+        arr_matrix[a][b] = 0.0;
+      }
+      for(size_t r = 0; r < p_fit->i_number_of_rows; ++r){
+        double f_weight = 1.0 / (p_fit->arr_times[r] * p_fit->arr_times[r]);
+        for(size_t b = 0; b < i_size; ++b){
+          arr_matrix[a][b] += f_weight * p_fit->arr_features[r][arr_columns[a]] * p_fit->arr_features[r][arr_columns[b]];
+        }
+        arr_matrix[a][i_size] += f_weight * p_fit->arr_features[r][arr_columns[a]] * p_fit->arr_times[r];
+      }
+    }
+    //Gaussian elimination with partial pivoting
+    for(size_t a = 0; a < i_size; ++a){
+      size_t i_pivot = a;
+      for(size_t b = a + 1; b < i_size; ++b){
+        if(fabs(arr_matrix[b][a]) > fabs(arr_matrix[i_pivot][a])){
+          i_pivot = b;
+        }
+      }
+      if(fabs(arr_matrix[i_pivot][a]) < 1e-300){
+        return 1;
+      }
+      for(size_t b = 0; b <= i_size; ++b){
+        double f_tmp = arr_matrix[a][b];
+        arr_matrix[a][b] = arr_matrix[i_pivot][b];
+        arr_matrix[i_pivot][b] = f_tmp;
+      }
+      for(size_t b = 0; b < i_size; ++b){
+        if(b != a){
+          double f_factor = arr_matrix[b][a] / arr_matrix[a][a];
+          for(size_t c = a; c <= i_size; ++c){
+            arr_matrix[b][c] -= f_factor * arr_matrix[a][c];
+          }
+        }
+      }
+    }
+    b_negative = 0;
+    for(size_t a = 0; a < i_size; ++a){
+      p_fit->arr_coefficients[arr_columns[a]] = arr_matrix[a][i_size] / arr_matrix[a][a];
+      if(p_fit->arr_coefficients[arr_columns[a]] < 0.0){
+        arr_active[arr_columns[a]] = 0;
+        b_negative = 1;
+      }
+    }
+  }
+  while(b_negative);
+  return 0;
+}//end function autotune_solve()
+
+
+
+//------------------------------------------------------------------------------------
+//Tuning steps
+//------------------------------------------------------------------------------------
+/**
+ * Sweep of a threshold of an engine for short cells on random keys.
+ * Returns the value with the lowest sum of times relative to the best value for each size.
+ */
+static size_t autotune_sweep_threshold__short(
+  t_autotune_context* p_context,
+  int i_algorithm,
+  const size_t* arr_thresholds,
+  size_t i_number_of_thresholds,
+  const size_t* arr_sizes,
+  size_t i_number_of_sizes
+){
+  double arr_times[16][8];//thresholds x sizes
+  double arr_best[8];
+  size_t i_best_threshold = arr_thresholds[0];
+  double f_best_score = 0.0;
+
+  for(size_t s = 0; s < i_number_of_sizes; ++s){
+    arr_best[s] = 0.0;
+    for(size_t t = 0; t < i_number_of_thresholds; ++t){
+      arr_times[t][s] = autotune_time__short(p_context, i_algorithm, arr_sizes[s], 8, 0, arr_thresholds[t]);
+      if(t == 0 || arr_times[t][s] < arr_best[s]){
+        arr_best[s] = arr_times[t][s];
+      }
+    }
+  }
+  for(size_t t = 0; t < i_number_of_thresholds; ++t){
+    double f_score = 0.0;
+    for(size_t s = 0; s < i_number_of_sizes; ++s){
+      f_score += arr_times[t][s] / arr_best[s];
+    }
+    printf("  threshold %2zu: %.4f\n", arr_thresholds[t], f_score / i_number_of_sizes);
+    if(t == 0 || f_score < f_best_score){
+      f_best_score = f_score;
+      i_best_threshold = arr_thresholds[t];
+    }
+  }
+  return i_best_threshold;
+}//end function autotune_sweep_threshold__short()
+
+
+
+/**
+ * Largest number of elements before insertion sort loses twice in a row against the other algorithms
+ * on random keys.
+ */
+static size_t autotune_insertion_threshold(
+  t_autotune_context* p_context,
+  int b_long,
+  size_t i_radix_threshold,
+  size_t i_qsort_threshold
+){
+  size_t i_threshold = 1;
+  int i_losses = 0;
+  double f_insertion_time = 0.0;
+  double f_comparison_time = 0.0;
+  double f_radix_time = 0.0;
+
+  for(size_t n = 2; n <= I_AUTOTUNE_MAX_INSERTION_THRESHOLD; ++n){
+    if(b_long){
+      f_insertion_time = autotune_time(p_context, I_SORT_ALGORITHM__INSERTION, n, 24, 0);
+      f_comparison_time = autotune_time(p_context, I_SORT_ALGORITHM__COMPARISON, n, 24, 0);
+      f_radix_time = autotune_time(p_context, I_SORT_ALGORITHM__RADIX, n, 24, 0);
+    }
+    else{
+      f_insertion_time = autotune_time__short(p_context, I_SORT_ALGORITHM__INSERTION, n, 8, 0, 0);
+      f_comparison_time = autotune_time__short(p_context, I_SORT_ALGORITHM__COMPARISON, n, 8, 0, i_qsort_threshold);
+      f_radix_time = autotune_time__short(p_context, I_SORT_ALGORITHM__RADIX, n, 8, 0, i_radix_threshold);
+    }
+    if(f_insertion_time <= f_comparison_time && f_insertion_time <= f_radix_time){
+      i_threshold = n;
+      i_losses = 0;
+    }
+    else if(++i_losses >= 2){
+      break;
+    }
+  }
+  return i_threshold;
+}//end function autotune_insertion_threshold()
+
+
+
+/**
+ * Smallest size of the array where the radix sort is faster than the comparison sort,
+ * 0 if there is none.
+ */
+static size_t autotune_crossover(
+  const size_t* arr_sizes,
+  size_t i_number_of_sizes,
+  const double* arr_comparison_times,
+  const double* arr_radix_times
+){
+  for(size_t s = 0; s < i_number_of_sizes; ++s){
+    if(arr_radix_times[s] < arr_comparison_times[s]){
+      return arr_sizes[s];
+    }
+  }
+  return 0;
+}//end function autotune_crossover()
+
+
+
+int main(int argc, char *argv[]){
+
+  t_autotune_context context;
+  t_TSODLULS_sort_model model;
+  t_autotune_fit fit;
+  FILE* p_output_file = stdout;
+  const size_t arr_radix_thresholds[] = {2, 3, 4, 5, 6, 8, 12, 16, 24, 32, 48, 64};
+  const size_t arr_radix_sizes[] = {1000, 10000, 100000};
+  const size_t arr_qsort_thresholds[] = {2, 3, 4, 5, 6, 8, 12, 16, 24, 32, 48, 64};
+  const size_t arr_qsort_sizes[] = {100, 1000, 10000, 100000};
+  const size_t arr_sizes[] = {16, 32, 64, 128, 256, 512, 1024, 4096, 16384, 65536, 262144};
+  const size_t i_number_of_sizes = sizeof(arr_sizes) / sizeof(size_t);
+  double arr_comparison_times__short[sizeof(arr_sizes) / sizeof(size_t)];
+  double arr_radix_times__short[sizeof(arr_sizes) / sizeof(size_t)];
+  double arr_comparison_times[sizeof(arr_sizes) / sizeof(size_t)];
+  double arr_radix_times[sizeof(arr_sizes) / sizeof(size_t)];
+  double arr_features[I_AUTOTUNE_MAX_COLUMNS];
+  size_t i_radix_threshold = I_RADIX_INSERTION_THRESHOLD__SHORT;
+  size_t i_qsort_threshold = I_QSORT_INSERTION_THRESHOLD__SHORT;
+  size_t i_crossover__short = 0;
+  size_t i_crossover = 0;
+  char s_host_name[256] = "unknown";
+  char s_date[64] = "";
+  time_t i_time = time(NULL);
+
+  if(argc > 2){
+    fprintf(stderr, "Usage: %s [output_file.h]\n", argv[0]);
+    return 1;
+  }
+
+  context.i_random_state = 88172645463325252ULL;
+  context.arr_elements__short = calloc(I_AUTOTUNE_ELEMENTS_PER_REPETITION, sizeof(t_TSODLULS_sort_element__short));
+  context.arr_elements = calloc(I_AUTOTUNE_ELEMENTS_PER_REPETITION, sizeof(t_TSODLULS_sort_element));
+  context.s_keys = calloc(I_AUTOTUNE_ELEMENTS_PER_REPETITION, I_AUTOTUNE_MAX_KEY_SIZE);
+  if(context.arr_elements__short == NULL || context.arr_elements == NULL || context.s_keys == NULL){
+    fprintf(stderr, "Could not allocate memory.\n");
+    return 1;
+  }
+  TSODLULS_sort_model_init(&model);
+
+  printf("Insertion threshold of the radix engine for short cells:\n");
+  i_radix_threshold = autotune_sweep_threshold__short(
+    &context,
+    I_SORT_ALGORITHM__RADIX,
+    arr_radix_thresholds,
+    sizeof(arr_radix_thresholds) / sizeof(size_t),
+    arr_radix_sizes,
+    sizeof(arr_radix_sizes) / sizeof(size_t)
+  );
+  printf("Insertion threshold of the quicksort for short cells:\n");
+  i_qsort_threshold = autotune_sweep_threshold__short(
+    &context,
+    I_SORT_ALGORITHM__COMPARISON,
+    arr_qsort_thresholds,
+    sizeof(arr_qsort_thresholds) / sizeof(size_t),
+    arr_qsort_sizes,
+    sizeof(arr_qsort_sizes) / sizeof(size_t)
+  );
+
+  printf("Cost model for short cells.\n");
+  fit.i_number_of_rows = 0;
+  fit.i_number_of_columns = 1;
+  for(size_t s = 0; s < i_number_of_sizes; ++s){
+    arr_comparison_times__short[s] = autotune_time__short(
+      &context, I_SORT_ALGORITHM__COMPARISON, arr_sizes[s], 8, 0, i_qsort_threshold
+    );
+    arr_features[0] = ((double)arr_sizes[s]) * autotune_log2(arr_sizes[s]);
+    autotune_add_row(&fit, arr_features, arr_comparison_times__short[s]);
+  }
+  if(autotune_solve(&fit) == 0 && fit.arr_coefficients[0] > 0.0){
+    model.f_comparison_cost__short = fit.arr_coefficients[0];
+  }
+  fit.i_number_of_rows = 0;
+  fit.i_number_of_columns = 5;
+  for(uint8_t i_max_length = 2; i_max_length <= 8; i_max_length += 3){
+    for(uint8_t i_prefix = 0; i_prefix < i_max_length && i_prefix <= 3; i_prefix += 3){
+      for(size_t s = 0; s < i_number_of_sizes; ++s){
+        double f_time = autotune_time__short(
+          &context, I_SORT_ALGORITHM__RADIX, arr_sizes[s], i_max_length, i_prefix, i_radix_threshold
+        );
+        if(i_max_length == 8 && i_prefix == 0){
+          arr_radix_times__short[s] = f_time;
+        }
+        autotune_radix_features__short(arr_features, arr_sizes[s], i_max_length, i_prefix, i_radix_threshold);
+        autotune_add_row(&fit, arr_features, f_time);
+      }
+    }
+  }
+  if(autotune_solve(&fit) == 0){
+    model.f_radix_setup_cost__short = fit.arr_coefficients[0];
+    model.f_radix_level_cost__short = fit.arr_coefficients[1];
+    model.f_radix_count_cost__short = fit.arr_coefficients[2];
+    model.f_radix_pass_cost__short = fit.arr_coefficients[3];
+    model.f_radix_instance_cost__short = fit.arr_coefficients[4];
+  }
+  i_crossover__short = autotune_crossover(arr_sizes, i_number_of_sizes, arr_comparison_times__short, arr_radix_times__short);
+  model.i_insertion_threshold__short = autotune_insertion_threshold(&context, 0, i_radix_threshold, i_qsort_threshold);
+
+  printf("Cost model for long cells.\n");
+  fit.i_number_of_rows = 0;
+  fit.i_number_of_columns = 2;
+  for(size_t i_prefix = 0; i_prefix <= 16; i_prefix += 8){
+    for(size_t s = 0; s < i_number_of_sizes; ++s){
+      double f_time = autotune_time(&context, I_SORT_ALGORITHM__COMPARISON, arr_sizes[s], 24, i_prefix);
+      arr_features[0] = ((double)arr_sizes[s]) * autotune_log2(arr_sizes[s]);
+      arr_features[1] = arr_features[0] * i_prefix;
+      autotune_add_row(&fit, arr_features, f_time);
+    }
+  }
+  if(autotune_solve(&fit) == 0 && fit.arr_coefficients[0] > 0.0){
+    model.f_comparison_cost = fit.arr_coefficients[0];
+    model.f_comparison_byte_cost = fit.arr_coefficients[1];
+  }
+  fit.i_number_of_rows = 0;
+  fit.i_number_of_columns = 5;
+  for(size_t i_key_size = 8; i_key_size <= 24; i_key_size += 16){
+    for(size_t i_prefix = 0; i_prefix <= 4; i_prefix += 4){
+      for(size_t s = 0; s < i_number_of_sizes; ++s){
+        double f_time = autotune_time(&context, I_SORT_ALGORITHM__RADIX, arr_sizes[s], i_key_size, i_prefix);
+        if(i_key_size == 24 && i_prefix == 0){
+          arr_radix_times[s] = f_time;
+          arr_comparison_times[s] = autotune_time(&context, I_SORT_ALGORITHM__COMPARISON, arr_sizes[s], 24, 0);
+        }
+        autotune_radix_features(arr_features, arr_sizes[s], i_key_size, i_prefix);
+        autotune_add_row(&fit, arr_features, f_time);
+      }
+    }
+  }
+  if(autotune_solve(&fit) == 0){
+    model.f_radix_setup_cost = fit.arr_coefficients[0];
+    model.f_radix_level_cost = fit.arr_coefficients[1];
+    model.f_radix_count_cost = fit.arr_coefficients[2];
+    model.f_radix_pass_cost = fit.arr_coefficients[3];
+    model.f_radix_instance_cost = fit.arr_coefficients[4];
+  }
+  i_crossover = autotune_crossover(arr_sizes, i_number_of_sizes, arr_comparison_times, arr_radix_times);
+  model.i_insertion_threshold = autotune_insertion_threshold(&context, 1, i_radix_threshold, i_qsort_threshold);
+
+  TSODLULS_free(context.arr_elements__short);
+  TSODLULS_free(context.arr_elements);
+  TSODLULS_free(context.s_keys);
+
+  if(argc == 2){
+    p_output_file = fopen(argv[1], "w");
+    if(p_output_file == NULL){
+      fprintf(stderr, "Could not open %s.\n", argv[1]);
+      return 1;
+    }
+  }
+  gethostname(s_host_name, sizeof(s_host_name) - 1);
+  strftime(s_date, sizeof(s_date), "%Y-%m-%d %H:%M:%S", localtime(&i_time));
+  fprintf(p_output_file, "//This file was generated by autotune on %s for the host %s.\n", s_date, s_host_name);
+  fprintf(p_output_file, "//It is included by TSODLULS.h when the library is compiled with -DTSODLULS_TUNING.\n");
+  fprintf(p_output_file, "#ifndef DEF_TSODLULS_TUNING\n#define DEF_TSODLULS_TUNING\n\n");
+  fprintf(p_output_file, "//Measured crossovers between comparison sort and radix sort on random keys (0 if none):\n");
+  fprintf(p_output_file, "//short cells with 8 bytes keys: %zu elements\n", i_crossover__short);
+  fprintf(p_output_file, "//long cells with 24 bytes keys: %zu elements\n\n", i_crossover);
+  fprintf(p_output_file, "#define I_RADIX_INSERTION_THRESHOLD__SHORT %zu\n", i_radix_threshold);
+  fprintf(p_output_file, "#define I_QSORT_INSERTION_THRESHOLD__SHORT %zu\n\n", i_qsort_threshold);
+  fprintf(p_output_file, "#define I_SORT_MODEL__INSERTION_THRESHOLD %zu\n", model.i_insertion_threshold);
+  fprintf(p_output_file, "#define F_SORT_MODEL__COMPARISON_COST %.4f\n", model.f_comparison_cost);
+  fprintf(p_output_file, "#define F_SORT_MODEL__COMPARISON_BYTE_COST %.4f\n", model.f_comparison_byte_cost);
+  fprintf(p_output_file, "#define F_SORT_MODEL__RADIX_SETUP_COST %.4f\n", model.f_radix_setup_cost);
+  fprintf(p_output_file, "#define F_SORT_MODEL__RADIX_LEVEL_COST %.4f\n", model.f_radix_level_cost);
+  fprintf(p_output_file, "#define F_SORT_MODEL__RADIX_COUNT_COST %.4f\n", model.f_radix_count_cost);
+  fprintf(p_output_file, "#define F_SORT_MODEL__RADIX_PASS_COST %.4f\n", model.f_radix_pass_cost);
+  fprintf(p_output_file, "#define F_SORT_MODEL__RADIX_INSTANCE_COST %.4f\n\n", model.f_radix_instance_cost);
+  fprintf(p_output_file, "#define I_SORT_MODEL__INSERTION_THRESHOLD__SHORT %zu\n", model.i_insertion_threshold__short);
+  fprintf(p_output_file, "#define F_SORT_MODEL__COMPARISON_COST__SHORT %.4f\n", model.f_comparison_cost__short);
+  fprintf(p_output_file, "#define F_SORT_MODEL__RADIX_SETUP_COST__SHORT %.4f\n", model.f_radix_setup_cost__short);
+  fprintf(p_output_file, "#define F_SORT_MODEL__RADIX_LEVEL_COST__SHORT %.4f\n", model.f_radix_level_cost__short);
+  fprintf(p_output_file, "#define F_SORT_MODEL__RADIX_COUNT_COST__SHORT %.4f\n", model.f_radix_count_cost__short);
+  fprintf(p_output_file, "#define F_SORT_MODEL__RADIX_PASS_COST__SHORT %.4f\n", model.f_radix_pass_cost__short);
+  fprintf(p_output_file, "#define F_SORT_MODEL__RADIX_INSTANCE_COST__SHORT %.4f\n\n", model.f_radix_instance_cost__short);
+  fprintf(p_output_file, "#endif\n");
+  if(p_output_file != stdout){
+    fclose(p_output_file);
+    printf("%s written.\n", argv[1]);
+  }
+
+  return 0;
+}//end main()
@@ -0,0 +1,102 @@
+/*
+This file is part of TSODLULS library.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+/*
+Generate the C code of the nextification functions of a TSOD (Tree Structured Order Definition).
+Usage:
+  tsodl_to_c.exe file.tsodl function_name current_type [output_file.c]
+where current_type is the C type of the items of the array to sort (CURRENT in the TSOD).
+The generated code must be included after TSODLULS.h and the definition of current_type.
+*/
+
+#include "../TSODLULS.h"
+
+
+
+int main(int argc, char *argv[]){
+
+  int i_result = 0;
+  FILE* p_input_file = NULL;
+  FILE* p_output_file = stdout;
+  char* s_tsod = NULL;
+  long i_file_size = 0;
+  t_TSODLULS_tsodl_order order;
+
+  if(argc != 4 && argc != 5){
+    fprintf(stderr, "Usage: %s file.tsodl function_name current_type [output_file.c]\n", argv[0]);
+    return 1;
+  }
+
+  do{
+    p_input_file = fopen(argv[1], "rb");
+    if(p_input_file == NULL){
+      i_result = I_ERROR__COULD_NOT_OPEN_FILE;
+      break;
+    }
+    if(fseek(p_input_file, 0, SEEK_END) != 0 || (i_file_size = ftell(p_input_file)) < 0){
+      i_result = I_ERROR__COULD_NOT_OPEN_FILE;
+      break;
+    }
+    rewind(p_input_file);
+    s_tsod = calloc(i_file_size + 1, sizeof(char));
+    if(s_tsod == NULL){
+      i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      break;
+    }
+    if(fread(s_tsod, sizeof(char), i_file_size, p_input_file) != (size_t)i_file_size){
+      i_result = I_ERROR__COULD_NOT_OPEN_FILE;
+      break;
+    }
+
+    i_result = TSODLULS_tsodl_parse(&order, s_tsod);
+    if(i_result != 0){
+      fprintf(stderr, "%s: error %d at offset %zu: %.20s\n", argv[1], i_result, order.i_error_offset, s_tsod + order.i_error_offset);
+      TSODLULS_tsodl_free_order(&order);
+      break;
+    }
+
+    if(argc == 5){
+      p_output_file = fopen(argv[4], "w");
+      if(p_output_file == NULL){
+        i_result = I_ERROR__COULD_NOT_OPEN_FILE;
+        TSODLULS_tsodl_free_order(&order);
+        break;
+      }
+    }
+    fprintf(p_output_file, "//This file was generated by tsodl_to_c from %s.\n\n", argv[1]);
+    i_result = TSODLULS_tsodl_generate_c_code(p_output_file, &order, argv[2], argv[3]);
+    TSODLULS_tsodl_free_order(&order);
+  }
+  while(0);
+
+  if(p_input_file != NULL){
+    fclose(p_input_file);
+  }
+  if(p_output_file != stdout && p_output_file != NULL){
+    if(fclose(p_output_file) != 0 && i_result == 0){
+      i_result = I_ERROR__COULD_NOT_WRITE_CHARACTER;
+    }
+  }
+  if(s_tsod != NULL){
+    TSODLULS_free(s_tsod);
+  }
+  if(i_result != 0){
+    fprintf(stderr, "tsodl_to_c failed with error %d\n", i_result);
+  }
+  return i_result;
+}//end function main()
@@ -264,5 +264,14 @@ int TSODLULS_sort_radix8_count_insertion__short__mark6(
 //------------------------------------------------------------------------------------
 //Padding
 //------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------
+//Sort engines
+//------------------------------------------------------------------------------------
+/**
+ * Sort engines functions
+ * Add the competitor algorithms to the registry of sort engines (see TSODLULS_register_sort_engine()).
+ * Returns I_ERROR__SORT_ENGINE_NAME_ALREADY_USED if they were already registered.
+ */
+int TSODLULS_register_competitor_sort_engines();
 
 #endif
@@ -0,0 +1,101 @@
+/*
+This file is part of TSODLULS library.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+
+#include "TSODLULS__competitor.h"
+
+
+
+//------------------------------------------------------------------------------------
+//Internal functions
+//------------------------------------------------------------------------------------
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_radix8_count__mark1)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_radix8_count_insertion__mark1)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_radix8_count_insertion__mark2)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_radix8_count_insertion__mark3)
+TSODLULS_SORT_ENGINE_FUNCTION__LONG(TSODLULS_sort_radix8_count_insertion__mark4)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count__short__mark1)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count__short__mark2)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count__short__mark3)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count_qsort__short)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count_insertion__short__mark1)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count_insertion__short__mark2)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count_insertion__short__mark3)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count_insertion__short__mark4)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count_insertion__short__mark5)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT(TSODLULS_sort_radix8_count_insertion__short__mark6)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(TSODLULS_qsort_inlined__short_3)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(TSODLULS_qsort_inlined__short_4)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(TSODLULS_qsort_inlined__short_5)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(TSODLULS_qsort_inlined__short_6)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(TSODLULS_qsort_inlined__short_7)
+TSODLULS_SORT_ENGINE_FUNCTION__SHORT_WITHOUT_MAX_LENGTH(TSODLULS_qsort_inlined__short_8)
+
+
+
+/**
+ * The radix sorts with insertion sort are not flagged as stable (see arr_TSODLULS_sort_engines).
+ */
+static const t_TSODLULS_sort_engine arr_TSODLULS_competitor_sort_engines[] = {
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count__mark1, I_CELL_TYPE__LONG, 1),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__mark1, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__mark2, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__mark3, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__mark4, I_CELL_TYPE__LONG, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count__short__mark1, I_CELL_TYPE__SHORT, 1),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count__short__mark2, I_CELL_TYPE__SHORT, 1),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count__short__mark3, I_CELL_TYPE__SHORT, 1),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_qsort__short, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__short__mark1, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__short__mark2, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__short__mark3, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__short__mark4, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__short__mark5, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_sort_radix8_count_insertion__short__mark6, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_qsort_inlined__short_3, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_qsort_inlined__short_4, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_qsort_inlined__short_5, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_qsort_inlined__short_6, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_qsort_inlined__short_7, I_CELL_TYPE__SHORT, 0),
+  TSODLULS_SORT_ENGINE(TSODLULS_qsort_inlined__short_8, I_CELL_TYPE__SHORT, 0),
+};
+
+
+
+//------------------------------------------------------------------------------------
+//External functions
+//------------------------------------------------------------------------------------
+/**
+ * Sort engines functions
+ * Add the competitor algorithms to the registry of sort engines (see TSODLULS_register_sort_engine()).
+ * Returns I_ERROR__SORT_ENGINE_NAME_ALREADY_USED if they were already registered.
+ */
+int TSODLULS_register_competitor_sort_engines(){
+  int i_result = 0;
+  size_t i_number_of_engines = sizeof(arr_TSODLULS_competitor_sort_engines) / sizeof(t_TSODLULS_sort_engine);
+  for(size_t i = 0; i < i_number_of_engines; ++i){
+    i_result = TSODLULS_register_sort_engine(&(arr_TSODLULS_competitor_sort_engines[i]));
+    if(i_result != 0){
+      return i_result;
+    }
+  }
+  return 0;
+}//end function TSODLULS_register_competitor_sort_engines()
+
+
+
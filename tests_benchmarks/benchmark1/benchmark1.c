@@ -45,6 +45,12 @@ The benchmark is performed with 7 settings:
 Each sort is measured with the preparation time if needed.
 n starts at value 1 and is multiplied by two until it reaches n_max.
 
+The seeds are uniform random by default, another distribution can be chosen on the command line:
+  benchmark1.exe [distribution [parameter]]
+where distribution is one of uniform, zipf, few_unique, sorted, reverse_sorted, sawtooth, nearly_sorted,
+gaussian and staggered (see fill_seeds64_with_distribution() in ../test_functions.c).
+The smaller types are converted from the most significant bits of the seeds to keep their order.
+
 This benchmark shares a lot of code with test 2.
 When both files reached more than 2500 lines of code,
 we decided to factor the code using macros in file ../test_macros.c.
@@ -66,6 +72,19 @@ int main(int argc, char *argv[]){
   //i_seed = 1534274833;//bug with doubles (the bug was corrected)
   srand(i_seed);
   printf("Seed: %u\n", i_seed);
+  int i_distribution = I_DISTRIBUTION__UNIFORM;
+  uint64_t i_distribution_parameter = 0;
+  if(argc > 1){
+    i_distribution = get_distribution_from_name(argv[1]);
+    if(i_distribution < 0){
+      printf("Unknown distribution %s\n", argv[1]);
+      return 1;
+    }
+    if(argc > 2){
+      i_distribution_parameter = strtoull(argv[2], NULL, 10);
+    }
+  }
+  printf("Distribution: %s\n", arr_distribution_names[i_distribution]);
 
   uint64_t i;
 
@@ -248,9 +267,7 @@ int main(int argc, char *argv[]){
       }
 
       //generating the seeds
-      for(i = 0; i < i_number_of_elements; ++i){
-        arr_seeds64[i] = get_random_uint64();
-      }
+      fill_seeds64_with_distribution(arr_seeds64, i_number_of_elements, i_distribution, i_distribution_parameter);
 
 
       //sorting uint 8
@@ -267,7 +284,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_ui_8_seed[i] = (uint8_t)arr_seeds64[i];
+        arr_ui_8_seed[i] = (uint8_t)(arr_seeds64[i] >> 56);
       }
 
       memcpy(
@@ -338,7 +355,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_ui_16_seed[i] = (uint16_t)arr_seeds64[i];
+        arr_ui_16_seed[i] = (uint16_t)(arr_seeds64[i] >> 48);
       }
 
       memcpy(
@@ -409,7 +426,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_ui_32_seed[i] = (uint32_t)arr_seeds64[i];
+        arr_ui_32_seed[i] = (uint32_t)(arr_seeds64[i] >> 32);
       }
 
       memcpy(
@@ -552,7 +569,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_i_8_seed[i] = TSODLULS_get_int8_from_uint8((uint8_t)arr_seeds64[i]);
+        arr_i_8_seed[i] = TSODLULS_get_int8_from_uint8((uint8_t)(arr_seeds64[i] >> 56));
       }
 
       memcpy(
@@ -623,7 +640,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_i_16_seed[i] = TSODLULS_get_int16_from_uint16((uint16_t)arr_seeds64[i]);
+        arr_i_16_seed[i] = TSODLULS_get_int16_from_uint16((uint16_t)(arr_seeds64[i] >> 48));
       }
 
       memcpy(
@@ -694,7 +711,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_i_32_seed[i] = TSODLULS_get_int32_from_uint32((uint32_t)arr_seeds64[i]);
+        arr_i_32_seed[i] = TSODLULS_get_int32_from_uint32((uint32_t)(arr_seeds64[i] >> 32));
       }
 
       memcpy(
@@ -836,7 +853,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_f_float_seed[i] = TSODLULS_get_float_from_uint((uint32_t)arr_seeds64[i]);
+        arr_f_float_seed[i] = TSODLULS_get_float_from_uint((uint32_t)(arr_seeds64[i] >> 32));
       }
 
       memcpy(
@@ -0,0 +1,608 @@
+/*
+This file is part of TSODLULS.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+/*
+Explanations for this benchmark:
+This benchmark measures the same types and settings as benchmark1,
+but its output is meant to be read by programs instead of humans.
+Usage:
+  benchmark2.exe [-f csv|json] [-r repetitions] [-w warmup] [-s seed] [-c cpu]
+                 [-n n_min] [-N n_max] [-t types] [-a algorithms] [-d distribution] [-k parameter] [-p]
+where:
+- csv is the default format,
+- each combination of type, algorithm and n is run warmup times (default 2),
+  then it is measured repetitions times (default 11),
+  each repetition sorts other random values,
+- the seed (default 1) makes the runs reproducible:
+  for a given type and n, all the algorithms sort the same values,
+- the process is pinned on the given cpu (default: the current cpu, -1: no pinning),
+- n starts at n_min (default 1) and is multiplied by two until it reaches n_max (default 2^20),
+- types and algorithms are comma-separated lists of names (default: all),
+- the distribution of the values is uniform by default, it can be zipf, few_unique, sorted, reverse_sorted,
+  sawtooth, nearly_sorted, gaussian or staggered, and parameter tunes some of them
+  (see fill_seeds64_with_distribution() in ../test_functions.c),
+- -p adds the hardware performance counters (see ../perf_counters.c).
+The minimum, median and 95th percentile of the times are given in nanoseconds per element.
+With -p, the medians of the cycles, instructions, L1 data cache read misses, last level cache misses,
+branch misses and data TLB read misses per element are given after the times
+(empty in CSV and null in JSON when the counter is not available on this machine).
+Each sort is measured with the preparation time if needed, like in benchmark1.
+
+Types: uint8, uint16, uint32, uint64, int8, int16, int32, int64, float, double.
+Algorithms (the settings of benchmark1):
+- qsort_direct: qsort direct
+- qsort_cells: qsort on TSODLULS cells
+- qsort_cells_macraff: qsort on TSODLULS cells and macraffs
+- qsort_short_cells_macraff: qsort on short TSODLULS cells and macraffs
+- sort_cells: TSODLULS sort on TSODLULS cells
+- sort_cells_macraff: TSODLULS sort on TSODLULS cells and macraffs
+- sort_short_cells_macraff: TSODLULS sort on short TSODLULS cells and macraffs
+*/
+
+#define _GNU_SOURCE
+#include <sched.h>
+#include <unistd.h>
+#include <inttypes.h>
+#include "../test_functions.c"
+#include "../perf_counters.c"
+
+#define I_BENCHMARK2_NUMBER_OF_TYPES 10
+#define I_BENCHMARK2_NUMBER_OF_ALGORITHMS 7
+#define I_BENCHMARK2_FORMAT__CSV 1
+#define I_BENCHMARK2_FORMAT__JSON 2
+
+
+
+/**
+ * Returns 1 if s_name is in the comma-separated list s_list, or if s_list is NULL
+ */
+int benchmark2_is_selected(const char* s_list, const char* s_name){
+  size_t i_length = strlen(s_name);
+  const char* s_current = s_list;
+  if(s_list == NULL){
+    return 1;
+  }
+  while(*s_current != '\0'){
+    if(strncmp(s_current, s_name, i_length) == 0 && (s_current[i_length] == ',' || s_current[i_length] == '\0')){
+      return 1;
+    }
+    s_current = strchr(s_current, ',');
+    if(s_current == NULL){
+      break;
+    }
+    ++s_current;
+  }
+  return 0;
+}//end function benchmark2_is_selected()
+
+
+
+int benchmark2_compare_doubles(const void* a, const void* b){
+  double f_a = *((const double*)a);
+  double f_b = *((const double*)b);
+  return (f_a > f_b) - (f_a < f_b);
+}//end function benchmark2_compare_doubles()
+
+
+
+/**
+ * Sorts the values and returns their median
+ */
+double benchmark2_median(double* arr_values, size_t i_number_of_values){
+  qsort(arr_values, i_number_of_values, sizeof(double), benchmark2_compare_doubles);
+  if(i_number_of_values % 2 == 1){
+    return arr_values[i_number_of_values / 2];
+  }
+  return (arr_values[i_number_of_values / 2 - 1] + arr_values[i_number_of_values / 2]) / 2.0;
+}//end function benchmark2_median()
+
+
+
+/**
+ * The time of one run of an algorithm for one type with the fragments of benchmark1.
+ * The result is in arr_xxx_result1, the seeds were copied into it before for qsort direct.
+ */
+#define benchmark2_code_fragment_run(type, arr_result1, ctype, compare_in_cell, i_max_length) \
+  switch(i_algorithm){\
+    case 0:\
+      qsort(arr_result1, i_number_of_elements, sizeof(ctype), (&TSODLULS_compare_##type##_direct));\
+    break;\
+    case 1:\
+      TSODLULS_code_fragment_init_long_cells_for_##type();\
+      qsort(arr_cells, i_number_of_elements, sizeof(t_TSODLULS_sort_element), (&compare_in_cell));\
+      TSODLULS_code_fragment_fill_result1_with_long_cells_for_##type();\
+    break;\
+    case 2:\
+      TSODLULS_code_fragment_init_long_cells_for_##type##_with_macraffs();\
+      qsort(arr_cells, i_number_of_elements, sizeof(t_TSODLULS_sort_element), (&compare_in_cell));\
+      TSODLULS_code_fragment_fill_result1_with_long_cells_for_##type##_with_macraffs();\
+    break;\
+    case 3:\
+      TSODLULS_code_fragment_init_short_cells_for_##type##_with_macraffs();\
+      qsort(\
+          arr_cells__short,\
+          i_number_of_elements,\
+          sizeof(t_TSODLULS_sort_element__short),\
+          (&TSODLULS_compare_nextified_key_in_cell__short)\
+      );\
+      TSODLULS_code_fragment_fill_result1_with_short_cells_for_##type##_no_macraff_needed();\
+    break;\
+    case 4:\
+      TSODLULS_code_fragment_init_long_cells_for_##type();\
+      i_result = TSODLULS_sort(arr_cells, i_number_of_elements);\
+      TSODLULS_code_fragment_fill_result1_with_long_cells_for_##type();\
+    break;\
+    case 5:\
+      TSODLULS_code_fragment_init_long_cells_for_##type##_with_macraffs();\
+      i_result = TSODLULS_sort(arr_cells, i_number_of_elements);\
+      TSODLULS_code_fragment_fill_result1_with_long_cells_for_##type##_with_macraffs();\
+    break;\
+    default:\
+      TSODLULS_code_fragment_init_short_cells_for_##type##_with_macraffs();\
+      i_result = TSODLULS_sort__short(arr_cells__short, i_number_of_elements, i_max_length);\
+      TSODLULS_code_fragment_fill_result1_with_short_cells_for_##type##_no_macraff_needed();\
+  }
+
+/**
+ * Allocation of the arrays of one type
+ */
+#define benchmark2_code_fragment_allocate(arr_seed, arr_result1, ctype) \
+  arr_seed = calloc(i_number_of_elements, sizeof(ctype));\
+  arr_result1 = calloc(i_number_of_elements, sizeof(ctype));\
+  if(arr_seed == NULL || arr_result1 == NULL){\
+    i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;\
+    break;\
+  }
+
+/**
+ * Conversion of the random seeds to one type
+ */
+#define benchmark2_code_fragment_convert(arr_seed, arr_result1, ctype, conversion) \
+  for(i = 0; i < i_number_of_elements; ++i){\
+    arr_seed[i] = conversion;\
+  }\
+  memcpy(arr_result1, arr_seed, i_number_of_elements * sizeof(ctype));
+
+
+
+int main(int argc, char *argv[]){
+
+  int i_result = 0;
+  unsigned int i_seed = 1;
+  int i_format = I_BENCHMARK2_FORMAT__CSV;
+  size_t i_repetitions = 11;
+  size_t i_warmup = 2;
+  int i_cpu = sched_getcpu();
+  const char* s_types = NULL;
+  const char* s_algorithms = NULL;
+  int i_distribution = I_DISTRIBUTION__UNIFORM;
+  uint64_t i_distribution_parameter = 0;
+  const char* arr_type_names[I_BENCHMARK2_NUMBER_OF_TYPES] = {
+    "uint8", "uint16", "uint32", "uint64", "int8", "int16", "int32", "int64", "float", "double"
+  };
+  const char* arr_algorithm_names[I_BENCHMARK2_NUMBER_OF_ALGORITHMS] = {
+    "qsort_direct",
+    "qsort_cells",
+    "qsort_cells_macraff",
+    "qsort_short_cells_macraff",
+    "sort_cells",
+    "sort_cells_macraff",
+    "sort_short_cells_macraff",
+  };
+  int i_option = 0;
+  int b_first_result = 1;
+  int b_counters = 0;
+  t_perf_counters perf_counters;
+  double arr_counter_medians[I_PERF_COUNTERS__NUMBER];
+
+  uint64_t i;
+
+  //arrays
+  size_t i_number_of_elements = 1;
+  size_t i_number_of_elements_max = 1048576;//2^20
+  double* arr_times = NULL;
+  double* arr_counter_values = NULL;//I_PERF_COUNTERS__NUMBER arrays of i_repetitions values per element
+  uint64_t* arr_seeds64 = NULL;
+  uint8_t* arr_ui_8_seed = NULL;
+  uint8_t* arr_ui_8_result1 = NULL;
+  uint16_t* arr_ui_16_seed = NULL;
+  uint16_t* arr_ui_16_result1 = NULL;
+  uint32_t* arr_ui_32_seed = NULL;
+  uint32_t* arr_ui_32_result1 = NULL;
+  uint64_t* arr_ui_64_seed = NULL;
+  uint64_t* arr_ui_64_result1 = NULL;
+  int8_t* arr_i_8_seed = NULL;
+  int8_t* arr_i_8_result1 = NULL;
+  int16_t* arr_i_16_seed = NULL;
+  int16_t* arr_i_16_result1 = NULL;
+  int32_t* arr_i_32_seed = NULL;
+  int32_t* arr_i_32_result1 = NULL;
+  int64_t* arr_i_64_seed = NULL;
+  int64_t* arr_i_64_result1 = NULL;
+  float* arr_f_float_seed = NULL;
+  float* arr_f_float_result1 = NULL;
+  double* arr_f_double_seed = NULL;
+  double* arr_f_double_result1 = NULL;
+  t_TSODLULS_sort_element* arr_cells = NULL;
+  t_TSODLULS_sort_element__short* arr_cells__short = NULL;
+
+  uint8_t ui8;
+  uint16_t ui16;
+  uint32_t ui32;
+  uint64_t ui64;
+
+  //copy-pasted from TSODLULS__macro.h
+  union ieee754_float TSODLULS_macraff_ieee754_float;
+  union ieee754_double TSODLULS_macraff_ieee754_double;
+  uint8_t TSODLULS_macraff_ui8;
+  uint16_t TSODLULS_macraff_ui16;
+  uint32_t TSODLULS_macraff_ui32;
+  uint64_t TSODLULS_macraff_ui64;
+  int8_t TSODLULS_macraff_i8;
+  int8_t TSODLULS_macraff_i8_2;
+  int8_t TSODLULS_macraff_i8_3;
+  int8_t TSODLULS_macraff_i8_4;
+  int8_t TSODLULS_macraff_i8_5;
+  int8_t TSODLULS_macraff_i8_6;
+  int8_t TSODLULS_macraff_i8_7;
+  int8_t TSODLULS_macraff_i8_8;
+  int8_t TSODLULS_macraff_i8_9;
+  int8_t TSODLULS_macraff_i8_10;
+  int8_t TSODLULS_macraff_i8_11;
+  int8_t TSODLULS_macraff_i8_12;
+  int16_t TSODLULS_macraff_i16;
+  int32_t TSODLULS_macraff_i32;
+  int64_t TSODLULS_macraff_i64;
+  int TSODLULS_macraff_i;
+  size_t TSODLULS_macraff_isize;
+  size_t TSODLULS_macraff_isize_2;
+  size_t TSODLULS_macraff_isize_3;
+  size_t TSODLULS_macraff_isize_4;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element;
+  t_TSODLULS_sort_element* TSODLULS_macraff_p_sort_element_2;
+  t_TSODLULS_sort_element* TSODLULS_macraff_arr_elements;
+  t_TSODLULS_sort_element** TSODLULS_macraff_p_arr_elements;
+  t_TSODLULS_sort_element__short* TSODLULS_macraff_p_sort_element__short;
+  t_TSODLULS_sort_element__short** TSODLULS_macraff_p_arr_elements__short;
+  void* TSODLULS_macraff_p_void;
+
+  struct timespec start, finish;
+
+  while((i_option = getopt(argc, argv, "f:r:w:s:c:n:N:t:a:d:k:p")) != -1){
+    switch(i_option){
+      case 'f':
+        if(strcmp(optarg, "csv") == 0){
+          i_format = I_BENCHMARK2_FORMAT__CSV;
+        }
+        else if(strcmp(optarg, "json") == 0){
+          i_format = I_BENCHMARK2_FORMAT__JSON;
+        }
+        else{
+          fprintf(stderr, "Unknown format %s.\n", optarg);
+          return 1;
+        }
+      break;
+      case 'r':
+        i_repetitions = strtoul(optarg, NULL, 10);
+      break;
+      case 'w':
+        i_warmup = strtoul(optarg, NULL, 10);
+      break;
+      case 's':
+        i_seed = strtoul(optarg, NULL, 10);
+      break;
+      case 'c':
+        i_cpu = atoi(optarg);
+      break;
+      case 'n':
+        i_number_of_elements = strtoul(optarg, NULL, 10);
+      break;
+      case 'N':
+        i_number_of_elements_max = strtoul(optarg, NULL, 10);
+      break;
+      case 't':
+        s_types = optarg;
+      break;
+      case 'a':
+        s_algorithms = optarg;
+      break;
+      case 'd':
+        i_distribution = get_distribution_from_name(optarg);
+        if(i_distribution < 0){
+          fprintf(stderr, "Unknown distribution %s.\n", optarg);
+          return 1;
+        }
+      break;
+      case 'k':
+        i_distribution_parameter = strtoull(optarg, NULL, 10);
+      break;
+      case 'p':
+        b_counters = 1;
+      break;
+      default:
+        fprintf(
+          stderr,
+          "Usage: %s [-f csv|json] [-r repetitions] [-w warmup] [-s seed] [-c cpu]"
+          " [-n n_min] [-N n_max] [-t types] [-a algorithms] [-d distribution] [-k parameter] [-p]\n",
+          argv[0]
+        );
+        return 1;
+    }
+  }
+  if(i_repetitions == 0 || i_number_of_elements == 0){
+    fprintf(stderr, "The number of repetitions and n_min should be positive.\n");
+    return 1;
+  }
+
+  if(i_cpu >= 0){
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(i_cpu, &cpu_set);
+    if(sched_setaffinity(0, sizeof(cpu_set_t), &cpu_set) != 0){
+      fprintf(stderr, "Could not pin the process on cpu %d.\n", i_cpu);
+      return 1;
+    }
+  }
+
+  arr_times = calloc(i_repetitions, sizeof(double));
+  arr_counter_values = calloc(I_PERF_COUNTERS__NUMBER * i_repetitions, sizeof(double));
+  if(arr_times == NULL || arr_counter_values == NULL){
+    fprintf(stderr, "Could not allocate memory.\n");
+    return 1;
+  }
+
+  if(b_counters){
+    int i_number_of_available_counters = perf_counters_open(&perf_counters);
+    if(i_number_of_available_counters < I_PERF_COUNTERS__NUMBER){
+      fprintf(
+        stderr,
+        "Only %d of the %d performance counters are available on this machine.\n",
+        i_number_of_available_counters,
+        I_PERF_COUNTERS__NUMBER
+      );
+    }
+  }
+
+  if(i_format == I_BENCHMARK2_FORMAT__CSV){
+    printf("type,algorithm,n,repetitions,min_ns_per_element,median_ns_per_element,p95_ns_per_element");
+    for(int j = 0; b_counters && j < I_PERF_COUNTERS__NUMBER; ++j){
+      printf(",%s_per_element", perf_counters_get_name(j));
+    }
+    printf("\n");
+  }
+  else{
+    printf(
+      "{\"seed\": %u, \"cpu\": %d, \"repetitions\": %zu, \"warmup\": %zu, \"distribution\": \"%s\", \"parameter\": %" PRIu64 ","
+      " \"unit\": \"ns_per_element\", \"results\": [\n",
+      i_seed, i_cpu, i_repetitions, i_warmup, arr_distribution_names[i_distribution], i_distribution_parameter
+    );
+  }
+
+  while(i_number_of_elements <= i_number_of_elements_max && i_result == 0){
+    for(int i_type = 0; i_type < I_BENCHMARK2_NUMBER_OF_TYPES && i_result == 0; ++i_type){
+      if(!benchmark2_is_selected(s_types, arr_type_names[i_type])){
+        continue;
+      }
+      do{
+        arr_seeds64 = calloc(i_number_of_elements, sizeof(uint64_t));
+        if(arr_seeds64 == NULL){
+          i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+          break;
+        }
+        switch(i_type){
+          case 0: benchmark2_code_fragment_allocate(arr_ui_8_seed, arr_ui_8_result1, uint8_t); break;
+          case 1: benchmark2_code_fragment_allocate(arr_ui_16_seed, arr_ui_16_result1, uint16_t); break;
+          case 2: benchmark2_code_fragment_allocate(arr_ui_32_seed, arr_ui_32_result1, uint32_t); break;
+          case 3: benchmark2_code_fragment_allocate(arr_ui_64_seed, arr_ui_64_result1, uint64_t); break;
+          case 4: benchmark2_code_fragment_allocate(arr_i_8_seed, arr_i_8_result1, int8_t); break;
+          case 5: benchmark2_code_fragment_allocate(arr_i_16_seed, arr_i_16_result1, int16_t); break;
+          case 6: benchmark2_code_fragment_allocate(arr_i_32_seed, arr_i_32_result1, int32_t); break;
+          case 7: benchmark2_code_fragment_allocate(arr_i_64_seed, arr_i_64_result1, int64_t); break;
+          case 8: benchmark2_code_fragment_allocate(arr_f_float_seed, arr_f_float_result1, float); break;
+          default: benchmark2_code_fragment_allocate(arr_f_double_seed, arr_f_double_result1, double);
+        }
+        if(i_result != 0){
+          break;
+        }
+
+        for(int i_algorithm = 0; i_algorithm < I_BENCHMARK2_NUMBER_OF_ALGORITHMS; ++i_algorithm){
+          if(!benchmark2_is_selected(s_algorithms, arr_algorithm_names[i_algorithm])){
+            continue;
+          }
+          //the same values for all the algorithms
+          srand(i_seed);
+          for(size_t r = 0; r < i_warmup + i_repetitions; ++r){
+            fill_seeds64_with_distribution(arr_seeds64, i_number_of_elements, i_distribution, i_distribution_parameter);
+            switch(i_type){
+              case 0:
+                benchmark2_code_fragment_convert(arr_ui_8_seed, arr_ui_8_result1, uint8_t, (uint8_t)(arr_seeds64[i] >> 56));
+              break;
+              case 1:
+                benchmark2_code_fragment_convert(arr_ui_16_seed, arr_ui_16_result1, uint16_t, (uint16_t)(arr_seeds64[i] >> 48));
+              break;
+              case 2:
+                benchmark2_code_fragment_convert(arr_ui_32_seed, arr_ui_32_result1, uint32_t, (uint32_t)(arr_seeds64[i] >> 32));
+              break;
+              case 3:
+                benchmark2_code_fragment_convert(arr_ui_64_seed, arr_ui_64_result1, uint64_t, (uint64_t)arr_seeds64[i]);
+              break;
+              case 4:
+                benchmark2_code_fragment_convert(
+                  arr_i_8_seed, arr_i_8_result1, int8_t, TSODLULS_get_int8_from_uint8((uint8_t)(arr_seeds64[i] >> 56))
+                );
+              break;
+              case 5:
+                benchmark2_code_fragment_convert(
+                  arr_i_16_seed, arr_i_16_result1, int16_t, TSODLULS_get_int16_from_uint16((uint16_t)(arr_seeds64[i] >> 48))
+                );
+              break;
+              case 6:
+                benchmark2_code_fragment_convert(
+                  arr_i_32_seed, arr_i_32_result1, int32_t, TSODLULS_get_int32_from_uint32((uint32_t)(arr_seeds64[i] >> 32))
+                );
+              break;
+              case 7:
+                benchmark2_code_fragment_convert(
+                  arr_i_64_seed, arr_i_64_result1, int64_t, TSODLULS_get_int64_from_uint64((uint64_t)arr_seeds64[i])
+                );
+              break;
+              case 8:
+                benchmark2_code_fragment_convert(
+                  arr_f_float_seed, arr_f_float_result1, float, TSODLULS_get_float_from_uint((uint32_t)(arr_seeds64[i] >> 32))
+                );
+              break;
+              default:
+                benchmark2_code_fragment_convert(
+                  arr_f_double_seed, arr_f_double_result1, double, TSODLULS_get_double_from_uint((uint64_t)arr_seeds64[i])
+                );
+            }
+
+            if(b_counters){
+              perf_counters_start(&perf_counters);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            switch(i_type){
+              case 0: benchmark2_code_fragment_run(uint8, arr_ui_8_result1, uint8_t, TSODLULS_compare_uint8_in_cell, 1); break;
+              case 1: benchmark2_code_fragment_run(uint16, arr_ui_16_result1, uint16_t, TSODLULS_compare_uint16_in_cell, 2); break;
+              case 2: benchmark2_code_fragment_run(uint32, arr_ui_32_result1, uint32_t, TSODLULS_compare_uint32_in_cell, 4); break;
+              case 3: benchmark2_code_fragment_run(uint64, arr_ui_64_result1, uint64_t, TSODLULS_compare_uint64_in_cell, 8); break;
+              case 4: benchmark2_code_fragment_run(int8, arr_i_8_result1, int8_t, TSODLULS_compare_uint8_in_cell, 1); break;
+              case 5: benchmark2_code_fragment_run(int16, arr_i_16_result1, int16_t, TSODLULS_compare_uint16_in_cell, 2); break;
+              case 6: benchmark2_code_fragment_run(int32, arr_i_32_result1, int32_t, TSODLULS_compare_uint32_in_cell, 4); break;
+              case 7: benchmark2_code_fragment_run(int64, arr_i_64_result1, int64_t, TSODLULS_compare_uint64_in_cell, 8); break;
+              case 8: benchmark2_code_fragment_run(float, arr_f_float_result1, float, TSODLULS_compare_uint32_in_cell, 4); break;
+              default: benchmark2_code_fragment_run(double, arr_f_double_result1, double, TSODLULS_compare_uint64_in_cell, 8);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &finish);
+            if(b_counters){
+              perf_counters_stop(&perf_counters);
+            }
+            if(i_result != 0){
+              break;
+            }
+            if(r >= i_warmup){
+              arr_times[r - i_warmup] = (
+                (finish.tv_sec - start.tv_sec) * 1000000000.0 + (finish.tv_nsec - start.tv_nsec)
+              ) / i_number_of_elements;
+              for(int j = 0; b_counters && j < I_PERF_COUNTERS__NUMBER; ++j){
+                arr_counter_values[j * i_repetitions + r - i_warmup] = perf_counters.arr_values[j] < 0.0 ?
+                  -1.0 :
+                  perf_counters.arr_values[j] / i_number_of_elements;
+              }
+            }
+          }//end for(size_t r = 0; r < i_warmup + i_repetitions; ++r)
+          if(i_result != 0){
+            break;
+          }
+
+          //statistics, the 95th percentile is the nearest rank
+          double f_median = benchmark2_median(arr_times, i_repetitions);
+          size_t i_p95 = (95 * i_repetitions + 99) / 100 - 1;
+          for(int j = 0; b_counters && j < I_PERF_COUNTERS__NUMBER; ++j){
+            arr_counter_medians[j] = benchmark2_median(&(arr_counter_values[j * i_repetitions]), i_repetitions);
+            if(arr_counter_values[j * i_repetitions] < 0.0){//unavailable at least once
+              arr_counter_medians[j] = -1.0;
+            }
+          }
+          if(i_format == I_BENCHMARK2_FORMAT__CSV){
+            printf(
+              "%s,%s,%zu,%zu,%.3f,%.3f,%.3f",
+              arr_type_names[i_type], arr_algorithm_names[i_algorithm], i_number_of_elements, i_repetitions,
+              arr_times[0], f_median, arr_times[i_p95]
+            );
+            for(int j = 0; b_counters && j < I_PERF_COUNTERS__NUMBER; ++j){
+              if(arr_counter_medians[j] < 0.0){
+                printf(",");
+              }
+              else{
+                printf(",%.4f", arr_counter_medians[j]);
+              }
+            }
+            printf("\n");
+          }
+          else{
+            printf(
+              "%s  {\"type\": \"%s\", \"algorithm\": \"%s\", \"n\": %zu, \"min\": %.3f, \"median\": %.3f, \"p95\": %.3f",
+              b_first_result ? "" : ",\n",
+              arr_type_names[i_type], arr_algorithm_names[i_algorithm], i_number_of_elements,
+              arr_times[0], f_median, arr_times[i_p95]
+            );
+            for(int j = 0; b_counters && j < I_PERF_COUNTERS__NUMBER; ++j){
+              if(arr_counter_medians[j] < 0.0){
+                printf(", \"%s\": null", perf_counters_get_name(j));
+              }
+              else{
+                printf(", \"%s\": %.4f", perf_counters_get_name(j), arr_counter_medians[j]);
+              }
+            }
+            printf("}");
+            b_first_result = 0;
+          }
+          fflush(stdout);
+        }//end for(int i_algorithm = 0; i_algorithm < I_BENCHMARK2_NUMBER_OF_ALGORITHMS; ++i_algorithm)
+      }
+      while(0);
+
+      if(arr_seeds64 != NULL){ TSODLULS_free(arr_seeds64); }
+      if(arr_ui_8_seed != NULL){ TSODLULS_free(arr_ui_8_seed); }
+      if(arr_ui_8_result1 != NULL){ TSODLULS_free(arr_ui_8_result1); }
+      if(arr_ui_16_seed != NULL){ TSODLULS_free(arr_ui_16_seed); }
+      if(arr_ui_16_result1 != NULL){ TSODLULS_free(arr_ui_16_result1); }
+      if(arr_ui_32_seed != NULL){ TSODLULS_free(arr_ui_32_seed); }
+      if(arr_ui_32_result1 != NULL){ TSODLULS_free(arr_ui_32_result1); }
+      if(arr_ui_64_seed != NULL){ TSODLULS_free(arr_ui_64_seed); }
+      if(arr_ui_64_result1 != NULL){ TSODLULS_free(arr_ui_64_result1); }
+      if(arr_i_8_seed != NULL){ TSODLULS_free(arr_i_8_seed); }
+      if(arr_i_8_result1 != NULL){ TSODLULS_free(arr_i_8_result1); }
+      if(arr_i_16_seed != NULL){ TSODLULS_free(arr_i_16_seed); }
+      if(arr_i_16_result1 != NULL){ TSODLULS_free(arr_i_16_result1); }
+      if(arr_i_32_seed != NULL){ TSODLULS_free(arr_i_32_seed); }
+      if(arr_i_32_result1 != NULL){ TSODLULS_free(arr_i_32_result1); }
+      if(arr_i_64_seed != NULL){ TSODLULS_free(arr_i_64_seed); }
+      if(arr_i_64_result1 != NULL){ TSODLULS_free(arr_i_64_result1); }
+      if(arr_f_float_seed != NULL){ TSODLULS_free(arr_f_float_seed); }
+      if(arr_f_float_result1 != NULL){ TSODLULS_free(arr_f_float_result1); }
+      if(arr_f_double_seed != NULL){ TSODLULS_free(arr_f_double_seed); }
+      if(arr_f_double_result1 != NULL){ TSODLULS_free(arr_f_double_result1); }
+      if(arr_cells != NULL){
+        for(i = 0; i < i_number_of_elements; ++i){
+          TSODLULS_free_key__macraff(&(arr_cells[i]));
+        }
+        TSODLULS_free(arr_cells);
+      }
+      if(arr_cells__short != NULL){
+        TSODLULS_free(arr_cells__short);
+      }
+    }//end for(int i_type = 0; i_type < I_BENCHMARK2_NUMBER_OF_TYPES && i_result == 0; ++i_type)
+    i_number_of_elements = i_number_of_elements << 1;
+  }//end while(i_number_of_elements <= i_number_of_elements_max && i_result == 0)
+
+  if(i_format == I_BENCHMARK2_FORMAT__JSON){
+    printf("\n]}\n");
+  }
+  TSODLULS_free(arr_times);
+  TSODLULS_free(arr_counter_values);
+  if(b_counters){
+    perf_counters_close(&perf_counters);
+  }
+  if(i_result != 0){
+    fprintf(stderr, "Benchmark failed with error %d.\n", i_result);
+  }
+
+  return i_result;
+}//end function main()
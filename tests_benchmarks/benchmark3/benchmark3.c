@@ -0,0 +1,355 @@
+/*
+This file is part of TSODLULS.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+/*
+Explanations for this benchmark:
+This benchmark runs any sort engine of the registry (see TSODLULS_find_sort_engine()),
+including the competitor algorithms, chosen by name at runtime.
+Usage:
+  benchmark3.exe -l
+  benchmark3.exe [-e engines] [-r repetitions] [-s seed] [-n n_min] [-N n_max] [-d distribution] [-k parameter]
+where:
+- -l lists the engines with their cell type and whether they are stable,
+- engines is a comma-separated list of names (default: all),
+- each combination of engine and n is measured repetitions times (default 11),
+  each repetition sorts other random uint64 values,
+- the seed (default 1) makes the runs reproducible:
+  for a given n, all the engines sort the same values,
+- n starts at n_min (default 1) and is multiplied by two until it reaches n_max (default 2^20),
+- the distribution of the values is uniform by default (see fill_seeds64_with_distribution() in ../test_functions.c).
+The cells are filled before the measure, only the sort is measured.
+The minimum and median of the times are given in nanoseconds per element in CSV.
+Each result is checked: the keys must be sorted, and equal keys must keep their order with stable engines.
+*/
+
+#include <unistd.h>
+#include "../test_functions.c"
+#include "../../competitor_algorithms/TSODLULS__competitor.h"
+
+
+
+int benchmark3_is_selected(const char* s_list, const char* s_name){
+  size_t i_length = strlen(s_name);
+  const char* s_current = s_list;
+  if(s_list == NULL){
+    return 1;
+  }
+  while(*s_current != '\0'){
+    if(strncmp(s_current, s_name, i_length) == 0 && (s_current[i_length] == ',' || s_current[i_length] == '\0')){
+      return 1;
+    }
+    s_current = strchr(s_current, ',');
+    if(s_current == NULL){
+      break;
+    }
+    ++s_current;
+  }
+  return 0;
+}//end function benchmark3_is_selected()
+
+
+
+int benchmark3_compare_doubles(const void* a, const void* b){
+  double f_a = *((const double*)a);
+  double f_b = *((const double*)b);
+  return (f_a > f_b) - (f_a < f_b);
+}//end function benchmark3_compare_doubles()
+
+
+
+/**
+ * Fills the cells of the engine with the seeds, p_object is the index of the seed.
+ */
+int benchmark3_fill_cells(
+  const t_TSODLULS_sort_engine* p_engine,
+  t_TSODLULS_sort_element* arr_cells,
+  t_TSODLULS_sort_element__short* arr_cells__short,
+  uint64_t* arr_seeds64,
+  size_t i_number_of_elements
+){
+  int i_result = 0;
+  for(size_t i = 0; i < i_number_of_elements; ++i){
+    if(p_engine->i_cell_type == I_CELL_TYPE__SHORT){
+      arr_cells__short[i].i_key = arr_seeds64[i];
+      arr_cells__short[i].p_object = (void*)i;
+      continue;
+    }
+    arr_cells[i].i_key_size = 0;
+    i_result = TSODLULS_add_bytes_to_key_from_uint64(&(arr_cells[i]), arr_seeds64[i], 0, 0, 0, 0, 8, 0);
+    if(i_result != 0){
+      return i_result;
+    }
+    arr_cells[i].p_object = (void*)i;
+  }
+  return 0;
+}//end function benchmark3_fill_cells()
+
+
+
+/**
+ * Returns 0 if the cells are sorted according to the seeds,
+ * 1 if they are not sorted, 2 if equal keys did not keep their order with a stable engine
+ */
+int benchmark3_check_cells(
+  const t_TSODLULS_sort_engine* p_engine,
+  t_TSODLULS_sort_element* arr_cells,
+  t_TSODLULS_sort_element__short* arr_cells__short,
+  uint64_t* arr_seeds64,
+  size_t i_number_of_elements
+){
+  size_t i_previous = 0;
+  size_t i_current = 0;
+  for(size_t i = 1; i < i_number_of_elements; ++i){
+    if(p_engine->i_cell_type == I_CELL_TYPE__SHORT){
+      i_previous = (size_t)arr_cells__short[i - 1].p_object;
+      i_current = (size_t)arr_cells__short[i].p_object;
+    }
+    else{
+      i_previous = (size_t)arr_cells[i - 1].p_object;
+      i_current = (size_t)arr_cells[i].p_object;
+    }
+    if(arr_seeds64[i_previous] > arr_seeds64[i_current]){
+      return 1;
+    }
+    if(p_engine->b_stable && arr_seeds64[i_previous] == arr_seeds64[i_current] && i_previous > i_current){
+      return 2;
+    }
+  }
+  return 0;
+}//end function benchmark3_check_cells()
+
+
+
+int main(int argc, char *argv[]){
+
+  int i_result = 0;
+  unsigned int i_seed = 1;
+  size_t i_repetitions = 11;
+  const char* s_engines = NULL;
+  int i_distribution = I_DISTRIBUTION__UNIFORM;
+  uint64_t i_distribution_parameter = 0;
+  int i_option = 0;
+  int b_list = 0;
+  size_t i_number_of_elements = 1;
+  size_t i_number_of_elements_max = 1048576;//2^20
+  size_t i_number_of_engines = 0;
+  double* arr_times = NULL;
+  uint64_t* arr_seeds64 = NULL;
+  t_TSODLULS_sort_element* arr_cells = NULL;
+  t_TSODLULS_sort_element__short* arr_cells__short = NULL;
+  const t_TSODLULS_sort_engine* p_engine = NULL;
+
+  struct timespec start, finish;
+
+  while((i_option = getopt(argc, argv, "le:r:s:n:N:d:k:")) != -1){
+    switch(i_option){
+      case 'l':
+        b_list = 1;
+      break;
+      case 'e':
+        s_engines = optarg;
+      break;
+      case 'r':
+        i_repetitions = strtoul(optarg, NULL, 10);
+      break;
+      case 's':
+        i_seed = strtoul(optarg, NULL, 10);
+      break;
+      case 'n':
+        i_number_of_elements = strtoul(optarg, NULL, 10);
+      break;
+      case 'N':
+        i_number_of_elements_max = strtoul(optarg, NULL, 10);
+      break;
+      case 'd':
+        i_distribution = get_distribution_from_name(optarg);
+        if(i_distribution < 0){
+          fprintf(stderr, "Unknown distribution %s.\n", optarg);
+          return 1;
+        }
+      break;
+      case 'k':
+        i_distribution_parameter = strtoull(optarg, NULL, 10);
+      break;
+      default:
+        fprintf(
+          stderr,
+          "Usage: %s -l\n"
+          "       %s [-e engines] [-r repetitions] [-s seed] [-n n_min] [-N n_max] [-d distribution] [-k parameter]\n",
+          argv[0],
+          argv[0]
+        );
+        return 1;
+    }
+  }
+  if(i_repetitions == 0 || i_number_of_elements == 0){
+    fprintf(stderr, "The number of repetitions and n_min should be positive.\n");
+    return 1;
+  }
+
+  i_result = TSODLULS_register_competitor_sort_engines();
+  if(i_result != 0){
+    fprintf(stderr, "Could not register the competitor sort engines: error %d.\n", i_result);
+    return 1;
+  }
+  i_number_of_engines = TSODLULS_get_number_of_sort_engines();
+
+  if(b_list){
+    printf("engine,cell_type,stable\n");
+    for(size_t i_engine = 0; i_engine < i_number_of_engines; ++i_engine){
+      p_engine = TSODLULS_get_sort_engine(i_engine);
+      printf(
+        "%s,%s,%u\n",
+        p_engine->s_name,
+        p_engine->i_cell_type == I_CELL_TYPE__SHORT ? "short" : "long",
+        p_engine->b_stable
+      );
+    }
+    TSODLULS_free_registered_sort_engines();
+    return 0;
+  }
+
+  if(s_engines != NULL){//all the names in the list should be known
+    const char* s_current = s_engines;
+    char s_name[256];
+    while(*s_current != '\0'){
+      size_t i_length = strcspn(s_current, ",");
+      if(i_length >= sizeof(s_name)){
+        i_length = sizeof(s_name) - 1;
+      }
+      memcpy(s_name, s_current, i_length);
+      s_name[i_length] = '\0';
+      if(TSODLULS_find_sort_engine(s_name) == NULL){
+        fprintf(stderr, "Unknown sort engine %s (see -l).\n", s_name);
+        return 1;
+      }
+      s_current += strcspn(s_current, ",");
+      if(*s_current == ','){
+        ++s_current;
+      }
+    }
+  }
+
+  arr_times = calloc(i_repetitions, sizeof(double));
+  if(arr_times == NULL){
+    fprintf(stderr, "Could not allocate memory.\n");
+    return 1;
+  }
+
+  printf("engine,cell_type,n,repetitions,min_ns_per_element,median_ns_per_element\n");
+
+  while(i_number_of_elements <= i_number_of_elements_max && i_result == 0){
+    do{
+      arr_seeds64 = calloc(i_number_of_elements, sizeof(uint64_t));
+      if(arr_seeds64 == NULL){
+        i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+        break;
+      }
+      i_result = TSODLULS_init_array_of_elements(&arr_cells, i_number_of_elements);
+      if(i_result != 0){
+        break;
+      }
+      i_result = TSODLULS_init_array_of_elements__short(&arr_cells__short, i_number_of_elements);
+      if(i_result != 0){
+        break;
+      }
+      for(size_t i_engine = 0; i_engine < i_number_of_engines && i_result == 0; ++i_engine){
+        p_engine = TSODLULS_get_sort_engine(i_engine);
+        if(!benchmark3_is_selected(s_engines, p_engine->s_name)){
+          continue;
+        }
+        srand(i_seed);
+        for(size_t i_repetition = 0; i_repetition < i_repetitions; ++i_repetition){
+          i_result = fill_seeds64_with_distribution(
+              arr_seeds64,
+              i_number_of_elements,
+              i_distribution,
+              i_distribution_parameter
+          );
+          if(i_result != 0){
+            break;
+          }
+          i_result = benchmark3_fill_cells(p_engine, arr_cells, arr_cells__short, arr_seeds64, i_number_of_elements);
+          if(i_result != 0){
+            break;
+          }
+          clock_gettime(CLOCK_MONOTONIC, &start);
+          i_result = p_engine->f_sort(
+              p_engine->i_cell_type == I_CELL_TYPE__SHORT ? (void*)arr_cells__short : (void*)arr_cells,
+              i_number_of_elements,
+              8
+          );
+          clock_gettime(CLOCK_MONOTONIC, &finish);
+          if(i_result != 0){
+            fprintf(stderr, "The sort engine %s failed: error %d.\n", p_engine->s_name, i_result);
+            break;
+          }
+          i_result = benchmark3_check_cells(p_engine, arr_cells, arr_cells__short, arr_seeds64, i_number_of_elements);
+          if(i_result != 0){
+            fprintf(
+              stderr,
+              "The sort engine %s %s for n = %zu.\n",
+              p_engine->s_name,
+              i_result == 1 ? "did not sort correctly" : "is flagged as stable but did not keep the order of equal keys",
+              i_number_of_elements
+            );
+            break;
+          }
+          arr_times[i_repetition] = (
+            ((double)(finish.tv_sec - start.tv_sec)) * 1000000000.0
+            + (finish.tv_nsec - start.tv_nsec)
+          ) / i_number_of_elements;
+        }
+        if(i_result != 0){
+          break;
+        }
+        qsort(arr_times, i_repetitions, sizeof(double), benchmark3_compare_doubles);
+        printf(
+          "%s,%s,%zu,%zu,%.3f,%.3f\n",
+          p_engine->s_name,
+          p_engine->i_cell_type == I_CELL_TYPE__SHORT ? "short" : "long",
+          i_number_of_elements,
+          i_repetitions,
+          arr_times[0],
+          i_repetitions % 2 == 1 ?
+              arr_times[i_repetitions / 2]
+              : (arr_times[i_repetitions / 2 - 1] + arr_times[i_repetitions / 2]) / 2.0
+        );
+      }
+    }
+    while(0);
+    if(arr_cells != NULL){
+      TSODLULS_free_keys_in_array_of_elements(arr_cells, i_number_of_elements);
+      free(arr_cells);
+      arr_cells = NULL;
+    }
+    free(arr_cells__short);
+    arr_cells__short = NULL;
+    free(arr_seeds64);
+    arr_seeds64 = NULL;
+    i_number_of_elements = i_number_of_elements << 1;
+  }
+
+  free(arr_times);
+  TSODLULS_free_registered_sort_engines();
+  if(i_result != 0){
+    fprintf(stderr, "Benchmark 3 failed: error %d.\n", i_result);
+    return 1;
+  }
+  return 0;
+}//end main()
@@ -0,0 +1,345 @@
+/*
+This file is part of TSODLULS.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+/*
+Explanations for this benchmark:
+This benchmark measures the throughput of many small sorts, like when each group of a big set
+is sorted on its own: the setup costs of the engines (allocations, counters, stacks, etc.) dominate there.
+Any sort engine of the registry can be measured (see ../benchmark3/benchmark3.c).
+Usage:
+  benchmark4.exe [-e engines] [-n sizes] [-E elements] [-r repetitions] [-s seed] [-d distribution] [-k parameter]
+where:
+- engines is a comma-separated list of names of sort engines (default: all, see benchmark3.exe -l),
+- sizes is a comma-separated list of sizes of the small sorts (default: 8,16,32,64,128,256,512,1000,2000),
+- for each size n, elements / n independent arrays of n cells are sorted one after the other
+  (default: 2^20 elements), the cells of all the arrays are filled before the measure,
+- each batch of sorts is measured repetitions times (default 11) on the same values,
+- the seed (default 1) makes the runs reproducible: all the engines sort the same values,
+- the distribution of the values is uniform by default (see fill_seeds64_with_distribution() in ../test_functions.c).
+The median throughput is given in sorts per second, with the median and minimum times per sort
+and the median time per element in nanoseconds, in CSV.
+The result of each small sort is checked once.
+*/
+
+#include <unistd.h>
+#include "../test_functions.c"
+#include "../../competitor_algorithms/TSODLULS__competitor.h"
+
+#define I_BENCHMARK4_MAX_NUMBER_OF_SIZES 64
+
+
+
+int benchmark4_is_selected(const char* s_list, const char* s_name){
+  size_t i_length = strlen(s_name);
+  const char* s_current = s_list;
+  if(s_list == NULL){
+    return 1;
+  }
+  while(*s_current != '\0'){
+    if(strncmp(s_current, s_name, i_length) == 0 && (s_current[i_length] == ',' || s_current[i_length] == '\0')){
+      return 1;
+    }
+    s_current = strchr(s_current, ',');
+    if(s_current == NULL){
+      break;
+    }
+    ++s_current;
+  }
+  return 0;
+}//end function benchmark4_is_selected()
+
+
+
+int benchmark4_compare_doubles(const void* a, const void* b){
+  double f_a = *((const double*)a);
+  double f_b = *((const double*)b);
+  return (f_a > f_b) - (f_a < f_b);
+}//end function benchmark4_compare_doubles()
+
+
+
+/**
+ * Returns 0 if each small array of cells is sorted according to the seeds.
+ * p_object is the index of the seed in the whole batch.
+ */
+int benchmark4_check_cells(
+  const t_TSODLULS_sort_engine* p_engine,
+  t_TSODLULS_sort_element* arr_cells,
+  t_TSODLULS_sort_element__short* arr_cells__short,
+  uint64_t* arr_seeds64,
+  size_t i_number_of_sorts,
+  size_t i_number_of_elements
+){
+  size_t i_previous = 0;
+  size_t i_current = 0;
+  for(size_t i_sort = 0; i_sort < i_number_of_sorts; ++i_sort){
+    size_t i_first = i_sort * i_number_of_elements;
+    for(size_t i = i_first + 1; i < i_first + i_number_of_elements; ++i){
+      if(p_engine->i_cell_type == I_CELL_TYPE__SHORT){
+        i_previous = (size_t)arr_cells__short[i - 1].p_object;
+        i_current = (size_t)arr_cells__short[i].p_object;
+      }
+      else{
+        i_previous = (size_t)arr_cells[i - 1].p_object;
+        i_current = (size_t)arr_cells[i].p_object;
+      }
+      if(arr_seeds64[i_previous] > arr_seeds64[i_current]){
+        return 1;
+      }
+    }
+  }
+  return 0;
+}//end function benchmark4_check_cells()
+
+
+
+int main(int argc, char *argv[]){
+
+  int i_result = 0;
+  unsigned int i_seed = 1;
+  size_t i_repetitions = 11;
+  size_t i_number_of_elements_per_batch = 1048576;//2^20
+  const char* s_engines = NULL;
+  const char* s_sizes = "8,16,32,64,128,256,512,1000,2000";
+  int i_distribution = I_DISTRIBUTION__UNIFORM;
+  uint64_t i_distribution_parameter = 0;
+  int i_option = 0;
+  size_t arr_sizes[I_BENCHMARK4_MAX_NUMBER_OF_SIZES];
+  size_t i_number_of_sizes = 0;
+  size_t i_number_of_engines = 0;
+  size_t i_number_of_elements = 0;
+  size_t i_number_of_sorts = 0;
+  size_t i_number_of_cells = 0;
+  double f_median = 0.0;
+  double* arr_times = NULL;
+  uint64_t* arr_seeds64 = NULL;
+  t_TSODLULS_sort_element* arr_cells_seed = NULL;
+  t_TSODLULS_sort_element* arr_cells = NULL;
+  t_TSODLULS_sort_element__short* arr_cells__short_seed = NULL;
+  t_TSODLULS_sort_element__short* arr_cells__short = NULL;
+  const t_TSODLULS_sort_engine* p_engine = NULL;
+  const char* s_current = NULL;
+
+  struct timespec start, finish;
+
+  while((i_option = getopt(argc, argv, "e:n:E:r:s:d:k:")) != -1){
+    switch(i_option){
+      case 'e':
+        s_engines = optarg;
+      break;
+      case 'n':
+        s_sizes = optarg;
+      break;
+      case 'E':
+        i_number_of_elements_per_batch = strtoul(optarg, NULL, 10);
+      break;
+      case 'r':
+        i_repetitions = strtoul(optarg, NULL, 10);
+      break;
+      case 's':
+        i_seed = strtoul(optarg, NULL, 10);
+      break;
+      case 'd':
+        i_distribution = get_distribution_from_name(optarg);
+        if(i_distribution < 0){
+          fprintf(stderr, "Unknown distribution %s.\n", optarg);
+          return 1;
+        }
+      break;
+      case 'k':
+        i_distribution_parameter = strtoull(optarg, NULL, 10);
+      break;
+      default:
+        fprintf(
+          stderr,
+          "Usage: %s [-e engines] [-n sizes] [-E elements] [-r repetitions] [-s seed] [-d distribution] [-k parameter]\n",
+          argv[0]
+        );
+        return 1;
+    }
+  }
+
+  s_current = s_sizes;
+  while(*s_current != '\0' && i_number_of_sizes < I_BENCHMARK4_MAX_NUMBER_OF_SIZES){
+    arr_sizes[i_number_of_sizes] = strtoul(s_current, NULL, 10);
+    if(arr_sizes[i_number_of_sizes] == 0 || arr_sizes[i_number_of_sizes] > i_number_of_elements_per_batch){
+      fprintf(stderr, "The sizes should be positive and at most the number of elements.\n");
+      return 1;
+    }
+    ++i_number_of_sizes;
+    s_current += strcspn(s_current, ",");
+    if(*s_current == ','){
+      ++s_current;
+    }
+  }
+  if(i_repetitions == 0 || i_number_of_sizes == 0){
+    fprintf(stderr, "The number of repetitions and the sizes should be positive.\n");
+    return 1;
+  }
+
+  i_result = TSODLULS_register_competitor_sort_engines();
+  if(i_result != 0){
+    fprintf(stderr, "Could not register the competitor sort engines: error %d.\n", i_result);
+    return 1;
+  }
+  i_number_of_engines = TSODLULS_get_number_of_sort_engines();
+
+  arr_times = calloc(i_repetitions, sizeof(double));
+  if(arr_times == NULL){
+    fprintf(stderr, "Could not allocate memory.\n");
+    return 1;
+  }
+
+  printf(
+    "engine,cell_type,n,sorts,repetitions,median_sorts_per_second,median_ns_per_sort,min_ns_per_sort,median_ns_per_element\n"
+  );
+
+  for(size_t i_size = 0; i_size < i_number_of_sizes && i_result == 0; ++i_size){
+    i_number_of_elements = arr_sizes[i_size];
+    i_number_of_sorts = i_number_of_elements_per_batch / i_number_of_elements;
+    i_number_of_cells = i_number_of_sorts * i_number_of_elements;
+    do{
+      //the cells of the whole batch are filled once, and copied before each measure
+      arr_seeds64 = calloc(i_number_of_cells, sizeof(uint64_t));
+      arr_cells__short_seed = calloc(i_number_of_cells, sizeof(t_TSODLULS_sort_element__short));
+      arr_cells__short = calloc(i_number_of_cells, sizeof(t_TSODLULS_sort_element__short));
+      arr_cells = calloc(i_number_of_cells, sizeof(t_TSODLULS_sort_element));
+      if(arr_seeds64 == NULL || arr_cells__short_seed == NULL || arr_cells__short == NULL || arr_cells == NULL){
+        i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+        break;
+      }
+      i_result = TSODLULS_init_array_of_elements(&arr_cells_seed, i_number_of_cells);
+      if(i_result != 0){
+        break;
+      }
+      srand(i_seed);
+      for(size_t i_sort = 0; i_sort < i_number_of_sorts; ++i_sort){
+        i_result = fill_seeds64_with_distribution(
+            &(arr_seeds64[i_sort * i_number_of_elements]),
+            i_number_of_elements,
+            i_distribution,
+            i_distribution_parameter
+        );
+        if(i_result != 0){
+          break;
+        }
+      }
+      if(i_result != 0){
+        break;
+      }
+      for(size_t i = 0; i < i_number_of_cells; ++i){
+        arr_cells__short_seed[i].i_key = arr_seeds64[i];
+        arr_cells__short_seed[i].p_object = (void*)i;
+        i_result = TSODLULS_add_bytes_to_key_from_uint64(&(arr_cells_seed[i]), arr_seeds64[i], 0, 0, 0, 0, 8, 0);
+        if(i_result != 0){
+          break;
+        }
+        arr_cells_seed[i].p_object = (void*)i;
+      }
+      if(i_result != 0){
+        break;
+      }
+
+      for(size_t i_engine = 0; i_engine < i_number_of_engines && i_result == 0; ++i_engine){
+        p_engine = TSODLULS_get_sort_engine(i_engine);
+        if(!benchmark4_is_selected(s_engines, p_engine->s_name)){
+          continue;
+        }
+        for(size_t i_repetition = 0; i_repetition < i_repetitions; ++i_repetition){
+          //the sorts only move the cells, the keys of the long cells stay in place
+          if(p_engine->i_cell_type == I_CELL_TYPE__SHORT){
+            memcpy(arr_cells__short, arr_cells__short_seed, i_number_of_cells * sizeof(t_TSODLULS_sort_element__short));
+          }
+          else{
+            memcpy(arr_cells, arr_cells_seed, i_number_of_cells * sizeof(t_TSODLULS_sort_element));
+          }
+          clock_gettime(CLOCK_MONOTONIC, &start);
+          if(p_engine->i_cell_type == I_CELL_TYPE__SHORT){
+            for(size_t i_sort = 0; i_sort < i_number_of_sorts && i_result == 0; ++i_sort){
+              i_result = p_engine->f_sort(&(arr_cells__short[i_sort * i_number_of_elements]), i_number_of_elements, 8);
+            }
+          }
+          else{
+            for(size_t i_sort = 0; i_sort < i_number_of_sorts && i_result == 0; ++i_sort){
+              i_result = p_engine->f_sort(&(arr_cells[i_sort * i_number_of_elements]), i_number_of_elements, 8);
+            }
+          }
+          clock_gettime(CLOCK_MONOTONIC, &finish);
+          if(i_result != 0){
+            fprintf(stderr, "The sort engine %s failed: error %d.\n", p_engine->s_name, i_result);
+            break;
+          }
+          if(i_repetition == 0
+            && benchmark4_check_cells(
+                 p_engine, arr_cells, arr_cells__short, arr_seeds64, i_number_of_sorts, i_number_of_elements
+               ) != 0
+          ){
+            fprintf(stderr, "The sort engine %s did not sort correctly for n = %zu.\n", p_engine->s_name, i_number_of_elements);
+            i_result = 1;
+            break;
+          }
+          arr_times[i_repetition] = (
+            ((double)(finish.tv_sec - start.tv_sec)) * 1000000000.0
+            + (finish.tv_nsec - start.tv_nsec)
+          ) / i_number_of_sorts;
+        }
+        if(i_result != 0){
+          break;
+        }
+        qsort(arr_times, i_repetitions, sizeof(double), benchmark4_compare_doubles);
+        f_median = i_repetitions % 2 == 1 ?
+            arr_times[i_repetitions / 2]
+            : (arr_times[i_repetitions / 2 - 1] + arr_times[i_repetitions / 2]) / 2.0;
+        printf(
+          "%s,%s,%zu,%zu,%zu,%.0f,%.3f,%.3f,%.3f\n",
+          p_engine->s_name,
+          p_engine->i_cell_type == I_CELL_TYPE__SHORT ? "short" : "long",
+          i_number_of_elements,
+          i_number_of_sorts,
+          i_repetitions,
+          f_median > 0.0 ? 1000000000.0 / f_median : 0.0,
+          f_median,
+          arr_times[0],
+          f_median / i_number_of_elements
+        );
+      }
+    }
+    while(0);
+    if(arr_cells_seed != NULL){
+      TSODLULS_free_keys_in_array_of_elements(arr_cells_seed, i_number_of_cells);
+      free(arr_cells_seed);
+      arr_cells_seed = NULL;
+    }
+    free(arr_cells);
+    arr_cells = NULL;
+    free(arr_cells__short);
+    arr_cells__short = NULL;
+    free(arr_cells__short_seed);
+    arr_cells__short_seed = NULL;
+    free(arr_seeds64);
+    arr_seeds64 = NULL;
+  }
+
+  free(arr_times);
+  TSODLULS_free_registered_sort_engines();
+  if(i_result != 0){
+    fprintf(stderr, "Benchmark 4 failed: error %d.\n", i_result);
+    return 1;
+  }
+  return 0;
+}//end main()
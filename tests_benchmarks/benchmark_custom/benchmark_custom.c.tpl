@@ -35,6 +35,8 @@ This benchmark applies recursively test2 :
 
 Each sort is measured with the preparation time if needed.
 n starts at value 1 and is multiplied by two until it reaches n_max.
+The seeds follow the chosen distribution (see fill_seeds64_with_distribution() in ../test_functions.c),
+the smaller types are converted from the most significant bits of the seeds to keep their order.
 
 */
 
@@ -56,6 +58,8 @@ int main(int argc, char *argv[]){
   //arrays
   //size_t i_number_of_elements = 1;
   size_t i_number_of_elements = @iNumberOfElementsMin@;//Your choice
+  int i_distribution = @iDistribution@;//Your choice
+  uint64_t i_distribution_parameter = @iDistributionParameter@;//Your choice
   //size_t i_number_of_elements_max = 1024;//2^10
   //size_t i_number_of_elements_max = 1048576;//2^20
   //size_t i_number_of_elements_max = 33554432;//2^25
@@ -184,9 +188,7 @@ int main(int argc, char *argv[]){
       }
 
       //generating the seeds
-      for(i = 0; i < i_number_of_elements; ++i){
-        arr_seeds64[i] = get_random_uint64();
-      }
+      fill_seeds64_with_distribution(arr_seeds64, i_number_of_elements, i_distribution, i_distribution_parameter);
 
 
       //sorting uint 8
@@ -203,7 +205,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_ui_8_seed[i] = (uint8_t)arr_seeds64[i];
+        arr_ui_8_seed[i] = (uint8_t)(arr_seeds64[i] >> 56);
       }
 
       PHP__INCLUDE_BENCHMARK_CODE_FOR_CHOSEN_ALGORITHMS__uint8
@@ -226,7 +228,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_ui_16_seed[i] = (uint16_t)arr_seeds64[i];
+        arr_ui_16_seed[i] = (uint16_t)(arr_seeds64[i] >> 48);
       }
 
       PHP__INCLUDE_BENCHMARK_CODE_FOR_CHOSEN_ALGORITHMS__uint16
@@ -249,7 +251,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_ui_32_seed[i] = (uint32_t)arr_seeds64[i];
+        arr_ui_32_seed[i] = (uint32_t)(arr_seeds64[i] >> 32);
       }
 
       PHP__INCLUDE_BENCHMARK_CODE_FOR_CHOSEN_ALGORITHMS__uint32
@@ -296,7 +298,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_i_8_seed[i] = TSODLULS_get_int8_from_uint8((uint8_t)arr_seeds64[i]);
+        arr_i_8_seed[i] = TSODLULS_get_int8_from_uint8((uint8_t)(arr_seeds64[i] >> 56));
       }
 
       PHP__INCLUDE_BENCHMARK_CODE_FOR_CHOSEN_ALGORITHMS__int8
@@ -319,7 +321,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_i_16_seed[i] = TSODLULS_get_int16_from_uint16((uint16_t)arr_seeds64[i]);
+        arr_i_16_seed[i] = TSODLULS_get_int16_from_uint16((uint16_t)(arr_seeds64[i] >> 48));
       }
 
       PHP__INCLUDE_BENCHMARK_CODE_FOR_CHOSEN_ALGORITHMS__int16
@@ -342,7 +344,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_i_32_seed[i] = TSODLULS_get_int32_from_uint32((uint32_t)arr_seeds64[i]);
+        arr_i_32_seed[i] = TSODLULS_get_int32_from_uint32((uint32_t)(arr_seeds64[i] >> 32));
       }
 
       PHP__INCLUDE_BENCHMARK_CODE_FOR_CHOSEN_ALGORITHMS__int32
@@ -388,7 +390,7 @@ int main(int argc, char *argv[]){
       }
 
       for(i = 0; i < i_number_of_elements; ++i){
-        arr_f_float_seed[i] = TSODLULS_get_float_from_uint((uint32_t)arr_seeds64[i]);
+        arr_f_float_seed[i] = TSODLULS_get_float_from_uint((uint32_t)(arr_seeds64[i] >> 32));
       }
 
       PHP__INCLUDE_BENCHMARK_CODE_FOR_CHOSEN_ALGORITHMS__float
@@ -42,11 +42,14 @@ if($arrDataAlgorithm2['celltype'] != 'direct'){
 
 $iNumberOfElementsMin = getINumberOfElementsMin();
 $iNumberOfElementsMax = getINumberOfElementsMax();
+$sDistribution = getSDistribution();
+$iDistributionParameter = getIDistributionParameter($sDistribution);
 
 echo $arrDataAlgorithm1['name'], ($bWithMacraff1 ? " with macraffs" : ""), " and ",
      $arrDataAlgorithm2['name'], ($bWithMacraff2 ? " with macraffs" : ""),
      " will be compared with a number of elements",
-     " between $iNumberOfElementsMin and $iNumberOfElementsMax.\n";
+     " between $iNumberOfElementsMin and $iNumberOfElementsMax,",
+     " with the $sDistribution distribution (parameter $iDistributionParameter).\n";
 
 include('../generatingFunctions.php');
 
@@ -66,6 +69,16 @@ if(strpos($sCustomBenchmark, '@iNumberOfElementsMax@') === false){
 }
 $sCustomBenchmark = str_replace('@iNumberOfElementsMax@', (string)$iNumberOfElementsMax, $sCustomBenchmark);
 
+if(strpos($sCustomBenchmark, '@iDistribution@') === false){
+  die("The template file benchmark_custom.c.tpl does not contain the insertion token @iDistribution@.\n");
+}
+$sCustomBenchmark = str_replace('@iDistribution@', 'I_DISTRIBUTION__'.strtoupper($sDistribution), $sCustomBenchmark);
+
+if(strpos($sCustomBenchmark, '@iDistributionParameter@') === false){
+  die("The template file benchmark_custom.c.tpl does not contain the insertion token @iDistributionParameter@.\n");
+}
+$sCustomBenchmark = str_replace('@iDistributionParameter@', (string)$iDistributionParameter, $sCustomBenchmark);
+
 foreach($arrSubTests as $sSubTest => $arrDataSubTest){
   if(strpos($sCustomBenchmark, 'PHP__INCLUDE_BENCHMARK_CODE_FOR_CHOSEN_ALGORITHMS__'.$sSubTest) === false){
     die("The template file benchmark_custom.c.tpl does not contain the insertion token for sorting ".$sSubTest.".\n");
@@ -55,6 +55,7 @@ int main(int argc, char *argv[]){
   size_t i_min_length_of_string = @iMinLengthOfString@;
   size_t i_max_length_of_string = @iMaxLengthOfString@;
   size_t i_length_of_common_prefix = @iLengthOfCommonPrefix@;
+  int b_power_law_lengths = @bPowerLawLengths@;//otherwise the lengths are uniform
   size_t i_length_padding_multiplicator = 1;
   size_t i_length_padding_increment = 0;
   int8_t i_number_of_lex_padding_bytes_before = 0;
@@ -168,7 +169,10 @@ int main(int argc, char *argv[]){
       //allocating the strings
       for(i = 0; i < i_number_of_elements; ++i){
         k = i_min_length_of_string;
-        if(i_max_length_of_string > i_min_length_of_string){
+        if(b_power_law_lengths){
+          k = get_random_power_law_length(i_min_length_of_string, i_max_length_of_string);
+        }
+        else if(i_max_length_of_string > i_min_length_of_string){
           k += (rand() % (i_max_length_of_string - i_min_length_of_string + 1));
         }
         arr_os_strings_seed[i].s_string = calloc(k, sizeof(char));
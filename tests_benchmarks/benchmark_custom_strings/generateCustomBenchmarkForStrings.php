@@ -55,12 +55,14 @@ $iNumberOfElementsMax = getINumberOfElementsMax();
 $iMinLengthOfString = getIMinLengthOfString();
 $iMaxLengthOfString = getIMaxLengthOfString();
 $iLengthOfCommonPrefix = getILengthOfCommonPrefix($iMinLengthOfString);
+$bPowerLawLengths = getBChoiceForPowerLawLengths();
 
 echo $arrDataAlgorithm1['name'], ($bWithMacraff1 ? " with macraffs" : ""), ($bWithBitLevelPadding1 ? " with bit level padding" : ""), " and ",
      $arrDataAlgorithm2['name'], ($bWithMacraff2 ? " with macraffs" : ""), ($bWithBitLevelPadding2 ? " with bit level padding" : ""),
      " will be compared with a number of strings",
      " between $iNumberOfElementsMin and $iNumberOfElementsMax.\n",
-     "Each string will have length between $iMinLengthOfString and $iMaxLengthOfString,",
+     "Each string will have length between $iMinLengthOfString and $iMaxLengthOfString",
+     ($bPowerLawLengths ? " (power law)," : " (uniform),"),
      " and a common prefix of length $iLengthOfCommonPrefix.\n";
 
 include('../generatingFunctionsString.php');
@@ -96,6 +98,11 @@ if(strpos($sCustomBenchmark, '@iLengthOfCommonPrefix@') === false){
 }
 $sCustomBenchmark = str_replace('@iLengthOfCommonPrefix@', (string)$iLengthOfCommonPrefix, $sCustomBenchmark);
 
+if(strpos($sCustomBenchmark, '@bPowerLawLengths@') === false){
+  die("The template file benchmark_custom_strings.c.tpl does not contain the insertion token @bPowerLawLengths@.\n");
+}
+$sCustomBenchmark = str_replace('@bPowerLawLengths@', ($bPowerLawLengths ? '1' : '0'), $sCustomBenchmark);
+
 foreach($arrSubTests as $sSubTest => $arrDataSubTest){
   if(strpos($sCustomBenchmark, 'PHP__INCLUDE_BENCHMARK_CODE_FOR_CHOSEN_ALGORITHMS__'.$sSubTest) === false){
     die("The template file benchmark_custom_strings.c.tpl does not contain the insertion token for sorting ".$sSubTest.".\n");
@@ -131,6 +131,61 @@ function getINumberOfElementsMax(){
 
 
 
+function getSDistribution(){
+  $arrSDistributions = array(
+    'uniform', 'zipf', 'few_unique', 'sorted', 'reverse_sorted', 'sawtooth', 'nearly_sorted', 'gaussian', 'staggered'
+  );
+  do{
+    echo "What will be the distribution of the values to sort for this benchmark ? [default: uniform]\n";
+    echo "(see fill_seeds64_with_distribution() in tests_benchmarks/test_functions.c)\n";
+    foreach($arrSDistributions as $i => $sDistribution){
+      echo $i, " - ", $sDistribution, "\n";
+    }
+    $input = readline();
+    if($input === ''){
+      return 'uniform';
+    }
+    if(ctype_digit($input)
+      && isset($arrSDistributions[(int)$input])
+    ){
+      return $arrSDistributions[(int)$input];
+    }
+    echo "Type a number between 0 and ", count($arrSDistributions) - 1, " or hit return for default value of uniform.\n";
+  }
+  while(true);
+}//end function getSDistribution()
+
+
+
+function getIDistributionParameter($sDistribution){
+  $arrSParameters = array(
+    'zipf' => 'number of distinct values',
+    'few_unique' => 'number of distinct values',
+    'sawtooth' => 'number of teeth',
+    'nearly_sorted' => 'number of random swaps',
+    'staggered' => 'multiplier m in x[i] = (i * m + i) % n',
+  );
+  if(!isset($arrSParameters[$sDistribution])){
+    return 0;
+  }
+  do{
+    echo "What will be the parameter (", $arrSParameters[$sDistribution], ") of this distribution ? [default: 0 for the default value]\n";
+    $input = readline();
+    if($input === ''){
+      return 0;
+    }
+    if(ctype_digit($input)
+      && strlen($input) < 14
+    ){
+      return (int)$input;
+    }
+    echo "Type a number between 0 and 9 999 999 999 999 or hit return for default value of 0.\n";
+  }
+  while(true);
+}//end function getIDistributionParameter()
+
+
+
 function getIMinLengthOfString(){
   do{
     echo "What will be the minimum length of strings to sort for this test/benchmark ? [default: 1] (0 is a valid choice)\n";
@@ -194,6 +249,24 @@ function getILengthOfCommonPrefix($iMinLengthOfString){
 
 
 
+function getBChoiceForPowerLawLengths(){
+  do{
+    echo "Would-you like the lengths of strings to follow a power law (many short strings and a few long ones) ? [y/n]\n";
+    echo "Otherwise the lengths are uniform between the minimum and the maximum.\n";
+    $input = readline();
+    if($input === 'y'){
+      return true;
+    }
+    if($input === 'n'){
+      return false;
+    }
+    echo "Type 'y' or 'n' please.\n";
+  }
+  while(true);
+}//end function getBChoiceForPowerLawLengths()
+
+
+
 function getBChoiceForBitLevelPadding(){
   do{
     echo "Would-you like to test/benchmark it using bit-level padding ? [y/n]\n";
@@ -0,0 +1,173 @@
+/*
+This file is part of TSODLULS.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+/*
+Hardware performance counters for the benchmarks, with the perf_event_open system call of Linux.
+The counters are opened for the current thread, user space only.
+Each counter is opened on its own (no group) so that the kernel can multiplex them
+when there are not enough hardware counters, the values are scaled accordingly.
+A counter that cannot be opened (other OS, virtual machine, perf_event_paranoid, etc.)
+is just unavailable and its value is -1.
+*/
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define I_PERF_COUNTERS__NUMBER 6
+#define I_PERF_COUNTER__CYCLES 0
+#define I_PERF_COUNTER__INSTRUCTIONS 1
+#define I_PERF_COUNTER__L1D_MISSES 2
+#define I_PERF_COUNTER__LLC_MISSES 3
+#define I_PERF_COUNTER__BRANCH_MISSES 4
+#define I_PERF_COUNTER__DTLB_MISSES 5
+
+typedef struct perf_counters {
+  int arr_fds[I_PERF_COUNTERS__NUMBER];//-1 if the counter is unavailable
+  double arr_values[I_PERF_COUNTERS__NUMBER];//-1.0 if the counter is unavailable
+} t_perf_counters;
+
+
+
+const char* perf_counters_get_name(int i_counter){
+  switch(i_counter){
+    case I_PERF_COUNTER__CYCLES: return "cycles";
+    case I_PERF_COUNTER__INSTRUCTIONS: return "instructions";
+    case I_PERF_COUNTER__L1D_MISSES: return "l1d_misses";
+    case I_PERF_COUNTER__LLC_MISSES: return "llc_misses";
+    case I_PERF_COUNTER__BRANCH_MISSES: return "branch_misses";
+    default: return "dtlb_misses";
+  }
+}//end function perf_counters_get_name()
+
+
+
+/**
+ * Returns the number of available counters
+ */
+int perf_counters_open(t_perf_counters* p_counters){
+  int i_number_of_available_counters = 0;
+  for(int i = 0; i < I_PERF_COUNTERS__NUMBER; ++i){
+    p_counters->arr_fds[i] = -1;
+    p_counters->arr_values[i] = -1.0;
+  }
+#ifdef __linux__
+  for(int i = 0; i < I_PERF_COUNTERS__NUMBER; ++i){
+    struct perf_event_attr attributes;
+    memset(&attributes, 0, sizeof(struct perf_event_attr));
+    attributes.size = sizeof(struct perf_event_attr);
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    switch(i){
+      case I_PERF_COUNTER__CYCLES:
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+      case I_PERF_COUNTER__INSTRUCTIONS:
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+      case I_PERF_COUNTER__L1D_MISSES:
+        attributes.type = PERF_TYPE_HW_CACHE;
+        attributes.config = PERF_COUNT_HW_CACHE_L1D
+                          | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                          | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      break;
+      case I_PERF_COUNTER__LLC_MISSES:
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+      break;
+      case I_PERF_COUNTER__BRANCH_MISSES:
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+      default:
+        attributes.type = PERF_TYPE_HW_CACHE;
+        attributes.config = PERF_COUNT_HW_CACHE_DTLB
+                          | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                          | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+    p_counters->arr_fds[i] = syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0);
+    if(p_counters->arr_fds[i] >= 0){
+      ++i_number_of_available_counters;
+    }
+    else{
+      p_counters->arr_fds[i] = -1;
+    }
+  }
+#endif
+  return i_number_of_available_counters;
+}//end function perf_counters_open()
+
+
+
+void perf_counters_start(t_perf_counters* p_counters){
+#ifdef __linux__
+  for(int i = 0; i < I_PERF_COUNTERS__NUMBER; ++i){
+    if(p_counters->arr_fds[i] >= 0){
+      ioctl(p_counters->arr_fds[i], PERF_EVENT_IOC_RESET, 0);
+      ioctl(p_counters->arr_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+#endif
+}//end function perf_counters_start()
+
+
+
+/**
+ * Stops the counters and reads their values, scaled if the kernel multiplexed them
+ */
+void perf_counters_stop(t_perf_counters* p_counters){
+#ifdef __linux__
+  uint64_t arr_read_values[3];//value, time enabled, time running
+  for(int i = 0; i < I_PERF_COUNTERS__NUMBER; ++i){
+    if(p_counters->arr_fds[i] >= 0){
+      ioctl(p_counters->arr_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+  for(int i = 0; i < I_PERF_COUNTERS__NUMBER; ++i){
+    p_counters->arr_values[i] = -1.0;
+    if(
+      p_counters->arr_fds[i] >= 0
+      && read(p_counters->arr_fds[i], arr_read_values, sizeof(arr_read_values)) == sizeof(arr_read_values)
+    ){
+      if(arr_read_values[2] > 0){//else the counter was never scheduled
+        p_counters->arr_values[i] = ((double)arr_read_values[0]) * arr_read_values[1] / arr_read_values[2];
+      }
+    }
+  }
+#endif
+}//end function perf_counters_stop()
+
+
+
+void perf_counters_close(t_perf_counters* p_counters){
+  for(int i = 0; i < I_PERF_COUNTERS__NUMBER; ++i){
+#ifdef __linux__
+    if(p_counters->arr_fds[i] >= 0){
+      close(p_counters->arr_fds[i]);
+    }
+#endif
+    p_counters->arr_fds[i] = -1;
+  }
+}//end function perf_counters_close()
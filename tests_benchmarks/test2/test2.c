@@ -40,6 +40,31 @@ The tests are performed with 7 settings:
 - TSODLULS sort on TSODLULS cells
 - TSODLULS sort on TSODLULS cells and macraffs
 - TSODLULS sort on short TSODLULS cells and macraffs
+For uint64, three more settings are tested:
+- TSODLULS sort on TSODLULS cells with keys reserved in a key arena
+- TSODLULS sort on TSODLULS cells with keys built in a builder cell and copied in a key arena
+- TSODLULS sort on TSODLULS cells with keys reserved in a key arena, half of them too small
+- TSODLULS sort with cost models forcing each algorithm (insertion, comparison and radix) on long and short cells
+- TSODLULS radix sort with sort stats attached, if the library was compiled with -DTSODLULS_STATS (see "make test-stats")
+- each engine of the registry of sort engines
+- TSODLULS segmented sorts on long and short cells, with and without threads
+- TSODLULS sorting networks on the first 0 to 16 short cells
+- TSODLULS vectorized quicksort on short cells with each instruction set supported by the CPU
+- TSODLULS pdqsort on long cells with sorted, reverse sorted and few distinct keys
+- TSODLULS word-at-a-time comparison of keys of 0 to 40 bytes with long common prefixes
+- TSODLULS samplesorts on long and short cells with many and few distinct keys, with and without threads
+- TSODLULS radix sort with 64 bits digits on keys of 0 to 40 bytes with long common prefixes
+- TSODLULS hybrid prefix sort on duplicate keys of exactly 8 and 16 bytes
+- TSODLULS hybrid prefix sort on keys of 16 bytes with many equal prefixes of 8 bytes
+- TSODLULS sort with lazy keys on triples of uint64, with many and no ties on the first fields, and with empty keys
+- TSODLULS sorts with a dictionary of keys of 0 to 40 bytes, reused for two sorts, and with a missing key
+
+For a few sets of padding parameters, composite keys of two uint64 and of two int64
+with variable-length encodings are built with the functions and the macraffs,
+and it is tested that the keys are the same and that their order is the order of the pairs.
+
+Finally, composite keys (uint8, uint16, uint32, uint64) are built for a few sets of padding parameters,
+with and without padding plans, and it is tested that the keys are the same.
 
 This test shares a lot of code with benchmark 1.
 When both files reached more than 2500 lines of code,
@@ -100,6 +125,47 @@ int main(int argc, char *argv[]){
   double* arr_f_double_result2 = NULL;
   t_TSODLULS_sort_element* arr_cells = NULL;
   t_TSODLULS_sort_element__short* arr_cells__short = NULL;
+  t_TSODLULS_key_arena key_arena;
+  t_TSODLULS_sort_element cell_builder;
+  t_TSODLULS_padding_plan padding_plan;
+  t_TSODLULS_sort_element cell_with_plan;
+  t_TSODLULS_sort_element cell_without_plan;
+  t_TSODLULS_sort_element arr_varint_cells[2];//the current and the previous key
+  t_TSODLULS_sort_element cell_varint_macraff;
+  uint64_t arr_varint_values[2][2];
+  int i_varint_expected = 0;
+  t_TSODLULS_sort_model sort_model;
+  t_TSODLULS_sort_stats sort_stats;
+  const t_TSODLULS_sort_engine* p_sort_engine = NULL;
+  size_t arr_segment_sizes[10] = {0, 1, 2, 3, 8, 9, 16, 17, 40, 300};//around the network and insertion thresholds
+  size_t arr_segment_offsets[1025];//enough for 1024 elements
+  size_t i_number_of_segments = 0;
+  size_t i_samplesort_test_size = 5 * I_SAMPLESORT_BASE_CASE_SIZE + 7;//several partition steps
+  uint64_t* arr_samplesort_keys = NULL;
+  uint8_t* arr_samplesort_key_bytes = NULL;
+  t_TSODLULS_sort_element__short* arr_samplesort_cells__short = NULL;
+  t_TSODLULS_sort_element* arr_samplesort_cells = NULL;
+  uint8_t* arr_radix64_key_bytes = NULL;
+  uintptr_t i_radix64_checksum = 0;
+  uint64_t* arr_lazy_triples = NULL;
+  size_t i_lazy_calls = 0;
+  t_TSODLULS_key_extender key_extender;
+  t_TSODLULS_key_dictionary key_dictionary;
+  t_TSODLULS_numa_stats numa_stats;
+  t_TSODLULS_sort_step_context__short sort_step_context;
+  size_t i_number_of_sort_steps = 0;
+  unsigned int b_sort_step_finished = 0;
+  int arr_forced_algorithms[3] = {
+    I_SORT_ALGORITHM__INSERTION, I_SORT_ALGORITHM__COMPARISON, I_SORT_ALGORITHM__RADIX
+  };
+  int8_t i_offset;
+  int8_t arr_padding_parameters[5][5] = {
+    {0, 0, 0, 0, 1},
+    {1, 0, 0, 0, 1},
+    {0, 1, 1, 0, 2},
+    {I_HALF_BYTE, I_HALF_BYTE, 0, 0, 3},
+    {2, 1, I_HALF_BYTE, I_HALF_BYTE, 5},
+  };
 
   uint8_t ui8;
   uint16_t ui16;
@@ -436,6 +502,675 @@ int main(int argc, char *argv[]){
     TSODLULS_code_fragment_fill_result2_with_short_cells_for_uint64_no_macraff_needed();
     TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS sort (short orders, macraff) gave different results (uint64)\n");
 
+    TSODLULS_code_fragment_init_long_cells_for_uint64_with_key_arena();
+    TSODLULS_sort(arr_cells, i_number_of_elements);
+    TSODLULS_code_fragment_fill_result2_with_long_cells_for_uint64_with_key_arena();
+    TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS sort (key arena) gave different results (uint64)\n");
+
+    TSODLULS_code_fragment_init_long_cells_for_uint64_with_key_arena_builder();
+    TSODLULS_sort(arr_cells, i_number_of_elements);
+    TSODLULS_code_fragment_fill_result2_with_long_cells_for_uint64_with_key_arena();
+    TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS sort (key arena builder) gave different results (uint64)\n");
+
+    TSODLULS_code_fragment_init_long_cells_for_uint64_with_key_arena_too_small();
+    TSODLULS_sort(arr_cells, i_number_of_elements);
+    TSODLULS_code_fragment_fill_result2_with_long_cells_for_uint64_with_key_arena_too_small();
+    TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS sort (keys growing out of a key arena) gave different results (uint64)\n");
+
+    for(size_t j = 0; j < 3; ++j){
+      TSODLULS_sort_model_init(&sort_model);
+      if(arr_forced_algorithms[j] == I_SORT_ALGORITHM__INSERTION){
+        sort_model.i_insertion_threshold = i_number_of_elements;
+        sort_model.i_insertion_threshold__short = i_number_of_elements;
+      }
+      else if(arr_forced_algorithms[j] == I_SORT_ALGORITHM__COMPARISON){
+        sort_model.f_comparison_cost = 0.0;
+        sort_model.f_comparison_byte_cost = 0.0;
+        sort_model.f_comparison_cost__short = 0.0;
+      }
+      else{
+        sort_model.f_radix_setup_cost = 0.0;
+        sort_model.f_radix_pass_cost = 0.0;
+        sort_model.f_radix_setup_cost__short = 0.0;
+        sort_model.f_radix_pass_cost__short = 0.0;
+      }
+
+      TSODLULS_code_fragment_init_long_cells_for_uint64();
+      if(TSODLULS_choose_sort_algorithm(&sort_model, arr_cells, i_number_of_elements) != arr_forced_algorithms[j]){
+        printf("The cost model did not choose the forced algorithm %d (uint64)\n", arr_forced_algorithms[j]);
+        i_result = -1;
+        break;
+      }
+      TSODLULS_sort_with_model(&sort_model, arr_cells, i_number_of_elements);
+      TSODLULS_code_fragment_fill_result2_with_long_cells_for_uint64();
+      TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS sort with a cost model gave different results (uint64)\n");
+
+      TSODLULS_code_fragment_init_short_cells_for_uint64_with_macraffs();
+      if(TSODLULS_choose_sort_algorithm__short(&sort_model, arr_cells__short, i_number_of_elements, 8)
+           != arr_forced_algorithms[j]
+      ){
+        printf("The cost model did not choose the forced algorithm %d (short orders, uint64)\n", arr_forced_algorithms[j]);
+        i_result = -1;
+        break;
+      }
+      TSODLULS_sort_with_model__short(&sort_model, arr_cells__short, i_number_of_elements, 8);
+      TSODLULS_code_fragment_fill_result2_with_short_cells_for_uint64_no_macraff_needed();
+      TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS sort with a cost model gave different results (short orders, uint64)\n");
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    TSODLULS_sort_stats_init(&sort_stats);
+    i_result = TSODLULS_sort_stats_attach(&sort_stats);
+    if(i_result == 0){
+      TSODLULS_code_fragment_init_long_cells_for_uint64();
+      TSODLULS_sort_radix8_count_insertion(arr_cells, i_number_of_elements);
+      TSODLULS_sort_stats_attach(NULL);
+      TSODLULS_code_fragment_fill_result2_with_long_cells_for_uint64();
+      TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS sort with sort stats gave different results (uint64)\n");
+      if(sort_stats.i_histogram_passes == 0
+        || sort_stats.i_single_byte_skips >= sort_stats.i_histogram_passes
+        || sort_stats.i_bytes_scattered < i_number_of_elements * sizeof(t_TSODLULS_sort_element)
+        || sort_stats.i_max_instance_stack_depth > sort_stats.i_instances_pushed
+        || sort_stats.i_instances_pushed >= sort_stats.i_histogram_passes
+      ){
+        printf("The sort stats are not consistent (uint64)\n");
+        i_result = -1;
+        break;
+      }
+    }
+    else if(i_result == I_ERROR__SORT_STATS_NOT_COMPILED){
+#ifdef TSODLULS_STATS
+      //"make test-stats" must not pass without checking the stats
+      printf("The sort stats are not compiled in the library\n");
+      i_result = -1;
+      break;
+#else
+      i_result = 0;
+#endif
+    }
+    else{
+      break;
+    }
+
+    for(size_t j = 0; j < TSODLULS_get_number_of_sort_engines(); ++j){
+      p_sort_engine = TSODLULS_get_sort_engine(j);
+      if(TSODLULS_find_sort_engine(p_sort_engine->s_name) != p_sort_engine){
+        printf("The sort engine %s was not found in the registry\n", p_sort_engine->s_name);
+        i_result = -1;
+        break;
+      }
+      if(p_sort_engine->i_cell_type == I_CELL_TYPE__LONG){
+        TSODLULS_code_fragment_init_long_cells_for_uint64();
+        TSODLULS_sort_with_engine(p_sort_engine->s_name, arr_cells, i_number_of_elements, 8);
+        TSODLULS_code_fragment_fill_result2_with_long_cells_for_uint64();
+      }
+      else{
+        TSODLULS_code_fragment_init_short_cells_for_uint64_with_macraffs();
+        TSODLULS_sort_with_engine(p_sort_engine->s_name, arr_cells__short, i_number_of_elements, 8);
+        TSODLULS_code_fragment_fill_result2_with_short_cells_for_uint64_no_macraff_needed();
+      }
+      TSODLULS_code_fragment_compare_results_for_uint64("qsort and a sort engine of the registry gave different results (uint64)\n");
+    }
+    if(i_result != 0){
+      break;
+    }
+    if(TSODLULS_sort_with_engine("unknown", arr_cells, i_number_of_elements, 8) != I_ERROR__UNKNOWN_SORT_ENGINE){
+      printf("An unknown sort engine was found in the registry\n");
+      i_result = -1;
+      break;
+    }
+
+    //segments of various sizes, including empty ones, sorted independently
+    i_number_of_segments = 0;
+    arr_segment_offsets[0] = 0;
+    while(arr_segment_offsets[i_number_of_segments] < i_number_of_elements){
+      arr_segment_offsets[i_number_of_segments + 1] = arr_segment_offsets[i_number_of_segments]
+                                                    + arr_segment_sizes[i_number_of_segments % 10];
+      if(arr_segment_offsets[i_number_of_segments + 1] > i_number_of_elements){
+        arr_segment_offsets[i_number_of_segments + 1] = i_number_of_elements;
+      }
+      ++i_number_of_segments;
+    }
+    memcpy(arr_ui_64_result1, arr_ui_64_seed, i_number_of_elements * sizeof(uint64_t));
+    for(size_t j = 0; j < i_number_of_segments; ++j){
+      qsort(
+          &(arr_ui_64_result1[arr_segment_offsets[j]]),
+          arr_segment_offsets[j + 1] - arr_segment_offsets[j],
+          sizeof(uint64_t),
+          (&TSODLULS_compare_uint64_direct)
+      );
+    }
+    for(size_t j = 0; j < 4; ++j){
+      if(j % 2 == 0){
+        TSODLULS_code_fragment_init_short_cells_for_uint64_with_macraffs();
+        if(j == 0){
+          i_result = TSODLULS_sort_segmented__short(arr_cells__short, arr_segment_offsets, i_number_of_segments, 8);
+        }
+        else{
+          i_result = TSODLULS_sort_segmented_parallel__short(arr_cells__short, arr_segment_offsets, i_number_of_segments, 8, 4);
+        }
+        TSODLULS_code_fragment_fill_result2_with_short_cells_for_uint64_no_macraff_needed();
+      }
+      else{
+        TSODLULS_code_fragment_init_long_cells_for_uint64();
+        if(j == 1){
+          i_result = TSODLULS_sort_segmented(arr_cells, arr_segment_offsets, i_number_of_segments);
+        }
+        else{
+          i_result = TSODLULS_sort_segmented_parallel(arr_cells, arr_segment_offsets, i_number_of_segments, 4);
+        }
+        TSODLULS_code_fragment_fill_result2_with_long_cells_for_uint64();
+      }
+      if(i_result != 0){
+        printf("The segmented sort %zu failed with error %d (uint64)\n", j, i_result);
+        break;
+      }
+      TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS segmented sort gave different results (uint64)\n");
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //sorting networks on the first cells only
+    for(size_t j = 0; j <= I_SORT_NETWORK_MAX_SIZE__SHORT; ++j){
+      memcpy(arr_ui_64_result1, arr_ui_64_seed, i_number_of_elements * sizeof(uint64_t));
+      qsort(arr_ui_64_result1, j, sizeof(uint64_t), (&TSODLULS_compare_uint64_direct));
+      TSODLULS_code_fragment_init_short_cells_for_uint64_with_macraffs();
+      i_result = TSODLULS_sort_network__short(arr_cells__short, j);
+      TSODLULS_code_fragment_fill_result2_with_short_cells_for_uint64_no_macraff_needed();
+      if(i_result != 0){
+        printf("The sorting network for %zu elements failed with error %d (uint64)\n", j, i_result);
+        break;
+      }
+      TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS sorting network gave different results (uint64)\n");
+    }
+    if(i_result != 0){
+      break;
+    }
+    if(
+      TSODLULS_sort_network__short(arr_cells__short, I_SORT_NETWORK_MAX_SIZE__SHORT + 1)
+      != I_ERROR__TOO_MANY_ELEMENTS_FOR_SORTING_NETWORK
+    ){
+      printf("A sorting network was used for too many elements\n");
+      i_result = -1;
+      break;
+    }
+
+    //vectorized quicksort with each instruction set supported by the CPU
+    for(int j = I_INSTRUCTION_SET__SCALAR; j <= TSODLULS_get_best_instruction_set(); ++j){
+      memcpy(arr_ui_64_result1, arr_ui_64_seed, i_number_of_elements * sizeof(uint64_t));
+      qsort(arr_ui_64_result1, i_number_of_elements, sizeof(uint64_t), (&TSODLULS_compare_uint64_direct));
+      TSODLULS_code_fragment_init_short_cells_for_uint64_with_macraffs();
+      TSODLULS_qsort_vectorized__short_with_instruction_set(arr_cells__short, i_number_of_elements, j);
+      TSODLULS_code_fragment_fill_result2_with_short_cells_for_uint64_no_macraff_needed();
+      TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS vectorized quicksort gave different results (uint64)\n");
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //pdqsort on patterns of seeds: sorted, reverse sorted and few distinct keys (the seeds are not used after)
+    for(size_t j = 0; j < 3; ++j){
+      qsort(arr_ui_64_seed, i_number_of_elements, sizeof(uint64_t), (&TSODLULS_compare_uint64_direct));
+      for(i = 0; i < i_number_of_elements; ++i){
+        if(j == 1){
+          arr_ui_64_result1[i] = arr_ui_64_seed[i_number_of_elements - 1 - i];
+        }
+        else if(j == 2){
+          arr_ui_64_result1[i] = arr_ui_64_seed[i] % 4;
+        }
+        else{
+          arr_ui_64_result1[i] = arr_ui_64_seed[i];
+        }
+      }
+      memcpy(arr_ui_64_seed, arr_ui_64_result1, i_number_of_elements * sizeof(uint64_t));
+      qsort(arr_ui_64_result1, i_number_of_elements, sizeof(uint64_t), (&TSODLULS_compare_uint64_direct));
+      TSODLULS_code_fragment_init_long_cells_for_uint64();
+      TSODLULS_pdqsort(arr_cells, i_number_of_elements);
+      TSODLULS_code_fragment_fill_result2_with_long_cells_for_uint64();
+      TSODLULS_code_fragment_compare_results_for_uint64("qsort and TSODLULS pdqsort gave different results (uint64)\n");
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //word-at-a-time comparison of keys with long common prefixes, the shorter key is smaller when it is a prefix
+    for(size_t j = 0; j < 100000; ++j){
+      uint8_t arr_key1[40];
+      uint8_t arr_key2[40];
+      t_TSODLULS_sort_element cell1;
+      t_TSODLULS_sort_element cell2;
+      size_t i_common_prefix = 0;
+      int i_expected = 0;
+      int i_comparison = 0;
+      cell1.i_key_size = rand() % 41;
+      cell2.i_key_size = rand() % 41;
+      cell1.s_key = arr_key1;
+      cell2.s_key = arr_key2;
+      for(i = 0; i < cell1.i_key_size; ++i){
+        arr_key1[i] = (rand() % 8 == 0) ? 255 : 0;
+      }
+      for(i = 0; i < cell2.i_key_size; ++i){
+        arr_key2[i] = (i < cell1.i_key_size && rand() % 16 != 0) ? arr_key1[i] : ((rand() % 8 == 0) ? 255 : 0);
+      }
+      while(
+        i_common_prefix < cell1.i_key_size && i_common_prefix < cell2.i_key_size
+        && arr_key1[i_common_prefix] == arr_key2[i_common_prefix]
+      ){
+        ++i_common_prefix;
+      }
+      if(i_common_prefix < cell1.i_key_size && i_common_prefix < cell2.i_key_size){
+        i_expected = arr_key1[i_common_prefix] < arr_key2[i_common_prefix] ? -1 : 1;
+      }
+      else{
+        i_expected = (cell1.i_key_size > cell2.i_key_size) - (cell1.i_key_size < cell2.i_key_size);
+      }
+      i_comparison = TSODLULS_compare_nextified_key_in_cell_by_words(&cell1, &cell2);
+      if(i_comparison != i_expected){
+        printf("The word-at-a-time comparison of keys gave %d instead of %d\n", i_comparison, i_expected);
+        i_result = -1;
+        break;
+      }
+      i_comparison = TSODLULS_compare_nextified_keys_in_cells(&cell1, &cell2, rand() % (i_common_prefix + 1));
+      if(i_comparison != i_expected){
+        printf("The word-at-a-time comparison of keys from an offset gave %d instead of %d\n", i_comparison, i_expected);
+        i_result = -1;
+        break;
+      }
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //samplesorts on more cells than a base case, with many and few distinct keys, with and without threads
+    arr_samplesort_keys = calloc(i_samplesort_test_size, sizeof(uint64_t));
+    arr_samplesort_key_bytes = calloc(i_samplesort_test_size, 8 * sizeof(uint8_t));
+    arr_samplesort_cells__short = calloc(i_samplesort_test_size, sizeof(t_TSODLULS_sort_element__short));
+    arr_samplesort_cells = calloc(i_samplesort_test_size, sizeof(t_TSODLULS_sort_element));
+    if(
+      arr_samplesort_keys == NULL
+      || arr_samplesort_key_bytes == NULL
+      || arr_samplesort_cells__short == NULL
+      || arr_samplesort_cells == NULL
+    ){
+      i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      break;
+    }
+    for(size_t j = 0; j < 4; ++j){
+      for(i = 0; i < i_samplesort_test_size; ++i){
+        arr_samplesort_keys[i] = (((uint64_t)rand()) << 32) ^ ((uint64_t)rand());
+        if(j >= 2){
+          arr_samplesort_keys[i] %= 3;
+        }
+        arr_samplesort_cells__short[i].p_object = NULL;
+        arr_samplesort_cells__short[i].i_key = arr_samplesort_keys[i];
+        for(size_t k = 0; k < 8; ++k){
+          arr_samplesort_key_bytes[8 * i + k] = (uint8_t)(arr_samplesort_keys[i] >> (56 - 8 * k));
+        }
+        arr_samplesort_cells[i].p_object = NULL;
+        arr_samplesort_cells[i].s_key = &(arr_samplesort_key_bytes[8 * i]);
+        arr_samplesort_cells[i].i_key_size = 8;
+        arr_samplesort_cells[i].i_allocated_size = 0;
+      }
+      qsort(arr_samplesort_keys, i_samplesort_test_size, sizeof(uint64_t), (&TSODLULS_compare_uint64_direct));
+      if(j % 2 == 0){
+        i_result = TSODLULS_sort_samplesort__short(arr_samplesort_cells__short, i_samplesort_test_size);
+        if(i_result == 0){
+          i_result = TSODLULS_sort_samplesort(arr_samplesort_cells, i_samplesort_test_size);
+        }
+      }
+      else{
+        i_result = TSODLULS_sort_samplesort_parallel__short(arr_samplesort_cells__short, i_samplesort_test_size, 3);
+        if(i_result == 0){
+          i_result = TSODLULS_sort_samplesort_parallel(arr_samplesort_cells, i_samplesort_test_size, 3);
+        }
+      }
+      if(i_result != 0){
+        printf("The samplesort %zu failed with error %d\n", j, i_result);
+        break;
+      }
+      for(i = 0; i < i_samplesort_test_size; ++i){
+        uint64_t i_long_key = 0;
+        for(size_t k = 0; k < 8; ++k){
+          i_long_key = (i_long_key << 8) | arr_samplesort_cells[i].s_key[k];
+        }
+        if(arr_samplesort_cells__short[i].i_key != arr_samplesort_keys[i] || i_long_key != arr_samplesort_keys[i]){
+          printf("qsort and TSODLULS samplesort %zu gave different results at index %zu\n", j, i);
+          i_result = -1;
+          break;
+        }
+      }
+      if(i_result != 0){
+        break;
+      }
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //time-sliced sort of short cells, a few thousand cells at a time
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      arr_samplesort_keys[i] = (((uint64_t)rand()) << 32) ^ ((uint64_t)rand());
+      arr_samplesort_keys[i] &= 0xFFFFFFFFFFFF0000;//6 bytes keys
+      if(i % 3 == 0){
+        arr_samplesort_keys[i] &= 0xFF00000000000000;//big buckets copied back from the buffer
+      }
+      arr_samplesort_cells__short[i].p_object = NULL;
+      arr_samplesort_cells__short[i].i_key = arr_samplesort_keys[i];
+    }
+    qsort(arr_samplesort_keys, i_samplesort_test_size, sizeof(uint64_t), (&TSODLULS_compare_uint64_direct));
+    i_result = TSODLULS_sort_step_begin__short(&sort_step_context, arr_samplesort_cells__short, i_samplesort_test_size, 6);
+    i_number_of_sort_steps = 0;
+    b_sort_step_finished = 0;
+    while(i_result == 0 && !b_sort_step_finished){
+      i_result = TSODLULS_sort_step__short(&sort_step_context, 1000, 0, &b_sort_step_finished);
+      ++i_number_of_sort_steps;
+    }
+    if(i_result != 0){
+      printf("The time-sliced sort failed with error %d\n", i_result);
+      break;
+    }
+    if(i_number_of_sort_steps < i_samplesort_test_size / 1000){
+      printf("The time-sliced sort did more than 1000 cells in some steps\n");
+      i_result = -1;
+      break;
+    }
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      if(arr_samplesort_cells__short[i].i_key != arr_samplesort_keys[i]){
+        printf("qsort and TSODLULS time-sliced sort gave different results at index %zu\n", i);
+        i_result = -1;
+        break;
+      }
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //radix sort with 64 bits digits on keys of 0 to 40 bytes with long common prefixes
+    arr_radix64_key_bytes = calloc(i_samplesort_test_size, 40 * sizeof(uint8_t));
+    if(arr_radix64_key_bytes == NULL){
+      i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      break;
+    }
+    i_radix64_checksum = 0;
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      arr_samplesort_cells[i].p_object = NULL;
+      arr_samplesort_cells[i].s_key = &(arr_radix64_key_bytes[40 * i]);
+      arr_samplesort_cells[i].i_key_size = rand() % 41;
+      arr_samplesort_cells[i].i_allocated_size = 0;
+      for(size_t k = 0; k < arr_samplesort_cells[i].i_key_size; ++k){
+        arr_samplesort_cells[i].s_key[k] = (rand() % 8 == 0) ? 255 : 0;
+      }
+      i_radix64_checksum += (uintptr_t)(arr_samplesort_cells[i].s_key);
+    }
+    i_result = TSODLULS_sort_radix64_short_view(arr_samplesort_cells, i_samplesort_test_size);
+    if(i_result != 0){
+      printf("The radix sort with 64 bits digits failed with error %d\n", i_result);
+      break;
+    }
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      i_radix64_checksum -= (uintptr_t)(arr_samplesort_cells[i].s_key);
+      if(
+        i > 0
+        && TSODLULS_compare_nextified_key_in_cell_by_words(&(arr_samplesort_cells[i - 1]), &(arr_samplesort_cells[i])) > 0
+      ){
+        printf("TSODLULS radix sort with 64 bits digits did not sort the keys at index %zu\n", i);
+        i_result = -1;
+        break;
+      }
+    }
+    if(i_result == 0 && i_radix64_checksum != 0){
+      printf("TSODLULS radix sort with 64 bits digits lost some cells\n");
+      i_result = -1;
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //hybrid prefix sort on duplicate keys of exactly 8 and 16 bytes made of 3 distinct words,
+    //at the end of the bytes of each cell (a key of 8 bytes is a prefix, it must not be sorted after its word)
+    i_radix64_checksum = 0;
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      arr_samplesort_cells[i].p_object = NULL;
+      arr_samplesort_cells[i].i_key_size = (i % 2 == 0) ? 8 : 16;
+      arr_samplesort_cells[i].s_key = &(arr_radix64_key_bytes[40 * i + 40 - arr_samplesort_cells[i].i_key_size]);
+      arr_samplesort_cells[i].i_allocated_size = 0;
+      for(size_t k = 0; k < arr_samplesort_cells[i].i_key_size; ++k){
+        arr_samplesort_cells[i].s_key[k] = (uint8_t)(1 + (i / (2 + k / 8)) % 3);
+      }
+      i_radix64_checksum += (uintptr_t)(arr_samplesort_cells[i].s_key);
+    }
+    i_result = TSODLULS_sort_prefix8_hybrid(arr_samplesort_cells, i_samplesort_test_size);
+    if(i_result != 0){
+      printf("The hybrid prefix sort failed with error %d on keys of 8 and 16 bytes\n", i_result);
+      break;
+    }
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      i_radix64_checksum -= (uintptr_t)(arr_samplesort_cells[i].s_key);
+      if(
+        i > 0
+        && TSODLULS_compare_nextified_key_in_cell_by_words(&(arr_samplesort_cells[i - 1]), &(arr_samplesort_cells[i])) > 0
+      ){
+        printf("TSODLULS hybrid prefix sort did not sort the keys of 8 and 16 bytes at index %zu\n", i);
+        i_result = -1;
+        break;
+      }
+    }
+    if(i_result == 0 && i_radix64_checksum != 0){
+      printf("TSODLULS hybrid prefix sort lost some cells with keys of 8 and 16 bytes\n");
+      i_result = -1;
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //hybrid prefix sort on keys of 16 bytes with many equal prefixes of 8 bytes (the bytes of the keys above)
+    i_radix64_checksum = 0;
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      arr_samplesort_cells[i].p_object = NULL;
+      arr_samplesort_cells[i].s_key = &(arr_radix64_key_bytes[40 * i]);
+      arr_samplesort_cells[i].i_key_size = 16;
+      arr_samplesort_cells[i].i_allocated_size = 0;
+      i_radix64_checksum += (uintptr_t)(arr_samplesort_cells[i].s_key);
+    }
+    i_result = TSODLULS_sort_prefix8_hybrid(arr_samplesort_cells, i_samplesort_test_size);
+    if(i_result != 0){
+      printf("The hybrid prefix sort failed with error %d\n", i_result);
+      break;
+    }
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      i_radix64_checksum -= (uintptr_t)(arr_samplesort_cells[i].s_key);
+      if(i > 0 && memcmp(arr_samplesort_cells[i - 1].s_key, arr_samplesort_cells[i].s_key, 16) > 0){
+        printf("TSODLULS hybrid prefix sort did not sort the keys at index %zu\n", i);
+        i_result = -1;
+        break;
+      }
+    }
+    if(i_result == 0 && i_radix64_checksum != 0){
+      printf("TSODLULS hybrid prefix sort lost some cells\n");
+      i_result = -1;
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //NUMA-aware parallel sort on the same keys, with few buckets of the first 2 bytes, hence empty partitions
+    i_radix64_checksum = 0;
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      arr_samplesort_cells[i].s_key = &(arr_radix64_key_bytes[40 * ((i * 7919) % i_samplesort_test_size)]);
+      i_radix64_checksum += (uintptr_t)(arr_samplesort_cells[i].s_key);
+    }
+    i_result = TSODLULS_sort_parallel_numa(arr_samplesort_cells, i_samplesort_test_size, 4, &numa_stats);
+    if(i_result != 0){
+      printf("The NUMA-aware parallel sort failed with error %d\n", i_result);
+      break;
+    }
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      i_radix64_checksum -= (uintptr_t)(arr_samplesort_cells[i].s_key);
+      if(i > 0 && memcmp(arr_samplesort_cells[i - 1].s_key, arr_samplesort_cells[i].s_key, 16) > 0){
+        printf("TSODLULS NUMA-aware parallel sort did not sort the keys at index %zu\n", i);
+        i_result = -1;
+        break;
+      }
+    }
+    if(i_result == 0 && i_radix64_checksum != 0){
+      printf("TSODLULS NUMA-aware parallel sort lost some cells\n");
+      i_result = -1;
+    }
+    if(
+      i_result == 0
+      && (
+        numa_stats.i_number_of_nodes == 0
+        || numa_stats.i_number_of_threads != 4
+        || numa_stats.i_bytes_to_local_node + numa_stats.i_bytes_to_remote_node
+           != i_samplesort_test_size * sizeof(t_TSODLULS_sort_element)
+        || (numa_stats.i_number_of_nodes == 1 && numa_stats.i_bytes_to_remote_node != 0)
+        || (numa_stats.i_number_of_nodes > 1
+          && numa_stats.i_number_of_pinned_threads == 0
+          && numa_stats.i_bytes_to_local_node != 0
+        )
+      )
+    ){
+      printf("TSODLULS NUMA-aware parallel sort gave wrong statistics\n");
+      i_result = -1;
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //sort with lazy keys: the keys start with the first field (or no field at all), the ties get the next fields
+    arr_lazy_triples = calloc(i_samplesort_test_size, 3 * sizeof(uint64_t));
+    if(arr_lazy_triples == NULL){
+      i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      break;
+    }
+    key_extender.f_add_field = add_field_of_uint64_triple_to_key;
+    key_extender.p_context = &i_lazy_calls;
+    key_extender.i_number_of_fields = 3;
+    for(size_t j = 0; j < 3 && i_result == 0; ++j){
+      for(i = 0; i < i_samplesort_test_size; ++i){
+        arr_lazy_triples[3 * i] = (j == 1) ? (uint64_t)i * 2654435761 : (uint64_t)(rand() % 4);
+        arr_lazy_triples[3 * i + 1] = rand() % 4;
+        arr_lazy_triples[3 * i + 2] = rand();
+        TSODLULS_init_element(&(arr_samplesort_cells[i]));
+        arr_samplesort_cells[i].p_object = &(arr_lazy_triples[3 * i]);
+        if(j == 2){
+          continue;//empty keys with s_key == NULL
+        }
+        i_result = TSODLULS_add_bytes_to_key_from_uint64(&(arr_samplesort_cells[i]), arr_lazy_triples[3 * i], 0, 0, 0, 0, 1, 0);
+        if(i_result != 0){
+          break;
+        }
+      }
+      if(i_result != 0){
+        break;
+      }
+      i_lazy_calls = 0;
+      i_result = TSODLULS_sort_with_lazy_keys(arr_samplesort_cells, i_samplesort_test_size, (j == 2) ? 0 : 1, &key_extender);
+      if(i_result != 0){
+        printf("The sort with lazy keys failed with error %d\n", i_result);
+        break;
+      }
+      for(i = 1; i < i_samplesort_test_size; ++i){
+        uint64_t* p_previous = (uint64_t*)(arr_samplesort_cells[i - 1].p_object);
+        uint64_t* p_current = (uint64_t*)(arr_samplesort_cells[i].p_object);
+        size_t k = 0;
+        while(k < 2 && p_previous[k] == p_current[k]){
+          ++k;
+        }
+        if(p_previous[k] > p_current[k]){
+          printf("TSODLULS sort with lazy keys did not sort the triples at index %zu\n", i);
+          i_result = -1;
+          break;
+        }
+      }
+      //the fields are only added to the ties, and the first field to all the cells when the keys are empty
+      if(
+        i_result == 0
+        && (
+          (j == 0 && i_lazy_calls > 2 * i_samplesort_test_size)
+          || (j == 1 && i_lazy_calls != 0)
+          || (j == 2 && (i_lazy_calls < i_samplesort_test_size || i_lazy_calls > 3 * i_samplesort_test_size))
+        )
+      ){
+        printf("TSODLULS sort with lazy keys added %zu fields (test %zu)\n", i_lazy_calls, j);
+        i_result = -1;
+      }
+      TSODLULS_free_keys_in_array_of_elements(arr_samplesort_cells, i_samplesort_test_size);
+    }
+    if(i_result != 0){
+      break;
+    }
+    TSODLULS_free(arr_lazy_triples);
+
+    //sorts with a dictionary of keys: the keys of 0 to 40 bytes with long common prefixes of the radix sort above
+    for(i = 0; i < i_samplesort_test_size; ++i){
+      arr_samplesort_cells[i].p_object = &(arr_samplesort_cells__short[i]);//any distinct pointers
+      arr_samplesort_cells[i].s_key = &(arr_radix64_key_bytes[40 * (i % 1000)]);
+      arr_samplesort_cells[i].i_key_size = (i % 1000) % 41;
+      arr_samplesort_cells[i].i_allocated_size = 0;
+    }
+    i_result = TSODLULS_key_dictionary_init(&key_dictionary, arr_samplesort_cells, i_samplesort_test_size);
+    if(i_result != 0){
+      printf("The dictionary of keys could not be initialized (error %d)\n", i_result);
+      break;
+    }
+    for(size_t j = 0; j < 2 && i_result == 0; ++j){
+      //the second sort is on the cells in reverse order
+      for(i = 0; j == 1 && i < i_samplesort_test_size / 2; ++i){
+        t_TSODLULS_sort_element tmp_cell = arr_samplesort_cells[i];
+        arr_samplesort_cells[i] = arr_samplesort_cells[i_samplesort_test_size - 1 - i];
+        arr_samplesort_cells[i_samplesort_test_size - 1 - i] = tmp_cell;
+      }
+      i_result = TSODLULS_sort_with_key_dictionary(
+          &key_dictionary,
+          arr_samplesort_cells,
+          i_samplesort_test_size,
+          arr_samplesort_cells__short
+      );
+      if(i_result != 0){
+        printf("The sort with a dictionary of keys failed with error %d\n", i_result);
+        break;
+      }
+      for(i = 1; i < i_samplesort_test_size; ++i){
+        size_t i_previous = (t_TSODLULS_sort_element__short*)(arr_samplesort_cells__short[i - 1].p_object) - arr_samplesort_cells__short;
+        size_t i_current = (t_TSODLULS_sort_element__short*)(arr_samplesort_cells__short[i].p_object) - arr_samplesort_cells__short;
+        t_TSODLULS_sort_element cell_previous = {NULL, (i_previous % 1000) % 41, 0, &(arr_radix64_key_bytes[40 * (i_previous % 1000)])};
+        t_TSODLULS_sort_element cell_current = {NULL, (i_current % 1000) % 41, 0, &(arr_radix64_key_bytes[40 * (i_current % 1000)])};
+        if(
+          TSODLULS_compare_nextified_key_in_cell_by_words(&cell_previous, &cell_current) > 0
+          || (arr_samplesort_cells__short[i - 1].i_key == arr_samplesort_cells__short[i].i_key)
+             != (TSODLULS_compare_nextified_key_in_cell_by_words(&cell_previous, &cell_current) == 0)
+        ){
+          printf("TSODLULS sort with a dictionary of keys did not sort the keys at index %zu (sort %zu)\n", i, j);
+          i_result = -1;
+          break;
+        }
+      }
+    }
+    if(i_result == 0){
+      arr_samplesort_cells[0].i_key_size = 41;//not in the dictionary
+      if(
+        TSODLULS_sort_with_key_dictionary(&key_dictionary, arr_samplesort_cells, 1, arr_samplesort_cells__short)
+        != I_ERROR__KEY_NOT_IN_DICTIONARY
+      ){
+        printf("TSODLULS sort with a dictionary of keys did not find the missing key\n");
+        i_result = -1;
+      }
+    }
+    TSODLULS_key_dictionary_free(&key_dictionary);
+    if(i_result != 0){
+      break;
+    }
+    TSODLULS_free(arr_radix64_key_bytes);
+
+    TSODLULS_free(arr_samplesort_keys);
+    TSODLULS_free(arr_samplesort_key_bytes);
+    TSODLULS_free(arr_samplesort_cells__short);
+    TSODLULS_free(arr_samplesort_cells);
+
     TSODLULS_free(arr_ui_64_seed);
     TSODLULS_free(arr_ui_64_result1);
     TSODLULS_free(arr_ui_64_result2);
@@ -862,6 +1597,217 @@ int main(int argc, char *argv[]){
     TSODLULS_free(arr_f_double_result2);
 
 
+    //padding plans
+    TSODLULS_init_element(&cell_with_plan);
+    TSODLULS_init_element(&cell_without_plan);
+    for(size_t j = 0; j < 5; ++j){
+      i_result = TSODLULS_padding_plan_init(
+          &padding_plan,
+          arr_padding_parameters[j][0],
+          arr_padding_parameters[j][1],
+          arr_padding_parameters[j][2],
+          arr_padding_parameters[j][3],
+          arr_padding_parameters[j][4]
+      );
+      if(i_result != 0){
+        break;
+      }
+      for(i = 0; i < i_number_of_elements; ++i){
+        cell_with_plan.i_key_size = 0;
+        cell_without_plan.i_key_size = 0;
+        i_offset = 0;
+        i_result = TSODLULS_add_bytes_to_key_from_uint8_with_padding_plan(
+            &cell_with_plan, &padding_plan, (uint8_t)arr_seeds64[i], i_offset
+        );
+        if(i_result != 0){ break; }
+        i_result = TSODLULS_add_bytes_to_key_from_uint8(
+            &cell_without_plan,
+            (uint8_t)arr_seeds64[i],
+            arr_padding_parameters[j][0],
+            arr_padding_parameters[j][1],
+            arr_padding_parameters[j][2],
+            arr_padding_parameters[j][3],
+            arr_padding_parameters[j][4],
+            i_offset
+        );
+        if(i_result != 0){ break; }
+        i_offset = (i_offset + 1) % arr_padding_parameters[j][4];
+        i_result = TSODLULS_add_bytes_to_key_from_uint16_with_padding_plan(
+            &cell_with_plan, &padding_plan, (uint16_t)arr_seeds64[i], i_offset
+        );
+        if(i_result != 0){ break; }
+        i_result = TSODLULS_add_bytes_to_key_from_uint16(
+            &cell_without_plan,
+            (uint16_t)arr_seeds64[i],
+            arr_padding_parameters[j][0],
+            arr_padding_parameters[j][1],
+            arr_padding_parameters[j][2],
+            arr_padding_parameters[j][3],
+            arr_padding_parameters[j][4],
+            i_offset
+        );
+        if(i_result != 0){ break; }
+        i_offset = (i_offset + 2) % arr_padding_parameters[j][4];
+        i_result = TSODLULS_add_bytes_to_key_from_uint32_with_padding_plan(
+            &cell_with_plan, &padding_plan, (uint32_t)arr_seeds64[i], i_offset
+        );
+        if(i_result != 0){ break; }
+        i_result = TSODLULS_add_bytes_to_key_from_uint32(
+            &cell_without_plan,
+            (uint32_t)arr_seeds64[i],
+            arr_padding_parameters[j][0],
+            arr_padding_parameters[j][1],
+            arr_padding_parameters[j][2],
+            arr_padding_parameters[j][3],
+            arr_padding_parameters[j][4],
+            i_offset
+        );
+        if(i_result != 0){ break; }
+        i_offset = (i_offset + 4) % arr_padding_parameters[j][4];
+        i_result = TSODLULS_add_bytes_to_key_from_uint64_with_padding_plan(
+            &cell_with_plan, &padding_plan, arr_seeds64[i], i_offset
+        );
+        if(i_result != 0){ break; }
+        i_result = TSODLULS_add_bytes_to_key_from_uint64(
+            &cell_without_plan,
+            arr_seeds64[i],
+            arr_padding_parameters[j][0],
+            arr_padding_parameters[j][1],
+            arr_padding_parameters[j][2],
+            arr_padding_parameters[j][3],
+            arr_padding_parameters[j][4],
+            i_offset
+        );
+        if(i_result != 0){ break; }
+        if(cell_with_plan.i_key_size != cell_without_plan.i_key_size
+          || memcmp(cell_with_plan.s_key, cell_without_plan.s_key, cell_with_plan.i_key_size) != 0
+        ){
+          printf("keys with and without padding plan are different (padding parameters set %zu)\n", j);
+          i_result = -1;
+          break;
+        }
+      }
+      TSODLULS_padding_plan_free(&padding_plan);
+      if(i_result != 0){
+        break;
+      }
+    }
+    TSODLULS_free_key(&cell_with_plan);
+    TSODLULS_free_key(&cell_without_plan);
+    if(i_result != 0){
+      break;
+    }
+
+    //variable-length encodings of pairs of uint64 and of pairs of int64 with 0 to 8 significant bytes
+    TSODLULS_init_element(&(arr_varint_cells[0]));
+    TSODLULS_init_element(&(arr_varint_cells[1]));
+    TSODLULS_init_element(&cell_varint_macraff);
+    for(size_t j = 0; j < 10 && i_result == 0; ++j){
+      for(i = 0; i < i_number_of_elements; ++i){
+        t_TSODLULS_sort_element* p_cell = &(arr_varint_cells[i % 2]);
+        arr_varint_values[i % 2][0] = arr_seeds64[i] >> (8 * (i % 8));
+        arr_varint_values[i % 2][1] = arr_seeds64[(i * 7) % i_number_of_elements] >> (8 * ((i / 8) % 8));
+        p_cell->i_key_size = 0;
+        cell_varint_macraff.i_key_size = 0;
+        i_offset = 0;
+        for(size_t k = 0; k < 2; ++k){
+          if(j < 5){
+            i_result = TSODLULS_add_bytes_to_key_from_uint64_varint(
+                p_cell,
+                arr_varint_values[i % 2][k],
+                arr_padding_parameters[j][0],
+                arr_padding_parameters[j][1],
+                arr_padding_parameters[j][2],
+                arr_padding_parameters[j][3],
+                arr_padding_parameters[j][4],
+                i_offset
+            );
+            if(i_result != 0){ break; }
+            TSODLULS_add_bytes_to_key_from_uint64_varint__macraff(
+                i_result,
+                &cell_varint_macraff,
+                arr_varint_values[i % 2][k],
+                arr_padding_parameters[j][0],
+                arr_padding_parameters[j][1],
+                arr_padding_parameters[j][2],
+                arr_padding_parameters[j][3],
+                arr_padding_parameters[j][4],
+                i_offset
+            );
+            if(i_result != 0){ break; }
+            i_offset = (i_offset + TSODLULS_get_varint_size_from_uint64(arr_varint_values[i % 2][k]))
+                     % arr_padding_parameters[j][4];
+          }
+          else{
+            i_result = TSODLULS_add_bytes_to_key_from_int64_varint(
+                p_cell,
+                (int64_t)(arr_varint_values[i % 2][k]),
+                arr_padding_parameters[j - 5][0],
+                arr_padding_parameters[j - 5][1],
+                arr_padding_parameters[j - 5][2],
+                arr_padding_parameters[j - 5][3],
+                arr_padding_parameters[j - 5][4],
+                i_offset
+            );
+            if(i_result != 0){ break; }
+            TSODLULS_add_bytes_to_key_from_int64_varint__macraff(
+                i_result,
+                &cell_varint_macraff,
+                (int64_t)(arr_varint_values[i % 2][k]),
+                arr_padding_parameters[j - 5][0],
+                arr_padding_parameters[j - 5][1],
+                arr_padding_parameters[j - 5][2],
+                arr_padding_parameters[j - 5][3],
+                arr_padding_parameters[j - 5][4],
+                i_offset
+            );
+            if(i_result != 0){ break; }
+            i_offset = (i_offset + TSODLULS_get_varint_size_from_int64((int64_t)(arr_varint_values[i % 2][k])))
+                     % arr_padding_parameters[j - 5][4];
+          }
+        }
+        if(i_result != 0){ break; }
+        if(p_cell->i_key_size != cell_varint_macraff.i_key_size
+          || memcmp(p_cell->s_key, cell_varint_macraff.s_key, p_cell->i_key_size) != 0
+        ){
+          printf("variable-length keys with function and macraff are different (test %zu)\n", j);
+          i_result = -1;
+          break;
+        }
+        if(i == 0){
+          continue;
+        }
+        for(size_t k = 0; k < 2; ++k){
+          if(j < 5){
+            i_varint_expected = (arr_varint_values[i % 2][k] > arr_varint_values[1 - i % 2][k])
+                              - (arr_varint_values[i % 2][k] < arr_varint_values[1 - i % 2][k]);
+          }
+          else{
+            i_varint_expected = ((int64_t)(arr_varint_values[i % 2][k]) > (int64_t)(arr_varint_values[1 - i % 2][k]))
+                              - ((int64_t)(arr_varint_values[i % 2][k]) < (int64_t)(arr_varint_values[1 - i % 2][k]));
+          }
+          if(i_varint_expected != 0){
+            break;
+          }
+        }
+        if(
+          TSODLULS_compare_nextified_key_in_cell_by_words(&(arr_varint_cells[i % 2]), &(arr_varint_cells[1 - i % 2]))
+          != i_varint_expected
+        ){
+          printf("variable-length keys are not in the order of the values (test %zu, index %zu)\n", j, i);
+          i_result = -1;
+          break;
+        }
+      }
+    }
+    TSODLULS_free_key(&(arr_varint_cells[0]));
+    TSODLULS_free_key(&(arr_varint_cells[1]));
+    TSODLULS_free_key(&cell_varint_macraff);
+    if(i_result != 0){
+      break;
+    }
+
+
     printf("Test 2 succeeded.\n");
   }
   while(0);
@@ -897,6 +1843,12 @@ int main(int argc, char *argv[]){
   if(arr_f_double_seed != NULL){ TSODLULS_free(arr_f_double_seed); }
   if(arr_f_double_result1 != NULL){ TSODLULS_free(arr_f_double_result1); }
   if(arr_f_double_result2 != NULL){ TSODLULS_free(arr_f_double_result2); }
+  if(arr_samplesort_keys != NULL){ TSODLULS_free(arr_samplesort_keys); }
+  if(arr_samplesort_key_bytes != NULL){ TSODLULS_free(arr_samplesort_key_bytes); }
+  if(arr_samplesort_cells__short != NULL){ TSODLULS_free(arr_samplesort_cells__short); }
+  if(arr_samplesort_cells != NULL){ TSODLULS_free(arr_samplesort_cells); }
+  if(arr_radix64_key_bytes != NULL){ TSODLULS_free(arr_radix64_key_bytes); }
+  if(arr_lazy_triples != NULL){ TSODLULS_free(arr_lazy_triples); }
   if(arr_cells != NULL){
     for(i = 0; i < i_number_of_elements; ++i){
       TSODLULS_free_key__macraff(&(arr_cells[i]));
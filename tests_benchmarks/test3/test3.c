@@ -0,0 +1,452 @@
+/*
+This file is part of TSODLULS library.
+
+TSODLULS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+TSODLULS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
+
+©Copyright 2018-2019 Laurent Lyaudet
+*/
+/*
+Explanations for this test:
+- a few valid and invalid TSODs are parsed and the result of the parser is checked,
+- the nextification functions generated by tsodl_to_c from test3_long.tsodl and test3_short.tsodl
+  (see the Makefile) are used to sort 1024 random structs with TSODLULS sort,
+  and it is tested that the result is sorted according to hand written comparison functions
+  for the same orders, like the result of glibc quicksort with these comparison functions,
+- the same orders are compiled at runtime and it is tested that the keys are the same as the generated keys.
+*/
+
+#include "../test_functions.c"
+
+
+
+typedef struct test3_object {
+  int32_t i_year;
+  char* s_name;
+  char* s_alias;
+  double f_weight;
+  uint8_t* s_blob;
+  uint16_t i_blob_size;
+  char s_code[4];
+  uint64_t ui_id;
+  int8_t i_small;
+  uint16_t i_small_id;
+} t_test3_object;
+
+
+
+#include "test3_generated_long.c"
+#include "test3_generated_short.c"
+
+
+
+/**
+ * The members of t_test3_object for the compiled TSODs
+ */
+t_TSODLULS_tsodl_member arr_test3_members[] = {
+  TSODLULS_TSODL_MEMBER(t_test3_object, i_year),
+  TSODLULS_TSODL_MEMBER(t_test3_object, s_name),
+  TSODLULS_TSODL_MEMBER(t_test3_object, s_alias),
+  TSODLULS_TSODL_MEMBER(t_test3_object, f_weight),
+  TSODLULS_TSODL_MEMBER(t_test3_object, s_blob),
+  TSODLULS_TSODL_MEMBER(t_test3_object, i_blob_size),
+  TSODLULS_TSODL_ARRAY_MEMBER(t_test3_object, s_code),
+  TSODLULS_TSODL_MEMBER(t_test3_object, ui_id),
+  TSODLULS_TSODL_MEMBER(t_test3_object, i_small),
+  TSODLULS_TSODL_MEMBER(t_test3_object, i_small_id),
+};
+#define I_TEST3_NUMBER_OF_MEMBERS (sizeof(arr_test3_members) / sizeof(t_TSODLULS_tsodl_member))
+
+
+
+/**
+ * Lexicographic comparison of two strings with the characters by descending order (a prefix comes first)
+ */
+int test3_compare_lexicographic_desc(const uint8_t* s_a, size_t i_length_a, const uint8_t* s_b, size_t i_length_b){
+  for(size_t i = 0; i < i_length_a && i < i_length_b; ++i){
+    if(s_a[i] != s_b[i]){
+      return (s_a[i] < s_b[i]) - (s_a[i] > s_b[i]);
+    }
+  }
+  return (i_length_a > i_length_b) - (i_length_a < i_length_b);
+}//end function test3_compare_lexicographic_desc()
+
+
+
+/**
+ * Comparison function for the order in test3_long.tsodl
+ */
+int test3_compare_long(const void *a, const void *b){
+  const t_test3_object* c = *((t_test3_object* const*) a);
+  const t_test3_object* d = *((t_test3_object* const*) b);
+  int i_result = 0;
+  if(c->i_year != d->i_year){
+    return (c->i_year < d->i_year) - (c->i_year > d->i_year);
+  }
+  i_result = strcmp(c->s_name, d->s_name);
+  if(i_result != 0){
+    return i_result;
+  }
+  i_result = test3_compare_lexicographic_desc(
+      (const uint8_t*)c->s_alias, strlen(c->s_alias), (const uint8_t*)d->s_alias, strlen(d->s_alias)
+  );
+  if(i_result != 0){
+    return i_result;
+  }
+  if(c->f_weight != d->f_weight){
+    return (c->f_weight < d->f_weight) - (c->f_weight > d->f_weight);
+  }
+  i_result = test3_compare_lexicographic_desc(c->s_blob, c->i_blob_size, d->s_blob, d->i_blob_size);
+  if(i_result != 0){
+    return i_result;
+  }
+  i_result = memcmp(d->s_code, c->s_code, 4);
+  if(i_result != 0){
+    return i_result;
+  }
+  return (c->ui_id > d->ui_id) - (c->ui_id < d->ui_id);
+}//end function test3_compare_long()
+
+
+
+/**
+ * Comparison function for the order in test3_short.tsodl
+ */
+int test3_compare_short(const void *a, const void *b){
+  const t_test3_object* c = *((t_test3_object* const*) a);
+  const t_test3_object* d = *((t_test3_object* const*) b);
+  int i_result = 0;
+  if(c->i_year != d->i_year){
+    return (c->i_year > d->i_year) - (c->i_year < d->i_year);
+  }
+  i_result = memcmp(d->s_code, c->s_code, 4);
+  if(i_result != 0){
+    return i_result;
+  }
+  if(c->i_small != d->i_small){
+    return (c->i_small < d->i_small) - (c->i_small > d->i_small);
+  }
+  return (c->i_small_id > d->i_small_id) - (c->i_small_id < d->i_small_id);
+}//end function test3_compare_short()
+
+
+
+int main(int argc, char *argv[]){
+
+  int i_result = 0;
+  unsigned int i_seed = time(0);
+  srand(i_seed);
+  printf("Seed: %u\n", i_seed);
+
+  size_t i;
+  size_t j;
+  size_t i_number_of_elements = 1024;
+  size_t i_length;
+  t_test3_object* arr_objects = NULL;
+  t_test3_object** arr_p_objects = NULL;
+  t_test3_object** arr_p_objects_sorted = NULL;
+  t_TSODLULS_sort_element* arr_cells = NULL;
+  t_TSODLULS_sort_element__short* arr_cells__short = NULL;
+  t_TSODLULS_sort_element* arr_cells_compiled = NULL;
+  t_TSODLULS_sort_element__short* arr_cells_compiled__short = NULL;
+  t_TSODLULS_tsodl_order order;
+  t_TSODLULS_tsodl_program program;
+  uint8_t arr_blob_bytes[3] = {0, 1, 255};
+
+  do{
+    //parser
+    i_result = TSODLULS_tsodl_parse(
+        &order,
+        "NEXT(\n"
+        "  *CURRENT INT DESC, //comment\n"
+        "  NEXT(CURRENT . a -> b UINT8 RANGE(-3, 300), /* comment */ CURRENT.s CHAR(3)),\n"
+        "  CURRENT->s VARCHAR(NULL(3)) ASC,\n"
+        "  LEXICOGRAPHIC( CURRENT->t CHAR(2) DESC ),\n"
+        ")"
+    );
+    if(i_result != 0
+      || order.i_number_of_fields != 5
+      || order.i_fixed_key_size != 11
+      || !order.b_variable_key_size
+      || strcmp(order.arr_fields[1].s_expression, "CURRENT.a->b") != 0
+      || order.arr_fields[1].i_key_size != 2
+      || order.arr_fields[3].i_terminator != 3
+      || !order.arr_fields[4].b_lexicographic
+      || !order.arr_fields[4].b_descending
+    ){
+      printf("The valid TSOD was not parsed correctly (%d).\n", i_result);
+      i_result = -1;
+      TSODLULS_tsodl_free_order(&order);
+      break;
+    }
+    TSODLULS_tsodl_free_order(&order);
+
+    #define test3_check_parse_error(s_tsod, i_expected_error) \
+    i_result = TSODLULS_tsodl_parse(&order, s_tsod);\
+    TSODLULS_tsodl_free_order(&order);\
+    if(i_result != i_expected_error){\
+      printf("Parsing " #s_tsod " gave %d instead of %d.\n", i_result, i_expected_error);\
+      i_result = -1;\
+      break;\
+    }\
+    i_result = 0;
+
+    test3_check_parse_error("NEXT(CURRENT.a INT32,", I_ERROR__TSODL_SYNTAX_ERROR);
+    test3_check_parse_error("CURRENT.a INT32 DESC CURRENT.b INT32", I_ERROR__TSODL_SYNTAX_ERROR);
+    test3_check_parse_error("CURRENT.a INTEGER", I_ERROR__TSODL_UNKNOWN_TYPE);
+    test3_check_parse_error("LEXICOGRAPHIC([CURRENT CHAR(1)])", I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT);
+    test3_check_parse_error("LEXICOGRAPHIC(CURRENT.a INT32)", I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT);
+    test3_check_parse_error("LEXICOGRAPHIC(CURRENT.s VARCHAR(NULL)", I_ERROR__TSODL_SYNTAX_ERROR);
+    test3_check_parse_error("CURRENT.s CHAR(31) COLLATION(INT8 f)", I_ERROR__TSODL_UNSUPPORTED_CONSTRUCT);
+    test3_check_parse_error("CURRENT.a INT8 RANGE(5, 1)", I_ERROR__TSODL_INVALID_RANGE);
+    test3_check_parse_error("CURRENT.a FLOAT RANGE(0, 1)", I_ERROR__TSODL_INVALID_RANGE);
+    test3_check_parse_error("CURRENT.s CHAR(0)", I_ERROR__TSODL_INVALID_LENGTH);
+
+    //compiler
+    i_result = TSODLULS_tsodl_compile(&program, "CURRENT->i_year INT32 RANGE(1900, 2155", arr_test3_members, I_TEST3_NUMBER_OF_MEMBERS);
+    TSODLULS_tsodl_free_program(&program);
+    if(i_result != I_ERROR__TSODL_SYNTAX_ERROR || program.i_error_offset != 38){
+      printf("Compiling an invalid TSOD gave %d at offset %zu.\n", i_result, program.i_error_offset);
+      i_result = -1;
+      break;
+    }
+    i_result = TSODLULS_tsodl_compile(&program, "NEXT(CURRENT->i_year INT32, CURRENT->i_month INT8)", arr_test3_members, I_TEST3_NUMBER_OF_MEMBERS);
+    TSODLULS_tsodl_free_program(&program);
+    if(i_result != I_ERROR__TSODL_UNKNOWN_MEMBER){
+      printf("Compiling a TSOD with an unknown member gave %d.\n", i_result);
+      i_result = -1;
+      break;
+    }
+    i_result = 0;
+
+    //random objects with many ties on the first fields
+    arr_objects = calloc(i_number_of_elements, sizeof(t_test3_object));
+    arr_p_objects = calloc(i_number_of_elements, sizeof(t_test3_object*));
+    arr_p_objects_sorted = calloc(i_number_of_elements, sizeof(t_test3_object*));
+    if(arr_objects == NULL || arr_p_objects == NULL || arr_p_objects_sorted == NULL){
+      i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+      break;
+    }
+    for(i = 0; i < i_number_of_elements; ++i){
+      arr_p_objects[i] = &(arr_objects[i]);
+      arr_objects[i].i_year = 1900 + get_random_uint8() % 4;
+      i_length = get_random_uint8() % 4;
+      arr_objects[i].s_name = calloc(i_length + 1, sizeof(char));
+      if(arr_objects[i].s_name == NULL){
+        i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+        break;
+      }
+      for(j = 0; j < i_length; ++j){
+        arr_objects[i].s_name[j] = (get_random_uint8() % 2) ? 'a' : (char)200;
+      }
+      i_length = get_random_uint8() % 4;
+      arr_objects[i].s_alias = calloc(i_length + 1, sizeof(char));
+      if(arr_objects[i].s_alias == NULL){
+        i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+        break;
+      }
+      for(j = 0; j < i_length; ++j){
+        arr_objects[i].s_alias[j] = (get_random_uint8() % 2) ? 'a' : (char)200;
+      }
+      arr_objects[i].f_weight = ((double)(get_random_uint8() % 5)) - 2.5;
+      arr_objects[i].i_blob_size = get_random_uint8() % 4;
+      arr_objects[i].s_blob = calloc(arr_objects[i].i_blob_size + 1, sizeof(uint8_t));
+      if(arr_objects[i].s_blob == NULL){
+        i_result = I_ERROR__COULD_NOT_ALLOCATE_MEMORY;
+        break;
+      }
+      for(j = 0; j < arr_objects[i].i_blob_size; ++j){
+        arr_objects[i].s_blob[j] = arr_blob_bytes[get_random_uint8() % 3];
+      }
+      for(j = 0; j < 4; ++j){
+        arr_objects[i].s_code[j] = (get_random_uint8() % 2) ? 'b' : (char)250;
+      }
+      arr_objects[i].ui_id = get_random_uint64();
+      arr_objects[i].i_small = (int8_t)get_random_uint8();
+      arr_objects[i].i_small_id = get_random_uint8();
+    }
+    if(i_result != 0){
+      break;
+    }
+
+    //long cells
+    i_result = TSODLULS_init_array_of_elements(&arr_cells, i_number_of_elements);
+    if(i_result != 0){
+      break;
+    }
+    i_result = test3_long_key__fill_cells(arr_cells, arr_p_objects, i_number_of_elements);
+    if(i_result != 0){
+      break;
+    }
+    i_result = TSODLULS_init_array_of_elements(&arr_cells_compiled, i_number_of_elements);
+    if(i_result != 0){
+      break;
+    }
+    i_result = TSODLULS_tsodl_compile(
+        &program,
+        "NEXT(\n"
+        "  CURRENT->i_year INT32 RANGE(1900, 2155) DESC,\n"
+        "  CURRENT->s_name VARCHAR(NULL),\n"
+        "  LEXICOGRAPHIC(CURRENT->s_alias VARCHAR(NULL) DESC),\n"
+        "  CURRENT->f_weight DOUBLE DESC,\n"
+        "  NEXT(\n"
+        "    LEXICOGRAPHIC(CURRENT->s_blob VARCHAR(CURRENT->i_blob_size UINT16) DESC),\n"
+        "    CURRENT->s_code CHAR(4) DESC,\n"
+        "  ),\n"
+        "  CURRENT->ui_id UINT64,\n"
+        ")",
+        arr_test3_members,
+        I_TEST3_NUMBER_OF_MEMBERS
+    );
+    if(i_result == 0){
+      i_result = TSODLULS_tsodl_fill_cells(
+          &program, arr_cells_compiled, arr_p_objects, sizeof(t_test3_object*), i_number_of_elements
+      );
+    }
+    if(i_result == 0){
+      //the key does not fit in a short cell
+      if(TSODLULS_tsodl_fill_cells__short(
+          &program, arr_cells__short, arr_p_objects, sizeof(t_test3_object*), i_number_of_elements
+        ) != I_ERROR__TSODL_KEY_TOO_LONG_FOR_SHORT_CELLS
+      ){
+        printf("Compiled TSOD with long keys accepted for short cells\n");
+        i_result = -1;
+      }
+    }
+    TSODLULS_tsodl_free_program(&program);
+    if(i_result != 0){
+      break;
+    }
+    for(i = 0; i < i_number_of_elements; ++i){
+      if(arr_cells_compiled[i].p_object != arr_cells[i].p_object
+        || arr_cells_compiled[i].i_key_size != arr_cells[i].i_key_size
+        || memcmp(arr_cells_compiled[i].s_key, arr_cells[i].s_key, arr_cells[i].i_key_size) != 0
+      ){
+        printf("Compiled and generated keys are different (long cells)\n");
+        i_result = -1;
+        break;
+      }
+    }
+    if(i_result != 0){
+      break;
+    }
+    i_result = TSODLULS_sort(arr_cells, i_number_of_elements);
+    if(i_result != 0){
+      break;
+    }
+    memcpy(arr_p_objects_sorted, arr_p_objects, i_number_of_elements * sizeof(t_test3_object*));
+    qsort(arr_p_objects_sorted, i_number_of_elements, sizeof(t_test3_object*), test3_compare_long);
+    for(i = 0; i < i_number_of_elements; ++i){
+      if(test3_compare_long(arr_cells[i].p_object, &(arr_p_objects_sorted[i])) != 0){
+        printf("qsort and TSODLULS sort with generated keys gave different results (long cells)\n");
+        i_result = -1;
+        break;
+      }
+    }
+    if(i_result != 0){
+      break;
+    }
+    TSODLULS_free_keys_in_array_of_elements(arr_cells, i_number_of_elements);
+    TSODLULS_free(arr_cells);
+
+    //short cells
+    i_result = TSODLULS_init_array_of_elements__short(&arr_cells__short, i_number_of_elements);
+    if(i_result != 0){
+      break;
+    }
+    test3_short_key__short__fill_cells(arr_cells__short, arr_p_objects, i_number_of_elements);
+    i_result = TSODLULS_init_array_of_elements__short(&arr_cells_compiled__short, i_number_of_elements);
+    if(i_result != 0){
+      break;
+    }
+    i_result = TSODLULS_tsodl_compile(
+        &program,
+        "NEXT(\n"
+        "  CURRENT->i_year INT32 RANGE(1900, 2155),\n"
+        "  CURRENT->s_code CHAR(4) DESC,\n"
+        "  CURRENT->i_small INT8 DESC,\n"
+        "  CURRENT->i_small_id UINT16 RANGE(0, 255),\n"
+        ")",
+        arr_test3_members,
+        I_TEST3_NUMBER_OF_MEMBERS
+    );
+    if(i_result == 0){
+      i_result = TSODLULS_tsodl_fill_cells__short(
+          &program, arr_cells_compiled__short, arr_p_objects, sizeof(t_test3_object*), i_number_of_elements
+      );
+    }
+    TSODLULS_tsodl_free_program(&program);
+    if(i_result != 0){
+      break;
+    }
+    for(i = 0; i < i_number_of_elements; ++i){
+      if(arr_cells_compiled__short[i].p_object != arr_cells__short[i].p_object
+        || arr_cells_compiled__short[i].i_key != arr_cells__short[i].i_key
+      ){
+        printf("Compiled and generated keys are different (short cells)\n");
+        i_result = -1;
+        break;
+      }
+    }
+    if(i_result != 0){
+      break;
+    }
+    i_result = TSODLULS_sort__short(arr_cells__short, i_number_of_elements, test3_short_key__KEY_SIZE);
+    if(i_result != 0){
+      break;
+    }
+    memcpy(arr_p_objects_sorted, arr_p_objects, i_number_of_elements * sizeof(t_test3_object*));
+    qsort(arr_p_objects_sorted, i_number_of_elements, sizeof(t_test3_object*), test3_compare_short);
+    for(i = 0; i < i_number_of_elements; ++i){
+      if(test3_compare_short(arr_cells__short[i].p_object, &(arr_p_objects_sorted[i])) != 0){
+        printf("qsort and TSODLULS sort with generated keys gave different results (short cells)\n");
+        i_result = -1;
+        break;
+      }
+    }
+    if(i_result != 0){
+      break;
+    }
+    TSODLULS_free(arr_cells__short);
+
+    printf("Test 3 succeeded.\n");
+  }
+  while(0);
+
+  if(arr_objects != NULL){
+    for(i = 0; i < i_number_of_elements; ++i){
+      if(arr_objects[i].s_name != NULL){ TSODLULS_free(arr_objects[i].s_name); }
+      if(arr_objects[i].s_alias != NULL){ TSODLULS_free(arr_objects[i].s_alias); }
+      if(arr_objects[i].s_blob != NULL){ TSODLULS_free(arr_objects[i].s_blob); }
+    }
+    TSODLULS_free(arr_objects);
+  }
+  if(arr_p_objects != NULL){ TSODLULS_free(arr_p_objects); }
+  if(arr_p_objects_sorted != NULL){ TSODLULS_free(arr_p_objects_sorted); }
+  if(arr_cells != NULL){
+    TSODLULS_free_keys_in_array_of_elements(arr_cells, i_number_of_elements);
+    TSODLULS_free(arr_cells);
+  }
+  if(arr_cells__short != NULL){
+    TSODLULS_free(arr_cells__short);
+  }
+  if(arr_cells_compiled != NULL){
+    TSODLULS_free_keys_in_array_of_elements(arr_cells_compiled, i_number_of_elements);
+    TSODLULS_free(arr_cells_compiled);
+  }
+  if(arr_cells_compiled__short != NULL){
+    TSODLULS_free(arr_cells_compiled__short);
+  }
+
+  return i_result;
+}//end function main()
@@ -164,6 +164,181 @@ char get_random_printable_ascii_char(){
 
 
 
+
+//Distributions of the seeds for the tests and benchmarks (see fill_seeds64_with_distribution())
+#define I_DISTRIBUTION__UNIFORM 0
+#define I_DISTRIBUTION__ZIPF 1//parameter: number of distinct values (default n)
+#define I_DISTRIBUTION__FEW_UNIQUE 2//parameter: number of distinct values (default 16)
+#define I_DISTRIBUTION__SORTED 3
+#define I_DISTRIBUTION__REVERSE_SORTED 4
+#define I_DISTRIBUTION__SAWTOOTH 5//parameter: number of teeth (default 16)
+#define I_DISTRIBUTION__NEARLY_SORTED 6//parameter: number of random swaps (default n / 100)
+#define I_DISTRIBUTION__GAUSSIAN 7
+#define I_DISTRIBUTION__STAGGERED 8//parameter: m in x[i] = (i * m + i) % n (default n / 2)
+#define I_DISTRIBUTION__NUMBER 9
+
+const char* arr_distribution_names[I_DISTRIBUTION__NUMBER] = {
+  "uniform",
+  "zipf",
+  "few_unique",
+  "sorted",
+  "reverse_sorted",
+  "sawtooth",
+  "nearly_sorted",
+  "gaussian",
+  "staggered",
+};
+
+
+
+/**
+ * Returns -1 if the name is unknown
+ */
+int get_distribution_from_name(const char* s_name){
+  for(int i = 0; i < I_DISTRIBUTION__NUMBER; ++i){
+    if(strcmp(s_name, arr_distribution_names[i]) == 0){
+      return i;
+    }
+  }
+  return -1;
+}//end function get_distribution_from_name()
+
+
+
+/**
+ * A random double in the open interval ]0, 1[
+ */
+double get_random_double_between_0_and_1(){
+  return (((double)(get_random_uint64() >> 11)) + 0.5) / 9007199254740992.0;//2^53
+}
+
+
+
+/**
+ * A bijective mix of the bits (splitmix64 finalizer), to give random looking values to ranks
+ */
+uint64_t get_mixed_uint64(uint64_t i_value){
+  i_value = (i_value ^ (i_value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  i_value = (i_value ^ (i_value >> 27)) * 0x94d049bb133111ebULL;
+  return i_value ^ (i_value >> 31);
+}
+
+
+
+/**
+ * A random number in [0, i_max[ such that the probability of r is roughly proportional to 1/(r+1)
+ * (Zipf law with exponent 1, the logarithm of r+1 is uniform)
+ */
+uint64_t get_random_zipf_rank(uint64_t i_max){
+  uint64_t i_rank = (uint64_t)exp(get_random_double_between_0_and_1() * log((double)i_max + 1.0)) - 1;
+  return i_rank < i_max ? i_rank : i_max - 1;
+}
+
+
+
+/**
+ * A random length in [i_min_length, i_max_length] with a power-law distribution:
+ * many short strings and a few long ones
+ */
+size_t get_random_power_law_length(size_t i_min_length, size_t i_max_length){
+  if(i_max_length <= i_min_length){
+    return i_min_length;
+  }
+  return i_min_length + (size_t)get_random_zipf_rank(i_max_length - i_min_length + 1);
+}
+
+
+
+/**
+ * Fills the seeds with the chosen distribution (I_DISTRIBUTION__*)
+ * i_parameter tunes some distributions (see the constants), 0 is for the default value.
+ * Except for the uniform distribution, the seeds are spread on the most significant bits,
+ * hence the seeds of the smaller types must be taken from the most significant bits
+ * (arr_seeds64[i] >> 56 for uint8, etc.) to keep the order of the seeds.
+ * The gaussian seeds are the nextified keys of gaussian doubles (mean 0 and standard deviation 1),
+ * the seeds of the other types are only a monotone image of them.
+ */
+int fill_seeds64_with_distribution(
+  uint64_t* arr_seeds64,
+  size_t i_number_of_elements,
+  int i_distribution,
+  uint64_t i_parameter
+){
+  size_t i;
+  uint64_t i_salt = get_random_uint64();
+  uint64_t i_step = i_number_of_elements > 0 ? UINT64_MAX / i_number_of_elements : 0;//seed of rank r is r * i_step
+  uint64_t i_period = 0;
+  uint64_t tmp;
+
+  switch(i_distribution){
+    case I_DISTRIBUTION__UNIFORM:
+      for(i = 0; i < i_number_of_elements; ++i){
+        arr_seeds64[i] = get_random_uint64();
+      }
+    break;
+    case I_DISTRIBUTION__ZIPF:
+      i_period = i_parameter > 0 ? i_parameter : i_number_of_elements;
+      for(i = 0; i < i_number_of_elements; ++i){
+        arr_seeds64[i] = get_mixed_uint64(get_random_zipf_rank(i_period) ^ i_salt);
+      }
+    break;
+    case I_DISTRIBUTION__FEW_UNIQUE:
+      i_period = i_parameter > 0 ? i_parameter : 16;
+      for(i = 0; i < i_number_of_elements; ++i){
+        arr_seeds64[i] = get_mixed_uint64((get_random_uint64() % i_period) ^ i_salt);
+      }
+    break;
+    case I_DISTRIBUTION__SORTED:
+    case I_DISTRIBUTION__NEARLY_SORTED:
+      for(i = 0; i < i_number_of_elements; ++i){
+        arr_seeds64[i] = i * i_step;
+      }
+      if(i_distribution == I_DISTRIBUTION__NEARLY_SORTED && i_number_of_elements > 1){
+        i_period = i_parameter > 0 ? i_parameter : (i_number_of_elements / 100 > 0 ? i_number_of_elements / 100 : 1);
+        for(i = 0; i < i_period; ++i){
+          size_t j = get_random_uint64() % i_number_of_elements;
+          size_t k = get_random_uint64() % i_number_of_elements;
+          tmp = arr_seeds64[j]; arr_seeds64[j] = arr_seeds64[k]; arr_seeds64[k] = tmp;//swapping
+        }
+      }
+    break;
+    case I_DISTRIBUTION__REVERSE_SORTED:
+      for(i = 0; i < i_number_of_elements; ++i){
+        arr_seeds64[i] = (i_number_of_elements - 1 - i) * i_step;
+      }
+    break;
+    case I_DISTRIBUTION__SAWTOOTH:
+      i_period = i_parameter > 0 ? i_parameter : 16;
+      i_period = (i_number_of_elements + i_period - 1) / i_period;//length of a tooth
+      if(i_period == 0){
+        i_period = 1;
+      }
+      for(i = 0; i < i_number_of_elements; ++i){
+        arr_seeds64[i] = (i % i_period) * (UINT64_MAX / i_period);
+      }
+    break;
+    case I_DISTRIBUTION__GAUSSIAN:
+      for(i = 0; i < i_number_of_elements; ++i){
+        //Box-Muller transform
+        double f_gaussian = sqrt(-2.0 * log(get_random_double_between_0_and_1()))
+                          * cos(2.0 * M_PI * get_random_double_between_0_and_1());
+        arr_seeds64[i] = TSODLULS_get_uint_from_double(f_gaussian);
+      }
+    break;
+    case I_DISTRIBUTION__STAGGERED:
+      i_period = i_parameter > 0 ? i_parameter : i_number_of_elements / 2;
+      for(i = 0; i < i_number_of_elements; ++i){
+        arr_seeds64[i] = ((i * i_period + i) % i_number_of_elements) * i_step;
+      }
+    break;
+    default:
+      return -1;
+  }
+  return 0;
+}//end function fill_seeds64_with_distribution()
+
+
+
 uint8_t convert_custom_collation_on_printable_ascii_char(char c){
   //print an ascii table found on Internet to understand this function
   //invalid characters are sent on space ' '
@@ -409,3 +584,18 @@ void print_bits_for_key(t_TSODLULS_sort_element* p_sort_element){
 
 
 
+
+
+
+/**
+ * Adds the field i_field of the triple of uint64 of the object of the cell to its key,
+ * for the sorts with lazy keys, and counts the calls in the size_t pointed by p_context.
+ */
+int add_field_of_uint64_triple_to_key(t_TSODLULS_sort_element* p_sort_element, size_t i_field, void* p_context){
+  ++(*((size_t*)p_context));
+  return TSODLULS_add_bytes_to_key_from_uint64(
+      p_sort_element,
+      ((uint64_t*)(p_sort_element->p_object))[i_field],
+      0, 0, 0, 0, 1, 0
+  );
+}
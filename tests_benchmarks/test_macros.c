@@ -622,6 +622,144 @@ along with TSODLULS.  If not, see <http://www.gnu.org/licenses/>.
 
 
 
+#define TSODLULS_code_fragment_init_long_cells_for_uint64_with_key_arena() \
+  TSODLULS_key_arena_init(&key_arena, 0);\
+  i_result = TSODLULS_key_arena_init_array_of_elements(&key_arena, &arr_cells, i_number_of_elements, 8);\
+  if(i_result != 0){\
+    break;\
+  }\
+  for(i = 0; i < i_number_of_elements; ++i){\
+    i_result = TSODLULS_add_bytes_to_key_from_uint64(\
+        &(arr_cells[i]),\
+        arr_ui_64_seed[i],\
+        0,\
+        0,\
+        0,\
+        0,\
+        8,\
+        0\
+    );\
+    if(i_result != 0){\
+      break;\
+    }\
+    arr_cells[i].p_object = &(arr_ui_64_seed[i]);\
+  }\
+  if(i_result != 0){\
+    TSODLULS_free(arr_cells);\
+    break;\
+  }
+
+
+
+#define TSODLULS_code_fragment_init_long_cells_for_uint64_with_key_arena_builder() \
+  TSODLULS_key_arena_init(&key_arena, 4096);\
+  TSODLULS_init_element(&cell_builder);\
+  i_result = TSODLULS_init_array_of_elements(&arr_cells, i_number_of_elements);\
+  if(i_result != 0){\
+    break;\
+  }\
+  for(i = 0; i < i_number_of_elements; ++i){\
+    i_result = TSODLULS_add_bytes_to_key_from_uint64(\
+        &cell_builder,\
+        arr_ui_64_seed[i],\
+        0,\
+        0,\
+        0,\
+        0,\
+        8,\
+        0\
+    );\
+    if(i_result != 0){\
+      break;\
+    }\
+    i_result = TSODLULS_key_arena_commit_key(&key_arena, &cell_builder, &(arr_cells[i]));\
+    if(i_result != 0){\
+      break;\
+    }\
+    arr_cells[i].p_object = &(arr_ui_64_seed[i]);\
+  }\
+  TSODLULS_free_key(&cell_builder);\
+  if(i_result != 0){\
+    TSODLULS_free(arr_cells);\
+    break;\
+  }
+
+
+
+#define TSODLULS_code_fragment_init_long_cells_for_uint64_with_key_arena_too_small() \
+  TSODLULS_key_arena_init(&key_arena, 64);\
+  i_result = TSODLULS_init_array_of_elements(&arr_cells, i_number_of_elements);\
+  if(i_result != 0){\
+    break;\
+  }\
+  for(i = 0; i < i_number_of_elements; ++i){\
+    i_result = TSODLULS_key_arena_reserve_key(&key_arena, &(arr_cells[i]), (i % 2 == 0) ? 8 : 4);\
+    if(i_result != 0){\
+      break;\
+    }\
+    if(i % 4 < 2){\
+      i_result = TSODLULS_add_bytes_to_key_from_uint64(\
+          &(arr_cells[i]),\
+          arr_ui_64_seed[i],\
+          0,\
+          0,\
+          0,\
+          0,\
+          8,\
+          0\
+      );\
+    }\
+    else{\
+      TSODLULS_add_bytes_to_key_from_uint64__macraff(\
+          i_result,\
+          &(arr_cells[i]),\
+          arr_ui_64_seed[i],\
+          0,\
+          0,\
+          0,\
+          0,\
+          8,\
+          0\
+      );\
+    }\
+    if(i_result != 0){\
+      break;\
+    }\
+    if(((arr_cells[i].i_allocated_size & I_KEY_ARENA_FLAG) != 0) != (i % 2 == 0)){\
+      printf("Only the keys of 8 bytes should stay in the key arena\n");\
+      i_result = -1;\
+      break;\
+    }\
+    arr_cells[i].p_object = &(arr_ui_64_seed[i]);\
+  }\
+  if(i_result != 0){\
+    TSODLULS_free_keys_in_array_of_elements(arr_cells, i_number_of_elements);\
+    TSODLULS_key_arena_free(&key_arena);\
+    TSODLULS_free(arr_cells);\
+    break;\
+  }
+
+
+
+#define TSODLULS_code_fragment_fill_result2_with_long_cells_for_uint64_with_key_arena_too_small() \
+  for(i = 0; i < i_number_of_elements; ++i){\
+    arr_ui_64_result2[i] = *((uint64_t*)(arr_cells[i].p_object));\
+  }\
+  TSODLULS_free_keys_in_array_of_elements(arr_cells, i_number_of_elements);\
+  TSODLULS_key_arena_free(&key_arena);\
+  TSODLULS_free(arr_cells);
+
+
+
+#define TSODLULS_code_fragment_fill_result2_with_long_cells_for_uint64_with_key_arena() \
+  for(i = 0; i < i_number_of_elements; ++i){\
+    arr_ui_64_result2[i] = *((uint64_t*)(arr_cells[i].p_object));\
+  }\
+  TSODLULS_key_arena_free(&key_arena);\
+  TSODLULS_free(arr_cells);
+
+
+
 
 //------------------------------------------------------------------------------
 //int8